@@ -0,0 +1,251 @@
+#ifndef ARRAY_LIST_H
+#define ARRAY_LIST_H 0
+
+#include "./../../shared/bool.h"
+#include "./../../shared/types.h"
+
+// Forward declaration for the ArrayList struct
+typedef struct ArrayList ArrayList;
+
+/**
+ * newArrayList
+ * 
+ * Constrói e inicializa uma nova lista contígua (ArrayList), um vetor dinâmico de `void*`.
+ * Oferece as mesmas operações da LinkedList, mas com os elementos lado a lado na memória:
+ * acesso por índice em O(1), inserção no final em O(1) amortizado e sem uma alocação por elemento.
+ * 
+ * Retorna:
+ *  - Um ponteiro para uma nova instância de ArrayList, ou `NULL` se a alocação falhar.
+ */
+ArrayList* newArrayList();
+
+/**
+ * alAdd
+ * 
+ * Adiciona um novo elemento ao final da lista (ArrayList* list), dobrando a capacidade quando necessário.
+ * 
+ * Retorna:
+ *  - `false` se a lista for `NULL`, o elemento for `NULL`, ou se não houver memória suficiente.
+ *  - `true` se a operação for bem-sucedida.
+ */
+bool alAdd(ArrayList* list, void* element);
+
+/**
+ * salAdd
+ * 
+ * Adiciona um novo elemento ao final da lista (ArrayList* list), evitando a adição de elementos `NULL`.
+ * 
+ * Retorna:
+ *  - `false` se a lista for `NULL`, o elemento for `NULL`, ou se não houver memória suficiente.
+ *  - `true` se a operação for bem-sucedida.
+ */
+bool salAdd(ArrayList* list, void* element);
+
+/**
+ * alGet
+ * 
+ * Obtém o elemento da lista (ArrayList* list) no índice fornecido (int index), em O(1).
+ * 
+ * Retorna:
+ *  - O elemento no índice especificado, ou `NULL` caso a lista seja `NULL` ou o índice seja inválido.
+ */
+void* alGet(ArrayList* list, const int index);
+
+/**
+ * alGetLast
+ * 
+ * Obtém o último elemento da lista (ArrayList* list).
+ * 
+ * Retorna:
+ *  - O último elemento da lista, ou `NULL` se a lista estiver vazia ou `list` for `NULL`.
+ */
+void* alGetLast(ArrayList* list);
+
+/**
+ * alIsEmpty
+ * 
+ * Verifica se a lista (ArrayList* list) está vazia.
+ * 
+ * Retorna:
+ *  - `true` se a lista estiver vazia.
+ *  - `false` caso contrário (ou se `list` for `NULL`, como em `llIsEmpty`).
+ */
+bool alIsEmpty(ArrayList* list);
+
+/**
+ * alSearchAll
+ * 
+ * Pesquisa a lista (ArrayList* list) utilizando a função de busca fornecida (`searchFunc func`).
+ * 
+ * Retorna:
+ *  - Uma nova lista com os elementos que atendem à condição da função `func`, ou `NULL` em caso de erro.
+ */
+ArrayList* alSearchAll(ArrayList* list, searchFunc func);
+
+/**
+ * alSearchAllCtx
+ * 
+ * Variante de `alSearchAll` cuja condição recebe o contexto `ctx`.
+ * 
+ * Retorna:
+ *  - Uma nova lista com os elementos em que `func(elemento, ctx)` é `true`, ou `NULL` em caso de erro.
+ */
+ArrayList* alSearchAllCtx(ArrayList* list, searchCtxFunc func, void* ctx);
+
+/**
+ * alFullFree
+ * 
+ * Libera completamente a memória ocupada pela lista, incluindo os elementos internos.
+ * A função `freeFunction` é chamada para liberar a memória de cada elemento da lista.
+ * Caso não queria desalocar os elementos internos, passe como argumento para `freeFunction` `NULL`.
+ */
+void alFullFree(ArrayList* list, freeFunc freeFunction);
+
+/**
+ * alForeach
+ * 
+ * Executa uma função fornecida (`foreachFunc f`) para cada elemento da lista (ArrayList* list), em ordem.
+ */
+void alForeach(ArrayList* list, foreachFunc f);
+
+/**
+ * alForeachCtx
+ * 
+ * Variante de `alForeach` que chama `f(elemento, ctx)` para cada elemento da lista, em ordem.
+ */
+void alForeachCtx(ArrayList* list, foreachCtxFunc f, void* ctx);
+
+/**
+ * alFindFirst
+ * 
+ * Encontra e retorna o primeiro elemento da lista (ArrayList* list) que satisfaça a condição definida pela função `findFirstFunc f`.
+ * 
+ * Retorna:
+ *  - O primeiro elemento que satisfaz a condição da função `f`, ou `NULL` caso nenhum elemento seja encontrado.
+ */
+void* alFindFirst(ArrayList* list, findFirstFunc f);
+
+/**
+ * alFindFirstCtx
+ * 
+ * Variante de `alFindFirst` cuja condição recebe o contexto `ctx`.
+ * 
+ * Retorna:
+ *  - O primeiro elemento em que `f(elemento, ctx)` é `true`, ou `NULL` caso nenhum seja encontrado.
+ */
+void* alFindFirstCtx(ArrayList* list, findFirstCtxFunc f, void* ctx);
+
+/**
+ * alSort
+ * 
+ * Ordena a lista (ArrayList* list) em ordem crescente com merge sort estável, em O(n log n).
+ * Mesmo contrato de `llSort`: `f(a, b) == less_than` coloca `a` antes de `b`.
+ * 
+ * Retorna:
+ *  - `true` se a lista for ordenada com sucesso.
+ *  - `false` se a lista ou a função forem `NULL`, ou se não houver memória para o vetor auxiliar.
+ */
+bool alSort(ArrayList* list, orderFunc f);
+
+/**
+ * alSortCtx
+ * 
+ * Variante de `alSort` cuja função de comparação recebe o contexto `ctx`.
+ * 
+ * Retorna:
+ *  - `true` se a lista for ordenada com sucesso, `false` em caso de erro (como em `alSort`).
+ */
+bool alSortCtx(ArrayList* list, orderCtxFunc f, void* ctx);
+
+/**
+ * alCopy
+ * 
+ * Copia para uma nova lista os elementos entre os índices `start` e `end` (inclusive).
+ * `end` é limitado ao último índice válido.
+ * 
+ * Retorna:
+ *  - Uma nova lista com os elementos do intervalo, ou `NULL` se os índices forem inválidos ou faltar memória.
+ * 
+ * ATENÇÃO:
+ * - Os ELEMENTOS não são copiados. Para liberar a memória de uma cópia utilize `alFullFree(copia, NULL)`.
+ */
+ArrayList* alCopy(ArrayList* list, int start, int end);
+
+/**
+ * alGetSize
+ * 
+ * Obtém o tamanho (número de elementos) da lista (ArrayList* list).
+ * 
+ * Retorna:
+ *  - O número de elementos na lista.
+ *  - `-1` caso `list` seja `NULL`.
+ */
+int alGetSize(ArrayList* list);
+
+/**
+ * alRemoveFirstFound
+ * 
+ * Remove o primeiro elemento da lista (ArrayList* list) que satisfaça a condição definida pela função `removeFunc f`.
+ * Os elementos seguintes são deslocados, preservando a ordem (O(n)).
+ * 
+ * Retorna:
+ *  - `true` se um elemento foi removido com sucesso.
+ *  - `false` se nenhum elemento foi encontrado ou removido.
+ */
+bool alRemoveFirstFound(ArrayList* list, removeFunc f);
+
+/**
+ * alRemoveFirstFoundCtx
+ * 
+ * Variante de `alRemoveFirstFound` cuja condição recebe o contexto `ctx`.
+ * 
+ * Retorna:
+ *  - `true` se um elemento foi removido, `false` caso contrário.
+ */
+bool alRemoveFirstFoundCtx(ArrayList* list, removeCtxFunc f, void* ctx);
+
+/**
+ * alRemoveAt
+ * 
+ * Remove o elemento do índice fornecido, deslocando os seguintes. O elemento NÃO é liberado.
+ * 
+ * Retorna:
+ *  - `true` se o elemento foi removido.
+ *  - `false` se a lista for `NULL` ou o índice for inválido.
+ */
+bool alRemoveAt(ArrayList* list, int index);
+
+/**
+ * alRemoveElement
+ * 
+ * Remove a primeira ocorrência do elemento (comparação por ponteiro). O elemento NÃO é liberado.
+ * 
+ * Retorna:
+ *  - `true` se o elemento foi encontrado e removido.
+ *  - `false` caso contrário.
+ */
+bool alRemoveElement(ArrayList* list, void* element);
+
+/**
+ * alReserve
+ * 
+ * Garante capacidade para pelo menos `capacity` elementos sem novas realocações.
+ * 
+ * Retorna:
+ *  - `true` se a lista comporta `capacity` elementos.
+ *  - `false` se a lista for `NULL` ou não houver memória suficiente.
+ */
+bool alReserve(ArrayList* list, int capacity);
+
+/**
+ * alShrink
+ * 
+ * Reduz a capacidade da lista ao número atual de elementos, devolvendo a memória excedente.
+ * 
+ * Retorna:
+ *  - `true` se a operação foi bem-sucedida.
+ *  - `false` se a lista for `NULL` ou a realocação falhar (a lista continua válida).
+ */
+bool alShrink(ArrayList* list);
+
+#endif
@@ -0,0 +1,135 @@
+#ifndef COLLECTION_H
+#define COLLECTION_H 0
+
+#include "./../../shared/bool.h"
+#include "./../../shared/types.h"
+#include "./LinkedList.h"
+
+/*
+    Coleção usada como armazenamento principal dos bancos em memória (TimeDB e PartidaDB),
+    escolhida em tempo de compilação para que as duas implementações possam ser comparadas:
+      - padrão: LinkedList;
+      - `-DCOLLECTION_ARRAY_LIST` (`make COLLECTION=array`): ArrayList.
+
+    `ColHandle` é uma referência estável a um elemento armazenado, usada pelos índices para
+    remover o elemento sem procurá-lo. Na LinkedList é o próprio nó (remoção em O(1)); na
+    ArrayList é o próprio elemento (remoção em O(n), pois os elementos seguintes são deslocados).
+
+    As buscas (`colSearchAll`/`colSearchAllCtx`) e a visão completa (`colView`) sempre devolvem uma LinkedList,
+    de forma que a API pública do repo e as views não dependem da escolha.
+*/
+
+#ifdef COLLECTION_ARRAY_LIST
+
+#include "./ArrayList.h"
+
+typedef ArrayList Collection;
+typedef void* ColHandle;
+
+#define newCollection newArrayList
+#define colAdd alAdd
+#define scolAdd salAdd
+#define colGetLast alGetLast
+#define colIsEmpty alIsEmpty
+#define colGetSize alGetSize
+#define colForeach alForeach
+#define colForeachCtx alForeachCtx
+#define colFindFirst alFindFirst
+#define colFullFree alFullFree
+
+/**
+ * colAddHandle
+ * 
+ * Adiciona um elemento ao final da coleção e retorna a referência para ele.
+ * 
+ * Retorna:
+ *  - A referência ao elemento, ou `NULL` se a coleção ou o elemento forem `NULL` ou faltar memória.
+ */
+ColHandle colAddHandle(Collection* c, void* element);
+
+/**
+ * colHandleGet
+ * 
+ * Obtém o elemento de uma referência.
+ */
+void* colHandleGet(ColHandle h);
+
+/**
+ * colRemoveHandle
+ * 
+ * Remove da coleção o elemento da referência (sem liberá-lo).
+ * 
+ * Retorna:
+ *  - `true` se o elemento foi removido, `false` caso contrário.
+ */
+bool colRemoveHandle(Collection* c, ColHandle h);
+
+/**
+ * colSearchAll
+ * 
+ * Busca todos os elementos que atendem à condição `f`.
+ * 
+ * Retorna:
+ *  - Uma nova LinkedList com os elementos encontrados (liberar com `llFullFree(lista, NULL)`),
+ *    ou `NULL` em caso de erro.
+ */
+LinkedList* colSearchAll(Collection* c, searchFunc f);
+
+/**
+ * colSearchAllCtx
+ * 
+ * Variante de `colSearchAll` cuja condição recebe o contexto `ctx`.
+ * 
+ * Retorna:
+ *  - Uma nova LinkedList com os elementos encontrados, ou `NULL` em caso de erro.
+ */
+LinkedList* colSearchAllCtx(Collection* c, searchCtxFunc f, void* ctx);
+
+/**
+ * colView
+ * 
+ * Retorna uma LinkedList com todos os elementos da coleção. A lista é montada uma vez e guardada
+ * em `cache`, que pertence ao dono da coleção: as chamadas seguintes devolvem a mesma lista, sem
+ * copiar nada, até o dono descartá-la com `colViewFree` ao alterar a coleção. O chamador não deve liberá-la.
+ * 
+ * Retorna:
+ *  - A lista com os elementos, ou `NULL` em caso de erro.
+ */
+LinkedList* colView(Collection* c, LinkedList** cache);
+
+/**
+ * colViewFree
+ * 
+ * Libera a lista guardada por `colView` (a próxima chamada monta uma nova). O dono da coleção
+ * chama ao alterá-la; listas devolvidas antes deixam de valer.
+ */
+void colViewFree(LinkedList** cache);
+
+#else
+
+typedef LinkedList Collection;
+typedef LLNode* ColHandle;
+
+#define newCollection newLinkedList
+#define colAdd llAdd
+#define scolAdd sllAdd
+#define colGetLast llGetLast
+#define colIsEmpty llIsEmpty
+#define colGetSize llGetSize
+#define colForeach llForeach
+#define colForeachCtx llForeachCtx
+#define colFindFirst llFindFirst
+#define colFullFree llFullFree
+#define colAddHandle llAddNode
+#define colHandleGet llNodeGet
+#define colRemoveHandle llRemoveNode
+#define colSearchAll llSearchAll
+#define colSearchAllCtx llSearchAllCtx
+
+// A própria lista já é a visão completa; não há cópia para guardar nem liberar
+#define colView(c, cache) ((void)(cache), (c))
+#define colViewFree(cache) ((void)(cache))
+
+#endif
+
+#endif
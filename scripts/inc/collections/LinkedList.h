@@ -1,170 +1,370 @@
-#ifndef LINKED_LIST_H
-#define LINKED_LIST_H 0
-
-#include "./../../shared/bool.h"
-#include "./../../shared/types.h"
-
-// Forward declaration for the LinkedList struct
-typedef struct LinkedList LinkedList;
-
-/**
- * newLinkedList
- * 
- * Constrói e inicializa uma nova lista encadeada (LinkedList).
- * 
- * Retorna:
- *  - Um ponteiro para uma nova instância de LinkedList.
- */
-LinkedList* newLinkedList();
-
-/**
- * llAdd
- * 
- * Adiciona um novo elemento ao final da lista encadeada (LinkedList* list).
- * Permite adicionar um elemento de tipo `void*` ao final da lista.
- * 
- * Atenção:
- *  - É possível adicionar um elemento `NULL`, o que pode levar a comportamentos inesperados.
- *  - Para evitar adicionar um valor `NULL`, considere utilizar a função `sllAdd()`.
- * 
- * Retorna:
- *  - `false` se a lista for `NULL`, o elemento for `NULL`, ou se não houver memória suficiente para adicionar o elemento.
- *  - `true` se a operação for bem-sucedida.
- */
-bool llAdd(LinkedList* list, void* element);
-
-/**
- * sllAdd
- * 
- * Adiciona um novo elemento ao final da lista encadeada (LinkedList* list).
- * Este método evita a adição de elementos `NULL`.
- * 
- * Retorna:
- *  - `false` se a lista for `NULL`, o elemento for `NULL`, ou se não houver memória suficiente para adicionar o elemento.
- *  - `true` se a operação for bem-sucedida.
- */
-bool sllAdd(LinkedList* list, void* element);
-
-/**
- * llGet
- * 
- * Obtém o elemento da lista encadeada (LinkedList* list) no índice fornecido (int index).
- * 
- * Exemplo de comportamento:
- *  1. Se a lista estiver vazia e você tentar acessar o índice 0, a função retornará `NULL`.
- *  2. Se a lista contiver 2 elementos:
- *     - O índice 0 retorna o primeiro elemento.
- *     - O índice 1 retorna o último elemento.
- *     - O índice 2 retornará `NULL` (índice inválido).
- * 
- * Retorna:
- *  - O elemento no índice especificado, ou `NULL` caso a lista seja `NULL` ou o índice seja inválido.
- */
-void* llGet(LinkedList* list, const int index);
-
-/**
- * llGetLast
- * 
- * Obtém o último elemento da lista encadeada (LinkedList* list).
- * 
- * Retorna:
- *  - O último elemento da lista, ou `NULL` se a lista estiver vazia ou `list` for `NULL`.
- */
-void* llGetLast(LinkedList* list);
-
-/**
- * llIsEmpty
- * 
- * Verifica se a lista encadeada (LinkedList* list) está vazia.
- * 
- * Retorna:
- *  - `true` se a lista estiver vazia.
- *  - `false` caso contrário.
- */
-bool llIsEmpty(LinkedList* list);
-
-/**
- * llSearchAll
- * 
- * Pesquisa a lista encadeada (LinkedList* list) utilizando a função de busca fornecida (`searchFunc func`).
- * Retorna uma nova lista contendo todos os elementos que atendem à condição especificada pela função `func`.
- * 
- * Retorna:
- *  - Uma nova lista com os elementos que atendem à condição da função `func`.
- */
-LinkedList* llSearchAll(LinkedList* list, searchFunc func);
-
-/**
- * llFullFree
- * 
- * Libera completamente a memória ocupada pela lista encadeada, incluindo os elementos internos.
- * A função `freeFunction` é chamada para liberar a memória de cada elemento da lista.
- * Caso não queria desalocar os elementos internos, passe como argumento para `freeFunction` `NULL`.
- */
-void llFullFree(LinkedList* list, freeFunc freeFunction);
-
-/**
- * llForeach
- * 
- * Executa uma função fornecida (`foreachFunc f`) para cada elemento da lista encadeada (LinkedList* list).
- */
-void llForeach(LinkedList* list, foreachFunc f);
-
-/**
- * llFindFirst
- * 
- * Encontra e retorna o primeiro elemento da lista encadeada (LinkedList* list) que satisfaça a condição definida pela função `findFirstFunc f`.
- * 
- * Retorna:
- *  - O primeiro elemento que satisfaz a condição da função `f`, ou `NULL` caso nenhum elemento seja encontrado.
- */
-void* llFindFirst(LinkedList* list, findFirstFunc f);
-
-/**
- * llBoubleSort
- * 
- * Ordena a lista encadeada (LinkedList* list) utilizando o algoritmo de ordenação por bolha (Bubble Sort).
- * A função de comparação `orderFunc f` é usada para determinar a ordem de ordenação dos elementos.
- * 
- * Retorna:
- *  - `true` se a lista for ordenada com sucesso.
- *  - `false` se houver um erro durante a ordenação (exemplo: se a lista for `NULL`).
- */
-bool llBoubleSort(LinkedList* list, orderFunc f);
-
-/**
- * llDeepCopy
- * 
- * Realiza uma cópia profunda (deep copy) da lista encadeada (LinkedList* list) entre os índices fornecidos (int start, int end).
- * 
- * Retorna:
- *  - Uma nova lista contendo uma cópia profunda dos elementos entre os índices fornecidos.
- * 
- * ATENÇÃO:
- * - A cópia profunda não copia os ELEMENTOS TAMBÉM. Então, para liberar a memória de uma cópia utilize `llFullFree(copia, NULL)`.
- */
-LinkedList* llDeepCopy(LinkedList* list, int start, int end);
-
-/**
- * llGetSize
- * 
- * Obtém o tamanho (número de elementos) da lista encadeada (LinkedList* list).
- * 
- * Retorna:
- *  - O número de elementos na lista.
- *  - `-1` caso `list` seja `NULL`.
- */
-int llGetSize(LinkedList* list);
-
-/**
- * llRemoveFirstFound
- * 
- * Remove o primeiro elemento da lista encadeada (LinkedList* list) que satisfaça a condição definida pela função `removeFunc f`.
- * 
- * Retorna:
- *  - `true` se um elemento foi removido com sucesso.
- *  - `false` se nenhum elemento foi encontrado ou removido.
- */
-bool llRemoveFirstFound(LinkedList* list, removeFunc f);
-
-#endif
+#ifndef LINKED_LIST_H
+#define LINKED_LIST_H 0
+
+#include "./../../shared/bool.h"
+#include "./../../shared/types.h"
+
+// Forward declaration for the LinkedList struct
+typedef struct LinkedList LinkedList;
+
+// Forward declaration for the Node struct (nó da lista, usado como referência estável a um elemento)
+typedef struct Node LLNode;
+
+/*
+    Cursor emprestado sobre uma lista: guarda o nó e o índice atuais, de modo que avançar,
+    voltar e reposicionar a partir da posição lembrada não exigem percorrer a lista desde o início
+    nem alocar memória. É um valor comum (pode ficar na pilha) e não é dono da lista.
+
+    ATENÇÃO:
+     - O cursor fica inválido se o nó em que ele está for removido da lista.
+       Inserções (sempre no final) e `llSort` mantêm o nó válido, mas após `llSort` o índice
+       lembrado não corresponde mais; use `llCursor` de novo.
+*/
+typedef struct {
+    LinkedList* list;  // Lista percorrida
+    LLNode* node;      // Nó atual (`NULL` = fora da lista)
+    int index;         // Índice do nó atual
+} LLCursor;
+
+/**
+ * newLinkedList
+ * 
+ * Constrói e inicializa uma nova lista encadeada (LinkedList).
+ * Os nós de cada lista vêm de um pool próprio (blocos contíguos com reuso dos nós removidos),
+ * liberado de uma vez em `llFullFree`. Por isso um nó nunca passa de uma lista para outra.
+ * 
+ * Retorna:
+ *  - Um ponteiro para uma nova instância de LinkedList.
+ */
+LinkedList* newLinkedList();
+
+/**
+ * llAdd
+ * 
+ * Adiciona um novo elemento ao final da lista encadeada (LinkedList* list).
+ * Permite adicionar um elemento de tipo `void*` ao final da lista.
+ * 
+ * Atenção:
+ *  - É possível adicionar um elemento `NULL`, o que pode levar a comportamentos inesperados.
+ *  - Para evitar adicionar um valor `NULL`, considere utilizar a função `sllAdd()`.
+ * 
+ * Retorna:
+ *  - `false` se a lista for `NULL`, o elemento for `NULL`, ou se não houver memória suficiente para adicionar o elemento.
+ *  - `true` se a operação for bem-sucedida.
+ */
+bool llAdd(LinkedList* list, void* element);
+
+/**
+ * llAddNode
+ * 
+ * Adiciona um novo elemento ao final da lista encadeada (LinkedList* list) e retorna o nó criado.
+ * O nó continua válido até ser removido da lista, podendo ser guardado em índices externos
+ * para acesso (`llNodeGet`) e remoção (`llRemoveNode`) em O(1).
+ * 
+ * Retorna:
+ *  - O nó criado.
+ *  - `NULL` se a lista for `NULL`, o elemento for `NULL`, ou se não houver memória suficiente.
+ */
+LLNode* llAddNode(LinkedList* list, void* element);
+
+/**
+ * llNodeGet
+ * 
+ * Obtém o elemento armazenado em um nó (LLNode* node).
+ * 
+ * Retorna:
+ *  - O elemento armazenado, ou `NULL` se `node` for `NULL`.
+ */
+void* llNodeGet(LLNode* node);
+
+/**
+ * sllAdd
+ * 
+ * Adiciona um novo elemento ao final da lista encadeada (LinkedList* list).
+ * Este método evita a adição de elementos `NULL`.
+ * 
+ * Retorna:
+ *  - `false` se a lista for `NULL`, o elemento for `NULL`, ou se não houver memória suficiente para adicionar o elemento.
+ *  - `true` se a operação for bem-sucedida.
+ */
+bool sllAdd(LinkedList* list, void* element);
+
+/**
+ * llGet
+ * 
+ * Obtém o elemento da lista encadeada (LinkedList* list) no índice fornecido (int index).
+ * 
+ * Exemplo de comportamento:
+ *  1. Se a lista estiver vazia e você tentar acessar o índice 0, a função retornará `NULL`.
+ *  2. Se a lista contiver 2 elementos:
+ *     - O índice 0 retorna o primeiro elemento.
+ *     - O índice 1 retorna o último elemento.
+ *     - O índice 2 retornará `NULL` (índice inválido).
+ * 
+ * Retorna:
+ *  - O elemento no índice especificado, ou `NULL` caso a lista seja `NULL` ou o índice seja inválido.
+ */
+void* llGet(LinkedList* list, const int index);
+
+/**
+ * llGetLast
+ * 
+ * Obtém o último elemento da lista encadeada (LinkedList* list).
+ * 
+ * Retorna:
+ *  - O último elemento da lista, ou `NULL` se a lista estiver vazia ou `list` for `NULL`.
+ */
+void* llGetLast(LinkedList* list);
+
+/**
+ * llIsEmpty
+ * 
+ * Verifica se a lista encadeada (LinkedList* list) está vazia.
+ * 
+ * Retorna:
+ *  - `true` se a lista estiver vazia.
+ *  - `false` caso contrário.
+ */
+bool llIsEmpty(LinkedList* list);
+
+/**
+ * llSearchAll
+ * 
+ * Pesquisa a lista encadeada (LinkedList* list) utilizando a função de busca fornecida (`searchFunc func`).
+ * Retorna uma nova lista contendo todos os elementos que atendem à condição especificada pela função `func`.
+ * 
+ * Retorna:
+ *  - Uma nova lista com os elementos que atendem à condição da função `func`.
+ */
+LinkedList* llSearchAll(LinkedList* list, searchFunc func);
+
+/**
+ * llSearchAllCtx
+ * 
+ * Variante de `llSearchAll` cuja condição recebe o contexto `ctx` (sem estado global; reentrante).
+ * 
+ * Retorna:
+ *  - Uma nova lista com os elementos em que `func(elemento, ctx)` é `true`, ou `NULL` em caso de erro.
+ */
+LinkedList* llSearchAllCtx(LinkedList* list, searchCtxFunc func, void* ctx);
+
+/**
+ * llFullFree
+ * 
+ * Libera completamente a memória ocupada pela lista encadeada, incluindo os elementos internos.
+ * A função `freeFunction` é chamada para liberar a memória de cada elemento da lista.
+ * Caso não queria desalocar os elementos internos, passe como argumento para `freeFunction` `NULL`.
+ * Os nós são liberados em O(blocos do pool).
+ */
+void llFullFree(LinkedList* list, freeFunc freeFunction);
+
+/**
+ * llForeach
+ * 
+ * Executa uma função fornecida (`foreachFunc f`) para cada elemento da lista encadeada (LinkedList* list).
+ */
+void llForeach(LinkedList* list, foreachFunc f);
+
+/**
+ * llForeachCtx
+ * 
+ * Variante de `llForeach` que chama `f(elemento, ctx)` para cada elemento da lista.
+ */
+void llForeachCtx(LinkedList* list, foreachCtxFunc f, void* ctx);
+
+/**
+ * llFindFirst
+ * 
+ * Encontra e retorna o primeiro elemento da lista encadeada (LinkedList* list) que satisfaça a condição definida pela função `findFirstFunc f`.
+ * 
+ * Retorna:
+ *  - O primeiro elemento que satisfaz a condição da função `f`, ou `NULL` caso nenhum elemento seja encontrado.
+ */
+void* llFindFirst(LinkedList* list, findFirstFunc f);
+
+/**
+ * llFindFirstCtx
+ * 
+ * Variante de `llFindFirst` cuja condição recebe o contexto `ctx`.
+ * 
+ * Retorna:
+ *  - O primeiro elemento em que `f(elemento, ctx)` é `true`, ou `NULL` caso nenhum seja encontrado.
+ */
+void* llFindFirstCtx(LinkedList* list, findFirstCtxFunc f, void* ctx);
+
+/**
+ * llSort
+ * 
+ * Ordena a lista encadeada (LinkedList* list) em ordem crescente utilizando merge sort, em O(n log n).
+ * A função de comparação `orderFunc f` determina a ordem: `f(a, b) == less_than` coloca `a` antes de `b`.
+ * A ordenação é estável: elementos considerados iguais mantêm a ordem em que estavam na lista.
+ * 
+ * Retorna:
+ *  - `true` se a lista for ordenada com sucesso.
+ *  - `false` se houver um erro durante a ordenação (exemplo: se a lista for `NULL`).
+ */
+bool llSort(LinkedList* list, orderFunc f);
+
+/**
+ * llSortCtx
+ * 
+ * Variante de `llSort` cuja função de comparação recebe o contexto `ctx` (ex.: critérios de ordenação).
+ * 
+ * Retorna:
+ *  - `true` se a lista for ordenada com sucesso, `false` se a lista ou a função forem `NULL`.
+ */
+bool llSortCtx(LinkedList* list, orderCtxFunc f, void* ctx);
+
+/**
+ * llDeepCopy
+ * 
+ * Realiza uma cópia profunda (deep copy) da lista encadeada (LinkedList* list) entre os índices fornecidos (int start, int end).
+ * 
+ * Retorna:
+ *  - Uma nova lista contendo uma cópia profunda dos elementos entre os índices fornecidos.
+ * 
+ * ATENÇÃO:
+ * - A cópia profunda não copia os ELEMENTOS TAMBÉM. Então, para liberar a memória de uma cópia utilize `llFullFree(copia, NULL)`.
+ * - Para apenas percorrer um trecho da lista (ex.: paginação) prefira `LLCursor`, que não aloca.
+ */
+LinkedList* llDeepCopy(LinkedList* list, int start, int end);
+
+/**
+ * llGetSize
+ * 
+ * Obtém o tamanho (número de elementos) da lista encadeada (LinkedList* list).
+ * 
+ * Retorna:
+ *  - O número de elementos na lista.
+ *  - `-1` caso `list` seja `NULL`.
+ */
+int llGetSize(LinkedList* list);
+
+/**
+ * llCursor
+ * 
+ * Cria um cursor posicionado no primeiro elemento da lista (fora da lista, se ela estiver vazia).
+ * 
+ * Retorna:
+ *  - O cursor.
+ */
+LLCursor llCursor(LinkedList* list);
+
+/**
+ * llCursorValid
+ * 
+ * Verifica se o cursor está sobre um elemento.
+ * 
+ * Retorna:
+ *  - `true` se o cursor aponta para um elemento, `false` se passou do fim/início ou a lista for `NULL`.
+ */
+bool llCursorValid(const LLCursor* cursor);
+
+/**
+ * llCursorGet
+ * 
+ * Obtém o elemento sob o cursor.
+ * 
+ * Retorna:
+ *  - O elemento, ou `NULL` se o cursor não estiver sobre um elemento.
+ */
+void* llCursorGet(const LLCursor* cursor);
+
+/**
+ * llCursorNext
+ * 
+ * Avança o cursor para o próximo elemento, em O(1).
+ * 
+ * Retorna:
+ *  - `true` se o cursor está sobre um elemento após avançar.
+ */
+bool llCursorNext(LLCursor* cursor);
+
+/**
+ * llCursorPrev
+ * 
+ * Volta o cursor para o elemento anterior, em O(1).
+ * 
+ * Retorna:
+ *  - `true` se o cursor está sobre um elemento após voltar.
+ */
+bool llCursorPrev(LLCursor* cursor);
+
+/**
+ * llCursorSeek
+ * 
+ * Posiciona o cursor no índice informado partindo do ponto mais próximo entre a posição lembrada,
+ * o início e o fim da lista. Custo O(min(|index - atual|, index, tamanho - index)): páginas vizinhas
+ * custam O(tamanho da página), em qualquer ponto da lista.
+ * 
+ * Retorna:
+ *  - `true` se o índice é válido (o cursor fica sobre o elemento).
+ *  - `false` caso contrário (o cursor não é alterado).
+ */
+bool llCursorSeek(LLCursor* cursor, int index);
+
+/**
+ * llCursorForeach
+ * 
+ * Executa `f` para até `count` elementos a partir da posição do cursor, sem alocar e sem mover o cursor.
+ * 
+ * Retorna:
+ *  - A quantidade de elementos visitados.
+ */
+int llCursorForeach(const LLCursor* cursor, int count, foreachFunc f);
+
+/**
+ * llGetAllocStats
+ * 
+ * Obtém os contadores de alocação da thread atual: nós entregues (`nodes`) e blocos alocados com `malloc` (`chunks`).
+ * Os contadores só são mantidos quando compilado com `-DLINKED_LIST_STATS` (como em `make bench`).
+ * 
+ * Retorna:
+ *  - `true` se os contadores estão habilitados, `false` caso contrário (os valores recebem `0`).
+ */
+bool llGetAllocStats(long* nodes, long* chunks);
+
+/**
+ * llResetAllocStats
+ * 
+ * Zera os contadores de alocação das listas da thread atual.
+ */
+void llResetAllocStats();
+
+/**
+ * llRemoveFirstFound
+ * 
+ * Remove o primeiro elemento da lista encadeada (LinkedList* list) que satisfaça a condição definida pela função `removeFunc f`.
+ * 
+ * Retorna:
+ *  - `true` se um elemento foi removido com sucesso.
+ *  - `false` se nenhum elemento foi encontrado ou removido.
+ */
+bool llRemoveFirstFound(LinkedList* list, removeFunc f);
+
+/**
+ * llRemoveFirstFoundCtx
+ * 
+ * Variante de `llRemoveFirstFound` cuja condição recebe o contexto `ctx`.
+ * 
+ * Retorna:
+ *  - `true` se um elemento foi removido, `false` caso contrário.
+ */
+bool llRemoveFirstFoundCtx(LinkedList* list, removeCtxFunc f, void* ctx);
+
+/**
+ * llRemoveNode
+ * 
+ * Remove da lista encadeada (LinkedList* list) o nó informado (LLNode* node) em O(1).
+ * O elemento armazenado NÃO é liberado.
+ * 
+ * ATENÇÃO:
+ *  - O nó deve pertencer à lista; após a remoção ele não pode mais ser utilizado.
+ * 
+ * Retorna:
+ *  - `true` se o nó foi removido.
+ *  - `false` se `list` ou `node` forem `NULL`.
+ */
+bool llRemoveNode(LinkedList* list, LLNode* node);
+
+#endif
@@ -0,0 +1,113 @@
+#ifndef COLUMNS_H
+#define COLUMNS_H 0
+
+#include <stdint.h>
+
+#include "../../shared/bool.h"
+#include "./repo.h"
+
+/*
+    Armazenamento colunar (structure of arrays) das partidas.
+
+    Opcional (`make STORE=columns`, que define `PARTIDA_COLUMNS`): além dos objetos `Partida`,
+    o banco mantém cada campo em um vetor próprio, com inteiros estreitos. As agregações
+    (estatísticas dos times) percorrem esses vetores em sequência, sem seguir ponteiros de
+    nó -> partida -> time, e o resultado de cada partida é calculado com SSE2 quando disponível.
+    Os acessores `partidaGet*` continuam lendo os objetos, que seguem sendo a fonte da verdade.
+
+    As linhas não têm ordem: a remoção move a última linha para o buraco (O(1)).
+    Partidas que não cabem nos tipos estreitos desativam o armazenamento (ver `partidaColumnsFits`).
+*/
+
+// Maiores valores representáveis nas colunas de time e de gols
+#define PARTIDA_COLUMNS_MAX_TIME UINT16_MAX
+#define PARTIDA_COLUMNS_MAX_GOLS UINT8_MAX
+
+// Capacidade inicial das colunas
+#define PARTIDA_COLUMNS_INITIAL_CAPACITY 1024
+
+// Quantidade de partidas processadas por bloco na agregação (cabe na cache L1)
+#define PARTIDA_COLUMNS_BLOCK 1024
+
+// Colunas das partidas: a linha `i` de cada vetor pertence à mesma partida
+typedef struct {
+    int32_t* id;       // ID da partida
+    uint16_t* t1;      // ID do time 1 (mandante)
+    uint16_t* t2;      // ID do time 2 (visitante)
+    uint8_t* golsT1;   // Gols do time 1
+    uint8_t* golsT2;   // Gols do time 2
+    int count;         // Quantidade de linhas ocupadas
+    int capacity;      // Quantidade de linhas alocadas
+} PartidaColumns;
+
+/**
+ * partidaColumnsFits
+ * 
+ * Verifica se os times e os gols de uma partida cabem nos tipos estreitos das colunas.
+ * 
+ * Retorna:
+ *  - `true` se a partida pode ser armazenada.
+ *  - `false` se algum valor é negativo ou maior que `PARTIDA_COLUMNS_MAX_TIME`/`PARTIDA_COLUMNS_MAX_GOLS`.
+ */
+bool partidaColumnsFits(int t1, int t2, int golsT1, int golsT2);
+
+/**
+ * partidaColumnsAppend
+ * 
+ * Adiciona uma partida ao final das colunas, dobrando a capacidade quando necessário.
+ * 
+ * Retorna:
+ *  - A linha da nova partida.
+ *  - `-1` se a partida não cabe nas colunas ou faltou memória (nada é alterado).
+ */
+int partidaColumnsAppend(PartidaColumns* c, int id, int t1, int t2, int golsT1, int golsT2);
+
+/**
+ * partidaColumnsRemoveAt
+ * 
+ * Remove a linha `row`, movendo a última linha para o seu lugar.
+ * 
+ * Retorna:
+ *  - `true` se outra linha foi movida para `row` (ela estava em `c->count`, já decrementado).
+ *  - `false` se `row` era a última linha (ou é inválida).
+ */
+bool partidaColumnsRemoveAt(PartidaColumns* c, int row);
+
+/**
+ * partidaColumnsSetGols
+ * 
+ * Troca os gols da linha `row`.
+ * 
+ * Retorna:
+ *  - `true` se os gols foram gravados.
+ *  - `false` se `row` é inválida ou os gols não cabem na coluna.
+ */
+bool partidaColumnsSetGols(PartidaColumns* c, int row, int golsT1, int golsT2);
+
+/**
+ * partidaColumnsEstatisticas
+ * 
+ * Soma às estatísticas (vitórias, empates, derrotas e gols) o resultado de todas as partidas,
+ * em blocos de `PARTIDA_COLUMNS_BLOCK`: primeiro o resultado de cada partida é calculado sobre as
+ * colunas de gols, 16 partidas por vez com SSE2 (laço escalar sem desvios nas demais
+ * arquiteturas), depois os totais são acumulados por time.
+ * 
+ * Parâmetros:
+ *  - `c`: Colunas das partidas.
+ *  - `stats`: Vetor indexado pelo ID do time; deve cobrir todos os times das colunas.
+ *  - `n`: Quantidade de posições de `stats`.
+ * 
+ * Retorna:
+ *  - `true` se as estatísticas foram somadas.
+ *  - `false` se faltou memória (`stats` não é alterado).
+ */
+bool partidaColumnsEstatisticas(const PartidaColumns* c, TimeEstatisticas* stats, int n);
+
+/**
+ * partidaColumnsFree
+ * 
+ * Libera as colunas, deixando-as vazias (podem ser reutilizadas).
+ */
+void partidaColumnsFree(PartidaColumns* c);
+
+#endif
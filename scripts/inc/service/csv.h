@@ -0,0 +1,137 @@
+#ifndef CSV_H
+#define CSV_H 0
+
+#include <stddef.h>
+
+#include "../../shared/bool.h"
+
+/*
+    Leitor de CSV em fluxo, compartilhado pelos bancos de times e de partidas.
+
+    O arquivo é lido em blocos grandes (`CSV_BUFFER_SIZE`) e cada linha é separada em campos
+    no próprio buffer, sem cópias e sem `sscanf`. Não há limite de tamanho de linha: uma linha
+    maior que o buffer faz o buffer crescer. Linhas em branco são ignoradas e um `\r` antes
+    do `\n` é descartado. Aspas não são tratadas (os campos dos bancos não contêm o separador).
+
+    Os erros de conversão indicam linha e coluna (ambas a partir de 1), ver `csvGetError`.
+*/
+
+// Tamanho inicial do buffer de leitura
+#define CSV_BUFFER_SIZE (1 << 20)
+
+// Leitor de CSV
+typedef struct CsvReader CsvReader;
+
+/**
+ * csvOpen
+ * 
+ * Abre o arquivo `path` para leitura com o separador `sep`.
+ * 
+ * Retorna:
+ *  - Um novo leitor, ou `NULL` se o arquivo não puder ser aberto ou faltar memória.
+ */
+CsvReader* csvOpen(const char* path, char sep);
+
+/**
+ * csvOpenMemory
+ * 
+ * Cria um leitor sobre um bloco de `len` bytes já em memória (ex.: um trecho de um arquivo
+ * mapeado), sem copiá-lo. O bloco não é alterado e deve continuar válido até `csvClose`.
+ * Os números de linha contam a partir do início do bloco (ver `csvSetRowBase`).
+ * 
+ * Retorna:
+ *  - Um novo leitor, ou `NULL` se faltar memória.
+ */
+CsvReader* csvOpenMemory(const char* data, size_t len, char sep);
+
+/**
+ * csvNextRow
+ * 
+ * Avança para a próxima linha não vazia, separando seus campos. Os campos da linha anterior
+ * deixam de ser válidos.
+ * 
+ * Retorna:
+ *  - `true` se há uma nova linha.
+ *  - `false` no fim do arquivo ou em caso de erro (ver `csvGetError`).
+ */
+bool csvNextRow(CsvReader* r);
+
+/**
+ * csvGetRow
+ * 
+ * Retorna:
+ *  - O número (a partir de 1, contando as linhas em branco) da linha atual, somado a `csvSetRowBase`.
+ */
+long csvGetRow(CsvReader* r);
+
+/**
+ * csvSetRowBase
+ * 
+ * Informa quantas linhas do arquivo vêm antes do bloco lido por `csvOpenMemory`, para que
+ * `csvGetRow` e as mensagens de erro usem a numeração do arquivo inteiro. Pode ser chamada
+ * depois de um erro (ex.: contando as linhas anteriores só quando necessário).
+ */
+void csvSetRowBase(CsvReader* r, long rows);
+
+/**
+ * csvGetFieldCount
+ * 
+ * Retorna:
+ *  - A quantidade de campos da linha atual.
+ */
+int csvGetFieldCount(CsvReader* r);
+
+/**
+ * csvGetField
+ * 
+ * Obtém o campo `col` (a partir de 0) da linha atual, sem cópia e sem terminador.
+ * 
+ * Parâmetros:
+ *  - `len`: Saída com o tamanho do campo.
+ * 
+ * Retorna:
+ *  - O início do campo, ou `NULL` se a linha não tem essa coluna.
+ */
+const char* csvGetField(CsvReader* r, int col, int* len);
+
+/**
+ * csvGetInt
+ * 
+ * Converte o campo `col` em inteiro (sinal opcional e dígitos decimais, sem estouro).
+ * 
+ * Retorna:
+ *  - `true` se o campo existe e é um inteiro válido.
+ *  - `false` caso contrário (a mensagem com linha e coluna fica em `csvGetError`).
+ */
+bool csvGetInt(CsvReader* r, int col, int* out);
+
+/**
+ * csvGetString
+ * 
+ * Copia o campo `col` para `out`, terminado em `'\0'`.
+ * 
+ * Parâmetros:
+ *  - `size`: Tamanho de `out`, incluindo o terminador.
+ * 
+ * Retorna:
+ *  - `true` se o campo existe e cabe em `out`.
+ *  - `false` caso contrário (a mensagem com linha e coluna fica em `csvGetError`).
+ */
+bool csvGetString(CsvReader* r, int col, char* out, int size);
+
+/**
+ * csvGetError
+ * 
+ * Retorna:
+ *  - A descrição do último erro (com linha e coluna, quando se aplica), ou `NULL` se não houve erro.
+ */
+const char* csvGetError(CsvReader* r);
+
+/**
+ * csvClose
+ * 
+ * Fecha o arquivo e libera o leitor.
+ */
+void csvClose(CsvReader* r);
+
+#endif
@@ -1,311 +1,778 @@
-#ifndef REPO_H
-#define REPO_H 0
-
-#include "./model.h"
-#include "../collections/LinkedList.h"
-
-// Definição de caminho para os arquivos CSV de acordo com o sistema operacional
-#if defined(_WIN32) || defined(_WIN64)
-    #define PARTIDA_CSV "FILE_PATH.csv"
-    #define TIME_CSV "FILE_PATH.csv"
-#else
-    #define PARTIDA_CSV "FILE_PATH.csv"
-    #define TIME_CSV "FILE_PATH.csv"
-#endif
-
-// Padrões de formato para leitura de CSV (para os arquivos de Time e Partida)
-#define TIME_CSV_PATTERN "%d;%[^,\n]"
-#define PARTIDA_CSV_PATTERN "%d;%d;%d;%d;%d"
-
-// Definição da estrutura TimeDB, que representa o banco de dados de times
-typedef struct TimeDB TimeDB;
-
-/**
- * timeDBStarted
- * 
- * Verifica se o banco de dados de times foi iniciado com sucesso.
- * 
- * Retorna:
- *  - `true` se o banco de dados de times foi iniciado.
- *  - `false` caso contrário.
- */
-bool timeDBStarted();
-
-/**
- * addTime
- * 
- * Adiciona um novo time ao banco de dados de times.
- * 
- * Parâmetros:
- *  - `time_name`: Nome do time a ser adicionado, com comprimento máximo de `TIME_MAX_NAME_SIZE`.
- * 
- * Retorna:
- *  - `true` se o time foi adicionado com sucesso.
- *  - `false` caso ocorra algum erro.
- */
-bool addTime(const char time_name[TIME_MAX_NAME_SIZE]);
-
-/**
- * checkPrefix
- * 
- * Verifica se um time no banco de dados possui um prefixo correspondente.
- * 
- * Parâmetros:
- *  - `time`: Ponteiro para o time a ser verificado.
- * 
- * Retorna:
- *  - `true` se o prefixo do time corresponde.
- *  - `false` caso contrário.
- */
-bool checkPrefix(void* time);
-
-/**
- * setPrefix
- * 
- * Define o prefixo que será usado para identificar os times no banco de dados.
- * 
- * Parâmetros:
- *  - `prefix`: O prefixo a ser configurado, com comprimento máximo de `TIME_MAX_NAME_SIZE`.
- * 
- * Retorna:
- *  - Nenhum valor é retornado. O prefixo é definido para os times.
- */
-void setPrefix(const char prefix[TIME_MAX_NAME_SIZE]);
-
-/**
- * searchByPrefix
- * 
- * Realiza uma busca por times no banco de dados com um prefixo específico.
- * 
- * Parâmetros:
- *  - `prefix`: O prefixo a ser usado para a busca, com comprimento máximo de `TIME_MAX_NAME_SIZE`.
- * 
- * Retorna:
- *  - Uma lista (`LinkedList`) contendo todos os times que correspondem ao prefixo especificado.
- */
-LinkedList* searchByPrefix(const char prefix[TIME_MAX_NAME_SIZE]);
-
-/**
- * startTimeDB
- * 
- * Inicia o banco de dados de times, configurando a estrutura necessária.
- * 
- * Retorna:
- *  - `true` se o banco de dados de times foi iniciado com sucesso.
- *  - `false` caso ocorra algum erro durante a inicialização.
- */
-bool startTimeDB();
-
-/**
- * timeDBGetByID
- * 
- * Obtém um time do banco de dados pelo seu ID.
- * 
- * Parâmetros:
- *  - `id`: O ID do time a ser recuperado.
- * 
- * Retorna:
- *  - Um ponteiro para o time correspondente ao ID, ou `NULL` caso o time não seja encontrado.
- */
-Time* timeDBGetByID(int id);
-
-// Definição da estrutura PartidaDB, que representa o banco de dados de partidas
-typedef struct PartidaDB PartidaDB;
-
-/**
- * partidaDBStartInsertTransaction
- * 
- * Inicia uma transação de inserção no banco de dados de partidas.
- * 
- * Retorna:
- *  - `true` se a transação de inserção foi iniciada com sucesso.
- *  - `false` caso ocorra um erro.
- */
-bool partidaDBStartInsertTransaction();
-
-/**
- * partidaDBInsertCommit
- * 
- * Realiza o commit (confirmação) da transação de inserção no banco de dados de partidas.
- * 
- * Retorna:
- *  - `true` se a transação de inserção foi confirmada com sucesso.
- *  - `false` caso ocorra um erro.
- */
-bool partidaDBInsertCommit();
-
-/**
- * partidaDBInsertRollBack
- * 
- * Desfaz (rollback) a transação de inserção no banco de dados de partidas.
- * 
- * Retorna:
- *  - `true` se a transação de inserção foi desfeita com sucesso.
- *  - `false` caso ocorra um erro.
- */
-void partidaDBInsertRollBack();
-
-typedef enum {PARTIDA_DATABASE_NOT_STARTED_YET, ANOTHER_TRANSACTION_NOT_CLOSE, MEMORY_NOT_ENOUGH_EXCEPTION, TIME_1_EQUALS_TIME_2, TIME_1_DOES_NOT_EXISTS, TIME_2_DOES_NOT_EXISTS, SUCCESS} AddPartidaReponse;
-
-/**
- * addPartida
- * 
- * Adiciona uma nova partida ao banco de dados de partidas.
- * 
- * Parâmetros:
- *  - `t1ID`: ID do primeiro time da partida.
- *  - `t2ID`: ID do segundo time da partida.
- *  - `gT1`: Número de gols marcados pelo primeiro time.
- *  - `gT2`: Número de gols marcados pelo segundo time.
- * 
- * Retorna:
- *  - Um valor do tipo `AddPartidaReponse`, indicando o status da operação.
- *    - `PARTIDA_DATABASE_NOT_STARTED_YET`: Banco de dados de partidas não iniciado.
- *    - `ANOTHER_TRANSACTION_NOT_CLOSE`: Outra transação não foi fechada.
- *    - `MEMORY_NOT_ENOUGH_EXCEPTION`: Falta de memória para a operação.
- *    - `TIME_1_EQUALS_TIME_2`: Os times da partida são iguais.
- *    - `TIME_1_DOES_NOT_EXISTS`: O primeiro time não existe.
- *    - `TIME_2_DOES_NOT_EXISTS`: O segundo time não existe.
- *    - `SUCCESS`: A partida foi adicionada com sucesso.
- */
-AddPartidaReponse addPartida(int t1ID, int t2ID, int gT1, int gT2);
-
-/**
- * startPartidaDB
- * 
- * Inicia o banco de dados de partidas, configurando a estrutura necessária.
- * 
- * Retorna:
- *  - `true` se o banco de dados de partidas foi iniciado com sucesso.
- *  - `false` caso ocorra um erro durante a inicialização.
- */
-bool startPartidaDB();
-
-/**
- * partidaDBMandantePrefixCheck
- * 
- * Verifica se a partida possui um prefixo correspondente ao do time mandante.
- * 
- * Parâmetros:
- *  - `partida`: Ponteiro para a instância de `Partida`.
- * 
- * Retorna:
- *  - `true` se o prefixo do time mandante corresponde.
- *  - `false` caso contrário.
- */
-bool partidaDBMandantePrefixCheck(void* partida);
-
-/**
- * partidaDBSearchMandante
- * 
- * Realiza uma busca por partidas onde o time mandante tem o nome que começa com o prefixo especificado.
- * 
- * Parâmetros:
- *  - `timeName`: Nome do time mandante, com comprimento máximo de `TIME_MAX_NAME_SIZE`.
- * 
- * Retorna:
- *  - Uma lista (`LinkedList`) contendo todas as partidas onde o time mandante corresponde ao prefixo.
- */
-LinkedList* partidaDBSearchMandante(char timeName[TIME_MAX_NAME_SIZE]);
-
-/**
- * partidaDBVisitantePrefixCheck
- * 
- * Verifica se a partida possui um prefixo correspondente ao do time visitante.
- * 
- * Parâmetros:
- *  - `partida`: Ponteiro para a instância de `Partida`.
- * 
- * Retorna:
- *  - `true` se o prefixo do time visitante corresponde.
- *  - `false` caso contrário.
- */
-bool partidaDBVisitantePrefixCheck(void* partida);
-
-/**
- * partidaDBSearchVisitante
- * 
- * Realiza uma busca por partidas onde o time visitante tem o nome que começa com o prefixo especificado.
- * 
- * Parâmetros:
- *  - `timeName`: Nome do time visitante, com comprimento máximo de `TIME_MAX_NAME_SIZE`.
- * 
- * Retorna:
- *  - Uma lista (`LinkedList`) contendo todas as partidas onde o time visitante corresponde ao prefixo.
- */
-LinkedList* partidaDBSearchVisitante(char timeName[TIME_MAX_NAME_SIZE]);
-
-/**
- * partidaDBMandanteOrVisitantePrefixCheck
- * 
- * Verifica se a partida possui um prefixo correspondente ao do time mandante ou visitante.
- * 
- * Parâmetros:
- *  - `partida`: Ponteiro para a instância de `Partida`.
- * 
- * Retorna:
- *  - `true` se o prefixo corresponde a qualquer time (mandante ou visitante).
- *  - `false` caso contrário.
- */
-bool partidaDBMandanteOrVisitantePrefixCheck(void* partida);
-
-/**
- * partidaDBSearchMandanteOrVisitante
- * 
- * Realiza uma busca por partidas onde o nome do time mandante ou visitante começa com o prefixo especificado.
- * 
- * Parâmetros:
- *  - `timeName`: Nome do time (mandante ou visitante), com comprimento máximo de `TIME_MAX_NAME_SIZE`.
- * 
- * Retorna:
- *  - Uma lista (`LinkedList`) contendo todas as partidas que correspondem ao prefixo.
- */
-LinkedList* partidaDBSearchMandanteOrVisitante(char timeName[TIME_MAX_NAME_SIZE]);
-
-/**
- * partidaDBGetById
- * 
- * Obtém uma partida pelo seu ID.
- * 
- * Parâmetros:
- *  - `id`: ID da partida a ser recuperada.
- * 
- * Retorna:
- *  - Um ponteiro para a partida correspondente ao ID, ou `NULL` caso a partida não seja encontrada.
- */
-Partida* partidaDBGetById(int id);
-
-/**
- * printPartida
- * 
- * Exibe as informações de uma partida no formato legível.
- * 
- * Parâmetros:
- *  - `p`: Ponteiro para a instância de `Partida`.
- * 
- * Retorna:
- *  - Nenhum valor é retornado. A partida é impressa na saída padrão.
- */
-void printPartida(Partida* p);
-
-/**
- * partidaDBGetAllPartidas
- * 
- * Retorna uma lista de todas as partidas do banco de dados.
- * 
- * Retorna:
- *  - Uma lista (`LinkedList`) contendo todas as partidas.
- */
-LinkedList* partidaDBGetAllPartidas();
-
-/**
- * timeDBGetAllTimes
- * 
- * Retorna uma lista de todos os times do banco de dados.
- * 
- * Retorna:
- *  - Uma lista (`LinkedList`) contendo todos os times.
- */
-LinkedList* timeDBGetAllTimes();
-
-#endif
+#ifndef REPO_H
+#define REPO_H 0
+
+#include "./model.h"
+#include "../collections/LinkedList.h"
+
+// Definição de caminho para os arquivos CSV de acordo com o sistema operacional
+#if defined(_WIN32) || defined(_WIN64)
+    #define PARTIDA_CSV "FILE_PATH.csv"
+    #define TIME_CSV "FILE_PATH.csv"
+#else
+    #define PARTIDA_CSV "FILE_PATH.csv"
+    #define TIME_CSV "FILE_PATH.csv"
+#endif
+
+// Separador de campos e padrões de gravação dos CSVs de Time e Partida (a leitura usa o leitor de csv.h)
+#define CSV_SEPARATOR ';'
+#define TIME_CSV_PATTERN "%d;%s"
+#define PARTIDA_CSV_PATTERN "%d;%d;%d;%d;%d"
+
+// Cabeçalhos gravados nos snapshots (checkpoint). O de partidas leva o `lsn` do log já incorporado.
+#define TIME_CSV_HEADER "ID;nome"
+#define PARTIDA_CSV_HEADER "ID;Time1;Time2;GolsTime1;GolsTime2"
+#define PARTIDA_CSV_LSN_FIELD "LSN="
+#define PARTIDA_CSV_LSN_PATTERN ";" PARTIDA_CSV_LSN_FIELD "%llu"
+
+// Tamanho do log (em bytes) a partir do qual um checkpoint é feito automaticamente (~29 mil registros)
+#define PARTIDA_CHECKPOINT_WAL_BYTES (1024L * 1024L)
+
+// Maior ID de time aceito. Os IDs de time endereçam diretamente o índice por ID e os vetores de
+// estatísticas (ver `timeDBGetIdBound`); arquivos com IDs acima disso são recusados na carga.
+#define TIME_MAX_ID ((1 << 20) - 1)
+
+// Threads usadas na carga do CSV de partidas (`1` = leitura sequencial) e limite aceito
+#define PARTIDA_LOAD_THREADS 1
+#define PARTIDA_LOAD_MAX_THREADS 64
+
+// Tamanho mínimo (em bytes) do trecho do CSV entregue a cada thread da carga paralela
+#define PARTIDA_LOAD_MIN_CHUNK (256L * 1024L)
+
+// Busca aproximada ("você quis dizer") das views: um erro de digitação aceito a cada
+// `TIME_SUGESTOES_LETRAS_POR_ERRO` letras buscadas, até `TIME_SUGESTOES_MAX_DISTANCIA`, e quantidade de sugestões
+#define TIME_SUGESTOES_LETRAS_POR_ERRO 3
+#define TIME_SUGESTOES_MAX_DISTANCIA 2
+#define TIME_SUGESTOES_MAX 5
+
+/*
+    Concorrência
+
+    Os bancos de times e de partidas são protegidos por uma única trava de leitores/escritor
+    (ver RepoLock.c). Várias threads podem ler ao mesmo tempo; as alterações são feitas uma por vez.
+     - Leitura: as buscas, os `...GetById`/`...GetByID`, as listas completas, as estatísticas e as
+       exportações devolvem (ou percorrem) dados do próprio banco, então não travam nada sozinhas:
+       quem chama segura a trava de leitura (`repoReadLock` ... `repoReadUnlock`) enquanto usa o resultado.
+       Essas funções nunca alteram o banco (o que fica pendente é refeito pelos escritores).
+     - Escrita: `addTime`, `addPartida`/`partidaDBTransacaoAdicionar`, o commit, `partidaDBRemove`,
+       `partidaDBAtualizarGols` e `partidaDBCheckpoint` pegam a trava sozinhas (a de escrita; a criação
+       da partida em transação e o checkpoint, a de leitura). A trava não é recursiva: elas não podem
+       ser chamadas por quem já segura a trava.
+     - Leituras longas (tabela de classificação): fixam uma versão das estatísticas com
+       `partidaDBVersaoFixar` e a percorrem sem trava nenhuma, enquanto os escritores seguem
+       gravando em versões novas.
+     - Inserções: cada thread ou sessão usa a sua `PartidaTransacao`; as funções sem o parâmetro
+       usam uma transação própria de cada thread.
+     - Iniciar e encerrar os bancos (`start...`, `stopPartidaDB`) e `partidaDBSetCheckpointThreshold`/
+       `partidaDBSetLoadThreads` não são seguros com outras threads usando os bancos.
+    Programas com uma thread só podem ignorar a trava de leitura.
+*/
+
+/**
+ * repoReadLock
+ * 
+ * Pega a trava de leitura dos bancos, compartilhada com as outras threads que estão lendo.
+ * Deve ser solta com `repoReadUnlock` pela mesma thread, sem chamar funções que alteram os bancos antes.
+ */
+void repoReadLock();
+
+/**
+ * repoReadUnlock
+ * 
+ * Solta a trava de leitura pega com `repoReadLock`. Ponteiros obtidos dos bancos não devem ser usados depois.
+ */
+void repoReadUnlock();
+
+/**
+ * repoWriteLock
+ * 
+ * Pega a trava de escrita dos bancos, esperando os leitores em andamento. Usada pelas funções que
+ * alteram os bancos e por quem precisa de exclusividade sobre eles (como o `partidaWALFlush` do servidor).
+ */
+void repoWriteLock();
+
+/**
+ * repoWriteUnlock
+ * 
+ * Solta a trava de escrita pega com `repoWriteLock`.
+ */
+void repoWriteUnlock();
+
+// Definição da estrutura TimeDB, que representa o banco de dados de times
+typedef struct TimeDB TimeDB;
+
+// Modo de comparação das buscas por prefixo (de times e de partidas)
+typedef enum {
+    BUSCA_EXATA,        // Compara os bytes do nome
+    BUSCA_NORMALIZADA   // Ignora maiúsculas/minúsculas e acentos (ver `timeNormalizeName`)
+} TipoBusca;
+
+/**
+ * timeDBStarted
+ * 
+ * Verifica se o banco de dados de times foi iniciado com sucesso.
+ * 
+ * Retorna:
+ *  - `true` se o banco de dados de times foi iniciado.
+ *  - `false` caso contrário.
+ */
+bool timeDBStarted();
+
+/**
+ * addTime
+ * 
+ * Adiciona um novo time ao banco de dados de times (com a trava de escrita).
+ * 
+ * Parâmetros:
+ *  - `time_name`: Nome do time a ser adicionado, com comprimento máximo de `TIME_MAX_NAME_SIZE`.
+ * 
+ * Retorna:
+ *  - `true` se o time foi adicionado com sucesso.
+ *  - `false` caso ocorra algum erro (inclusive se o próximo ID passaria de `TIME_MAX_ID`).
+ */
+bool addTime(const char time_name[TIME_MAX_NAME_SIZE]);
+
+/**
+ * checkPrefix
+ * 
+ * Verifica se um time no banco de dados possui um prefixo correspondente (uma `searchCtxFunc`).
+ * 
+ * Parâmetros:
+ *  - `time`: Ponteiro para o time a ser verificado.
+ *  - `prefix`: Prefixo buscado (`const char*`), com comprimento máximo de `TIME_MAX_NAME_SIZE`.
+ * 
+ * Retorna:
+ *  - `true` se o prefixo do time corresponde.
+ *  - `false` caso contrário.
+ */
+bool checkPrefix(void* time, void* prefix);
+
+/**
+ * checkNormalizedPrefix
+ * 
+ * Variante de `checkPrefix` que compara o nome normalizado do time (uma `searchCtxFunc`).
+ * 
+ * Parâmetros:
+ *  - `time`: Ponteiro para o time a ser verificado.
+ *  - `prefix`: Prefixo buscado, já normalizado por `timeNormalizeName`.
+ * 
+ * Retorna:
+ *  - `true` se o nome normalizado do time começa com o prefixo.
+ *  - `false` caso contrário.
+ */
+bool checkNormalizedPrefix(void* time, void* prefix);
+
+/**
+ * searchByPrefix
+ * 
+ * Realiza uma busca por times no banco de dados com um prefixo específico.
+ * 
+ * Parâmetros:
+ *  - `prefix`: O prefixo a ser usado para a busca, com comprimento máximo de `TIME_MAX_NAME_SIZE`.
+ *  - `tipo`: `BUSCA_EXATA` ou `BUSCA_NORMALIZADA`; as duas usam o mesmo tipo de índice.
+ * 
+ * Retorna:
+ *  - Uma lista (`LinkedList`) contendo todos os times que correspondem ao prefixo especificado.
+ */
+LinkedList* searchByPrefix(const char prefix[TIME_MAX_NAME_SIZE], TipoBusca tipo);
+
+/**
+ * searchBySubstring
+ * 
+ * Realiza uma busca por times cujo nome contém a substring em qualquer posição ("Corpi" encontra
+ * "ESCorpioes"). Consultas com 3 bytes ou mais usam o índice de trigramas dos nomes (intersecção das
+ * listas de cada trigrama), mantido na carga e em `addTime`.
+ * 
+ * Parâmetros:
+ *  - `sub`: A substring buscada, com comprimento máximo de `TIME_MAX_NAME_SIZE`.
+ *  - `tipo`: `BUSCA_EXATA` ou `BUSCA_NORMALIZADA`.
+ * 
+ * Retorna:
+ *  - Uma lista (`LinkedList`) com os times encontrados, na ordem da coleção.
+ *  - `NULL` se o banco de times não foi iniciado ou faltou memória.
+ */
+LinkedList* searchBySubstring(const char sub[TIME_MAX_NAME_SIZE], TipoBusca tipo);
+
+/**
+ * searchBySimilarName
+ * 
+ * Busca aproximada ("você quis dizer"): times cujo nome, sem diferenciar maiúsculas/minúsculas nem
+ * acentos, está a no máximo `maxDistancia` erros de digitação do nome buscado (inserção, remoção,
+ * troca de um caractere ou de dois vizinhos).
+ * 
+ * Parâmetros:
+ *  - `nome`: Nome buscado, com comprimento máximo de `TIME_MAX_NAME_SIZE`.
+ *  - `maxDistancia`: Quantidade máxima de erros.
+ *  - `maxResultados`: Quantidade máxima de times devolvidos.
+ * 
+ * Retorna:
+ *  - Uma lista (`LinkedList`) com os times mais parecidos primeiro (menos erros; depois o tamanho mais
+ *    próximo do buscado; depois a ordem da coleção).
+ *  - `NULL` se o banco de times não foi iniciado ou faltou memória.
+ */
+LinkedList* searchBySimilarName(const char nome[TIME_MAX_NAME_SIZE], int maxDistancia, int maxResultados);
+
+/**
+ * timeDBForeachPrefix
+ * 
+ * Chama `f(time, ctx)` para cada time cujo nome começa com o prefixo, usando o índice de prefixo
+ * (nomes ordenados, mantido na carga e em `addTime`): O(log times + k), sem montar lista. A ordem
+ * das chamadas é a dos nomes (exatos ou normalizados, conforme `tipo`), não a da coleção.
+ * 
+ * Retorna:
+ *  - `true` se a busca foi feita.
+ *  - `false` se o banco de times não foi iniciado ou `f` é `NULL`.
+ */
+bool timeDBForeachPrefix(const char prefix[TIME_MAX_NAME_SIZE], TipoBusca tipo, foreachCtxFunc f, void* ctx);
+
+/**
+ * startTimeDB
+ * 
+ * Inicia o banco de dados de times, configurando a estrutura necessária.
+ * 
+ * Retorna:
+ *  - `true` se o banco de dados de times foi iniciado com sucesso.
+ *  - `false` caso ocorra algum erro durante a inicialização.
+ */
+bool startTimeDB();
+
+/**
+ * startTimeDBFromFile
+ * 
+ * Igual a `startTimeDB`, mas lendo os times do arquivo informado: CSV ou snapshot binário
+ * (ver snapshot.h), reconhecido pelo conteúdo.
+ * 
+ * Retorna:
+ *  - `true` se o banco de dados de times foi iniciado com sucesso.
+ *  - `false` caso ocorra algum erro durante a inicialização.
+ */
+bool startTimeDBFromFile(const char* path);
+
+/**
+ * timeDBCheckpoint
+ * 
+ * Regrava de forma atômica (arquivo temporário + `rename`) o CSV de onde os times foram carregados
+ * com o estado atual do banco.
+ * 
+ * Retorna:
+ *  - `true` se o snapshot foi gravado.
+ *  - `false` se o banco não foi iniciado ou a gravação falhou (o CSV anterior continua intacto).
+ */
+bool timeDBCheckpoint();
+
+/**
+ * timeDBExport
+ * 
+ * Grava os times em `path` de forma atômica, em CSV ou no snapshot binário (ver snapshot.h).
+ * Usada pelo checkpoint e pelo conversor `snapconv`.
+ * 
+ * Retorna:
+ *  - `true` se o arquivo foi gravado.
+ *  - `false` se o banco não foi iniciado ou a gravação falhou.
+ */
+bool timeDBExport(const char* path, bool binario);
+
+/**
+ * timeDBGetByID
+ * 
+ * Obtém um time do banco de dados pelo seu ID.
+ * 
+ * Parâmetros:
+ *  - `id`: O ID do time a ser recuperado.
+ * 
+ * Retorna:
+ *  - Um ponteiro para o time correspondente ao ID, ou `NULL` caso o time não seja encontrado.
+ */
+Time* timeDBGetByID(int id);
+
+/**
+ * timeDBGetIdBound
+ * 
+ * Obtém o limite superior (exclusivo) dos IDs de times cadastrados.
+ * Vetores indexados por ID de time devem ter pelo menos esse tamanho (nunca mais que `TIME_MAX_ID + 1`).
+ * 
+ * Retorna:
+ *  - O maior ID de time cadastrado + 1, ou `0` se não houver times.
+ */
+int timeDBGetIdBound();
+
+// Definição da estrutura PartidaDB, que representa o banco de dados de partidas
+typedef struct PartidaDB PartidaDB;
+
+/*
+    Transação de inserção de uma partida: `partidaDBTransacaoAdicionar` cria a partida (validando os
+    times) sem mexer no banco, e `partidaDBTransacaoCommit` a registra no log e a adiciona, ou
+    `partidaDBTransacaoRollBack` a descarta. Cada thread ou sessão usa a sua; deve começar zerada
+    (`PartidaTransacao tx = {NULL};`).
+*/
+typedef struct {
+    Partida* partida;  // Partida em transação (`NULL` = nenhuma). O ID é provisório até o commit.
+} PartidaTransacao;
+
+/**
+ * partidaDBStartInsertTransaction
+ * 
+ * Inicia uma transação de inserção no banco de dados de partidas (a transação da thread).
+ * 
+ * Retorna:
+ *  - `true` se a transação de inserção foi iniciada com sucesso.
+ *  - `false` caso ocorra um erro.
+ */
+bool partidaDBStartInsertTransaction();
+
+/**
+ * partidaDBInsertCommit
+ * 
+ * Realiza o commit (confirmação) da transação de inserção da thread (ver `partidaDBTransacaoCommit`).
+ * 
+ * Retorna:
+ *  - `true` se a transação de inserção foi confirmada com sucesso.
+ *  - `false` caso ocorra um erro.
+ */
+bool partidaDBInsertCommit();
+
+/**
+ * partidaDBInsertRollBack
+ * 
+ * Desfaz (rollback) a transação de inserção da thread.
+ * 
+ * Retorna:
+ *  - `true` se a transação de inserção foi desfeita com sucesso.
+ *  - `false` caso ocorra um erro.
+ */
+void partidaDBInsertRollBack();
+
+typedef enum {PARTIDA_DATABASE_NOT_STARTED_YET, ANOTHER_TRANSACTION_NOT_CLOSE, MEMORY_NOT_ENOUGH_EXCEPTION, TIME_1_EQUALS_TIME_2, TIME_1_DOES_NOT_EXISTS, TIME_2_DOES_NOT_EXISTS, SUCCESS} AddPartidaReponse;
+
+/**
+ * addPartida
+ * 
+ * Adiciona uma nova partida ao banco de dados de partidas.
+ * 
+ * Parâmetros:
+ *  - `t1ID`: ID do primeiro time da partida.
+ *  - `t2ID`: ID do segundo time da partida.
+ *  - `gT1`: Número de gols marcados pelo primeiro time.
+ *  - `gT2`: Número de gols marcados pelo segundo time.
+ * 
+ * Retorna:
+ *  - Um valor do tipo `AddPartidaReponse`, indicando o status da operação.
+ *    - `PARTIDA_DATABASE_NOT_STARTED_YET`: Banco de dados de partidas não iniciado.
+ *    - `ANOTHER_TRANSACTION_NOT_CLOSE`: Outra transação não foi fechada.
+ *    - `MEMORY_NOT_ENOUGH_EXCEPTION`: Falta de memória para a operação.
+ *    - `TIME_1_EQUALS_TIME_2`: Os times da partida são iguais.
+ *    - `TIME_1_DOES_NOT_EXISTS`: O primeiro time não existe.
+ *    - `TIME_2_DOES_NOT_EXISTS`: O segundo time não existe.
+ *    - `SUCCESS`: A partida foi adicionada com sucesso.
+ */
+AddPartidaReponse addPartida(int t1ID, int t2ID, int gT1, int gT2);
+
+/**
+ * partidaDBGetPartidaEmTransacao
+ * 
+ * Retorna:
+ *  - A partida da transação de inserção da thread (criada por `addPartida`), ou `NULL` se não houver.
+ */
+Partida* partidaDBGetPartidaEmTransacao();
+
+/**
+ * partidaDBTransacaoAdicionar
+ * 
+ * Igual a `addPartida`, mas na transação `tx`. Pega a trava de leitura para validar os times.
+ * O ID da partida é só uma prévia: o definitivo é escolhido no commit.
+ * 
+ * Retorna:
+ *  - Os mesmos valores de `addPartida` (`ANOTHER_TRANSACTION_NOT_CLOSE` se `tx` já tem uma partida).
+ */
+AddPartidaReponse partidaDBTransacaoAdicionar(PartidaTransacao* tx, int t1ID, int t2ID, int gT1, int gT2);
+
+/**
+ * partidaDBTransacaoCommit
+ * 
+ * Confirma a transação `tx` com a trava de escrita: escolhe o ID definitivo (o próximo livre naquele
+ * momento), registra a inserção no log e adiciona a partida ao banco, que passa a ser dono dela.
+ * 
+ * Parâmetros:
+ *  - `tx`: A transação.
+ *  - `id`: Saída com o ID definitivo da partida (pode ser `NULL`).
+ * 
+ * Retorna:
+ *  - `true` se a partida foi adicionada (`tx` fica vazia).
+ *  - `false` se não há partida em transação, o banco não foi iniciado ou a inserção falhou (`tx` continua aberta).
+ */
+bool partidaDBTransacaoCommit(PartidaTransacao* tx, int* id);
+
+/**
+ * partidaDBTransacaoRollBack
+ * 
+ * Descarta a partida da transação `tx`, se houver.
+ */
+void partidaDBTransacaoRollBack(PartidaTransacao* tx);
+
+/**
+ * startPartidaDB
+ * 
+ * Inicia o banco de dados de partidas, configurando a estrutura necessária.
+ * 
+ * Retorna:
+ *  - `true` se o banco de dados de partidas foi iniciado com sucesso.
+ *  - `false` caso ocorra um erro durante a inicialização.
+ */
+bool startPartidaDB();
+
+/**
+ * startPartidaDBFromFile
+ * 
+ * Igual a `startPartidaDB`, mas lendo as partidas do arquivo informado: CSV ou snapshot binário
+ * (ver snapshot.h), reconhecido pelo conteúdo. O log usado é `<path>.wal`.
+ * 
+ * Retorna:
+ *  - `true` se o banco de dados de partidas foi iniciado com sucesso.
+ *  - `false` caso ocorra um erro durante a inicialização.
+ */
+bool startPartidaDBFromFile(const char* path);
+
+/**
+ * stopPartidaDB
+ * 
+ * Encerra o banco de dados de partidas, garantindo que todas as alterações registradas no log
+ * (`<csv de partidas>.wal`) estejam gravadas em disco, e libera as partidas e os índices.
+ * Deve ser chamada antes de sair do programa; depois dela o banco pode ser iniciado de novo.
+ */
+void stopPartidaDB();
+
+/**
+ * partidaDBCheckpoint
+ * 
+ * Grava um snapshot dos bancos de times e de partidas (reescrevendo os CSVs de forma atômica)
+ * e trunca o log, de modo que a próxima inicialização carregue o snapshot e reaplique só o que
+ * vier depois. Também é chamada automaticamente quando o log passa do limite configurado.
+ * Pega a trava de leitura: as leituras continuam durante o checkpoint; as alterações esperam.
+ * 
+ * Retorna:
+ *  - `true` se o checkpoint foi concluído.
+ *  - `false` se o banco não foi iniciado ou alguma gravação falhou (o log é mantido).
+ */
+bool partidaDBCheckpoint();
+
+/**
+ * partidaDBExport
+ * 
+ * Grava as partidas em `path` de forma atômica, em CSV ou no snapshot binário (ver snapshot.h),
+ * marcadas com o `lsn` do último registro do log já aplicado. Usada pelo checkpoint e pelo
+ * conversor `snapconv`.
+ * 
+ * Retorna:
+ *  - `true` se o arquivo foi gravado.
+ *  - `false` se o banco não foi iniciado ou a gravação falhou.
+ */
+bool partidaDBExport(const char* path, bool binario);
+
+/**
+ * partidaDBSetCheckpointThreshold
+ * 
+ * Define o tamanho do log (em bytes) que dispara um checkpoint automático após uma alteração.
+ * O padrão é `PARTIDA_CHECKPOINT_WAL_BYTES`; `0` desliga o checkpoint automático.
+ */
+void partidaDBSetCheckpointThreshold(long bytes);
+
+/**
+ * partidaDBSetLoadThreads
+ * 
+ * Define quantas threads leem o CSV de partidas nas próximas cargas (`startPartidaDBFromFile`).
+ * Com mais de uma, o arquivo é mapeado em memória e dividido em trechos alinhados em linhas,
+ * lidos em paralelo e juntados em ordem de ID. Arquivos pequenos usam menos threads
+ * (ver `PARTIDA_LOAD_MIN_CHUNK`). O valor é limitado a `1 .. PARTIDA_LOAD_MAX_THREADS`.
+ */
+void partidaDBSetLoadThreads(int threads);
+
+/**
+ * partidaDBMandantePrefixCheck
+ * 
+ * Verifica se a partida possui um prefixo correspondente ao do time mandante (uma `searchCtxFunc`).
+ * 
+ * Parâmetros:
+ *  - `partida`: Ponteiro para a instância de `Partida`.
+ *  - `prefix`: Prefixo buscado (`const char*`).
+ * 
+ * Retorna:
+ *  - `true` se o prefixo do time mandante corresponde.
+ *  - `false` caso contrário.
+ */
+bool partidaDBMandantePrefixCheck(void* partida, void* prefix);
+
+/**
+ * partidaDBSearchMandante
+ * 
+ * Realiza uma busca por partidas onde o time mandante tem o nome que começa com o prefixo especificado.
+ * 
+ * Parâmetros:
+ *  - `timeName`: Nome do time mandante, com comprimento máximo de `TIME_MAX_NAME_SIZE`.
+ *  - `tipo`: `BUSCA_EXATA` ou `BUSCA_NORMALIZADA` (sem diferenciar maiúsculas/minúsculas nem acentos).
+ * 
+ * Retorna:
+ *  - Uma lista (`LinkedList`) contendo todas as partidas onde o time mandante corresponde ao prefixo.
+ */
+LinkedList* partidaDBSearchMandante(char timeName[TIME_MAX_NAME_SIZE], TipoBusca tipo);
+
+/**
+ * partidaDBVisitantePrefixCheck
+ * 
+ * Verifica se a partida possui um prefixo correspondente ao do time visitante (uma `searchCtxFunc`).
+ * 
+ * Parâmetros:
+ *  - `partida`: Ponteiro para a instância de `Partida`.
+ *  - `prefix`: Prefixo buscado (`const char*`).
+ * 
+ * Retorna:
+ *  - `true` se o prefixo do time visitante corresponde.
+ *  - `false` caso contrário.
+ */
+bool partidaDBVisitantePrefixCheck(void* partida, void* prefix);
+
+/**
+ * partidaDBSearchVisitante
+ * 
+ * Realiza uma busca por partidas onde o time visitante tem o nome que começa com o prefixo especificado.
+ * 
+ * Parâmetros:
+ *  - `timeName`: Nome do time visitante, com comprimento máximo de `TIME_MAX_NAME_SIZE`.
+ *  - `tipo`: `BUSCA_EXATA` ou `BUSCA_NORMALIZADA` (sem diferenciar maiúsculas/minúsculas nem acentos).
+ * 
+ * Retorna:
+ *  - Uma lista (`LinkedList`) contendo todas as partidas onde o time visitante corresponde ao prefixo.
+ */
+LinkedList* partidaDBSearchVisitante(char timeName[TIME_MAX_NAME_SIZE], TipoBusca tipo);
+
+/**
+ * partidaDBMandanteOrVisitantePrefixCheck
+ * 
+ * Verifica se a partida possui um prefixo correspondente ao do time mandante ou visitante (uma `searchCtxFunc`).
+ * 
+ * Parâmetros:
+ *  - `partida`: Ponteiro para a instância de `Partida`.
+ *  - `prefix`: Prefixo buscado (`const char*`).
+ * 
+ * Retorna:
+ *  - `true` se o prefixo corresponde a qualquer time (mandante ou visitante).
+ *  - `false` caso contrário.
+ */
+bool partidaDBMandanteOrVisitantePrefixCheck(void* partida, void* prefix);
+
+/**
+ * partidaDBSearchMandanteOrVisitante
+ * 
+ * Realiza uma busca por partidas onde o nome do time mandante ou visitante começa com o prefixo especificado.
+ * 
+ * Parâmetros:
+ *  - `timeName`: Nome do time (mandante ou visitante), com comprimento máximo de `TIME_MAX_NAME_SIZE`.
+ *  - `tipo`: `BUSCA_EXATA` ou `BUSCA_NORMALIZADA` (sem diferenciar maiúsculas/minúsculas nem acentos).
+ * 
+ * Retorna:
+ *  - Uma lista (`LinkedList`) contendo todas as partidas que correspondem ao prefixo.
+ */
+LinkedList* partidaDBSearchMandanteOrVisitante(char timeName[TIME_MAX_NAME_SIZE], TipoBusca tipo);
+
+/**
+ * partidaDBGetById
+ * 
+ * Obtém uma partida pelo seu ID.
+ * 
+ * Parâmetros:
+ *  - `id`: ID da partida a ser recuperada.
+ * 
+ * Retorna:
+ *  - Um ponteiro para a partida correspondente ao ID, ou `NULL` caso a partida não seja encontrada.
+ */
+Partida* partidaDBGetById(int id);
+
+/**
+ * partidaDBRemove
+ * 
+ * Remove uma partida do banco de dados pelo seu ID, liberando a memória da partida (com a trava de escrita).
+ * 
+ * Parâmetros:
+ *  - `id`: ID da partida a ser removida.
+ * 
+ * Retorna:
+ *  - `true` se a partida foi removida.
+ *  - `false` caso o banco não tenha sido iniciado ou a partida não exista.
+ */
+bool partidaDBRemove(int id);
+
+/**
+ * partidaDBAtualizarGols
+ * 
+ * Atualiza os gols de uma partida, mantendo as estatísticas dos times consistentes (com a trava de escrita).
+ * 
+ * Parâmetros:
+ *  - `id`: ID da partida a ser atualizada.
+ *  - `golsT1`: Novos gols do time 1 (mandante).
+ *  - `golsT2`: Novos gols do time 2 (visitante).
+ * 
+ * Retorna:
+ *  - `true` se a partida foi atualizada.
+ *  - `false` se a partida não existe ou algum valor de gols é negativo.
+ */
+bool partidaDBAtualizarGols(int id, int golsT1, int golsT2);
+
+// Estatísticas agregadas de um time, calculadas a partir das partidas
+typedef struct {
+    int vitorias;  // Quantidade de vitórias
+    int empates;   // Quantidade de empates
+    int derrotas;  // Quantidade de derrotas
+    int gm;        // Gols marcados
+    int gs;        // Gols sofridos
+} TimeEstatisticas;
+
+/**
+ * partidaDBCalcularEstatisticas
+ * 
+ * Calcula as estatísticas de todos os times em uma única passagem sequencial pelas partidas.
+ * 
+ * Parâmetros:
+ *  - `count`: Saída com a quantidade de posições do vetor retornado (igual a `timeDBGetIdBound()`).
+ * 
+ * Retorna:
+ *  - Um vetor indexado pelo ID do time (`estatisticas[timeGetId(t)]`), que deve ser liberado com `free`.
+ *  - `NULL` se o banco não foi iniciado ou não houver memória suficiente.
+ */
+TimeEstatisticas* partidaDBCalcularEstatisticas(int* count);
+
+/**
+ * partidaDBGetEstatisticas
+ * 
+ * Obtém a tabela viva de estatísticas, mantida incrementalmente pelo banco de partidas
+ * (inserção, atualização de gols e remoção custam O(1) cada).
+ * 
+ * Parâmetros:
+ *  - `count`: Saída com a quantidade de posições da tabela. Times com ID a partir de `count`
+ *    (cadastrados depois da última alteração nas partidas) não têm partidas: tudo zerado.
+ * 
+ * Retorna:
+ *  - Um vetor indexado pelo ID do time. Pertence ao banco: NÃO deve ser liberado nem alterado,
+ *    e só é válido até a próxima alteração no banco (enquanto a trava de leitura estiver presa).
+ *  - `NULL` se o banco não foi iniciado ou não houver memória suficiente.
+ */
+const TimeEstatisticas* partidaDBGetEstatisticas(int* count);
+
+/**
+ * partidaDBVerificarEstatisticas
+ * 
+ * Autoverificação de depuração: compara a tabela viva com um recálculo completo.
+ * Compilando com `-DPARTIDA_DB_DEBUG`, ela é executada após cada alteração no banco.
+ * 
+ * Retorna:
+ *  - `true` se a tabela viva está consistente.
+ *  - `false` caso contrário.
+ */
+bool partidaDBVerificarEstatisticas();
+
+/*
+    Versões das estatísticas (leitura sem trava)
+
+    A tabela viva de estatísticas, junto com os times de cada ID, é versionada: cada alteração nas
+    partidas (ou time novo) cria uma versão de número maior. Um leitor fixa a versão atual e lê a
+    tabela e os times dela pelo tempo que quiser, sem trava, vendo sempre um estado consistente;
+    os escritores não esperam por ele. Se a versão estiver fixada, a alteração seguinte copia a
+    tabela (cópia na escrita, O(times)); se não, altera no lugar. Uma versão é liberada quando o
+    banco já passou para outra e o último leitor a solta.
+
+    Todas as versões devem ser soltas antes de `stopPartidaDB`/`stopTimeDB` (os times são liberados ali).
+*/
+typedef struct PartidaDBVersao PartidaDBVersao;
+
+/**
+ * partidaDBVersaoFixar
+ * 
+ * Fixa a versão atual das estatísticas. Pega a trava de leitura por um instante: não pode ser
+ * chamada por quem já a segura.
+ * 
+ * Retorna:
+ *  - A versão, que deve ser solta com `partidaDBVersaoSoltar`.
+ *  - `NULL` se o banco não foi iniciado ou não há tabela viva (falta de memória).
+ */
+PartidaDBVersao* partidaDBVersaoFixar();
+
+/**
+ * partidaDBVersaoEstatisticas
+ * 
+ * Obtém a tabela de estatísticas de uma versão fixada. Times com ID a partir de `count` não
+ * existiam na versão.
+ * 
+ * Parâmetros:
+ *  - `v`: Versão fixada.
+ *  - `count`: Saída com a quantidade de posições da tabela.
+ * 
+ * Retorna:
+ *  - Um vetor indexado pelo ID do time, válido (e imutável) até a versão ser solta.
+ */
+const TimeEstatisticas* partidaDBVersaoEstatisticas(const PartidaDBVersao* v, int* count);
+
+/**
+ * partidaDBVersaoTime
+ * 
+ * Obtém o time de um ID na versão fixada (IDs `0 .. count-1`, ver `partidaDBVersaoEstatisticas`).
+ * 
+ * Retorna:
+ *  - O time, válido até a versão ser solta, ou `NULL` se o ID não tinha time.
+ */
+Time* partidaDBVersaoTime(const PartidaDBVersao* v, int id);
+
+/**
+ * partidaDBVersaoNumero
+ * 
+ * Retorna o número da versão: leituras com o mesmo número viram o mesmo estado.
+ */
+unsigned long long partidaDBVersaoNumero(const PartidaDBVersao* v);
+
+/**
+ * partidaDBVersaoSoltar
+ * 
+ * Solta uma versão fixada, liberando-a se o banco já passou para outra e ninguém mais a fixou.
+ * Os ponteiros obtidos dela não devem ser usados depois.
+ */
+void partidaDBVersaoSoltar(PartidaDBVersao* v);
+
+/**
+ * partidaDBTimesAlterados
+ * 
+ * Avisa o banco de partidas que um time foi cadastrado (chamada por `addTime`, com a trava de escrita).
+ */
+void partidaDBTimesAlterados();
+
+/**
+ * printPartida
+ * 
+ * Exibe as informações de uma partida no formato legível.
+ * 
+ * Parâmetros:
+ *  - `p`: Ponteiro para a instância de `Partida`.
+ * 
+ * Retorna:
+ *  - Nenhum valor é retornado. A partida é impressa na saída padrão.
+ */
+void printPartida(Partida* p);
+
+/**
+ * partidaDBGetAllPartidas
+ * 
+ * Retorna uma lista de todas as partidas do banco de dados.
+ * 
+ * Retorna:
+ *  - Uma lista (`LinkedList`) contendo todas as partidas. Pertence ao banco e só é válida até a
+ *    próxima alteração nele.
+ */
+LinkedList* partidaDBGetAllPartidas();
+
+/**
+ * timeDBGetAllTimes
+ * 
+ * Retorna uma lista de todos os times do banco de dados.
+ * 
+ * Retorna:
+ *  - Uma lista (`LinkedList`) contendo todos os times. Pertence ao banco e só é válida até a
+ *    próxima alteração nele.
+ */
+LinkedList* timeDBGetAllTimes();
+
+#endif
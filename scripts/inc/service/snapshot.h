@@ -0,0 +1,180 @@
+#ifndef SNAPSHOT_H
+#define SNAPSHOT_H 0
+
+#include <stdio.h>
+#include <stddef.h>
+
+#include "../../shared/bool.h"
+
+/*
+    Gravação atômica de snapshots dos bancos.
+
+    O snapshot é escrito em `<path>.tmp`, sincronizado com `fsync` e só então renomeado por cima
+    de `path`. Uma queda durante a gravação deixa o arquivo anterior intacto: quem lê `path` vê
+    sempre o snapshot antigo inteiro ou o novo inteiro.
+
+    Além do CSV, os bancos aceitam um formato binário versionado, reconhecido pelo número mágico
+    no início do arquivo (o caminho em `repo.h` pode apontar para qualquer um dos dois):
+     - Cabeçalho (`SnapshotHeader`, 32 bytes): mágico, versão, tamanho do registro, quantidade de
+       registros, `lsn` do log já incorporado (só partidas) e CRC-32 dos registros.
+     - Registros de tamanho fixo (`SnapshotTime`, `SnapshotPartida`), na ordem de bytes da máquina.
+    O arquivo é lido com `mmap`, sem análise de texto: o CRC é conferido sobre o arquivo inteiro e
+    cada registro é copiado para um objeto do banco (`newTime`/`newPartida`), como na carga do CSV.
+    O mapeamento é desfeito ao fim da carga; os registros não são usados no próprio arquivo.
+*/
+
+// Extensão do arquivo temporário usado durante a gravação
+#define SNAPSHOT_TMP_EXTENSION ".tmp"
+
+// Identificação do formato binário
+#define SNAPSHOT_MAGIC_TIMES "TSNP"
+#define SNAPSHOT_MAGIC_PARTIDAS "PSNP"
+#define SNAPSHOT_VERSION 1
+
+// Espaço do nome no registro de time (nome + '\0', completado com zeros)
+#define SNAPSHOT_TIME_NAME_SIZE 12
+
+// Cabeçalho do snapshot binário
+typedef struct {
+    char magic[4];            // `SNAPSHOT_MAGIC_TIMES` ou `SNAPSHOT_MAGIC_PARTIDAS`
+    unsigned int version;     // `SNAPSHOT_VERSION`
+    unsigned int recordSize;  // `sizeof` do registro, conferido na leitura
+    unsigned int count;       // Quantidade de registros
+    unsigned long long lsn;   // `lsn` do último registro do log contido no snapshot (`0` para times)
+    unsigned int checksum;    // CRC-32 dos registros
+    unsigned int reserved;    // Zero (alinha o cabeçalho em 32 bytes)
+} SnapshotHeader;
+
+// Registro de time do snapshot binário (16 bytes)
+typedef struct {
+    int id;
+    char name[SNAPSHOT_TIME_NAME_SIZE];
+} SnapshotTime;
+
+// Registro de partida do snapshot binário (20 bytes)
+typedef struct {
+    int id;
+    int t1;
+    int t2;
+    int golsT1;
+    int golsT2;
+} SnapshotPartida;
+
+// Snapshot binário mapeado em memória (somente leitura)
+typedef struct {
+    const void* base;              // Início do mapeamento
+    size_t size;                   // Tamanho do mapeamento
+    const SnapshotHeader* header;  // Cabeçalho (no início do mapeamento)
+    const void* records;           // Primeiro registro (logo após o cabeçalho)
+} SnapshotMap;
+
+/**
+ * snapshotBegin
+ * 
+ * Abre o arquivo temporário de um novo snapshot de `path`.
+ * 
+ * Parâmetros:
+ *  - `path`: Caminho final do snapshot.
+ *  - `mode`: Modo de abertura (`"w"` para texto, `"wb"` para binário).
+ *  - `tmpPath`: Saída com o caminho do temporário, a ser repassado a `snapshotCommit`/`snapshotAbort`.
+ * 
+ * Retorna:
+ *  - O arquivo temporário aberto para escrita, ou `NULL` em caso de erro.
+ */
+FILE* snapshotBegin(const char* path, const char* mode, char** tmpPath);
+
+/**
+ * snapshotCommit
+ * 
+ * Sincroniza e fecha o temporário e o renomeia para `path`, substituindo o snapshot anterior.
+ * Em caso de erro, o temporário é removido e o snapshot anterior continua valendo.
+ * `tmpPath` é liberado em qualquer caso.
+ * 
+ * Retorna:
+ *  - `true` se o novo snapshot está no lugar (e em disco).
+ *  - `false` caso contrário.
+ */
+bool snapshotCommit(FILE* f, char* tmpPath, const char* path);
+
+/**
+ * snapshotAbort
+ * 
+ * Fecha e remove o temporário de um snapshot abandonado e libera `tmpPath`.
+ */
+void snapshotAbort(FILE* f, char* tmpPath);
+
+/**
+ * snapshotCrc32
+ * 
+ * Continua o CRC-32 (polinômio 0xEDB88320, o mesmo de zlib/PNG) `crc` sobre `n` bytes.
+ * Comece com `crc == 0`; o resultado de um trecho pode ser passado adiante para o próximo.
+ */
+unsigned int snapshotCrc32(unsigned int crc, const void* data, size_t n);
+
+/**
+ * snapshotIsBinary
+ * 
+ * Verifica se o arquivo em `path` começa com o número mágico `magic` de um snapshot binário.
+ * 
+ * Retorna:
+ *  - `true` se o arquivo existe e é um snapshot binário daquele tipo.
+ *  - `false` caso contrário (ex.: um CSV).
+ */
+bool snapshotIsBinary(const char* path, const char* magic);
+
+/**
+ * snapshotMapFile
+ * 
+ * Mapeia o arquivo `path` inteiro em memória, somente leitura, sem interpretar o conteúdo
+ * (usado também pela carga paralela do CSV de partidas).
+ * 
+ * Retorna:
+ *  - O início do mapeamento, com o tamanho em `size`, ou `NULL` em caso de erro ou arquivo vazio.
+ */
+const void* snapshotMapFile(const char* path, size_t* size);
+
+/**
+ * snapshotUnmapFile
+ * 
+ * Desfaz um mapeamento feito por `snapshotMapFile`.
+ */
+void snapshotUnmapFile(const void* base, size_t size);
+
+/**
+ * snapshotMapOpen
+ * 
+ * Mapeia em memória o snapshot binário em `path` e confere o cabeçalho (mágico, versão, tamanho
+ * do registro e tamanho do arquivo) e o CRC-32 dos registros.
+ * 
+ * Parâmetros:
+ *  - `path`: Caminho do snapshot.
+ *  - `magic`: Número mágico esperado.
+ *  - `recordSize`: Tamanho esperado de cada registro.
+ *  - `map`: Saída com o mapeamento.
+ * 
+ * Retorna:
+ *  - `true` se o snapshot foi mapeado e é válido (feche com `snapshotMapClose`).
+ *  - `false` se o arquivo não pôde ser mapeado ou está corrompido (nada fica mapeado).
+ */
+bool snapshotMapOpen(const char* path, const char* magic, unsigned int recordSize, SnapshotMap* map);
+
+/**
+ * snapshotMapClose
+ * 
+ * Desfaz o mapeamento de um snapshot aberto com `snapshotMapOpen`.
+ */
+void snapshotMapClose(SnapshotMap* map);
+
+/**
+ * snapshotWriteHeader
+ * 
+ * Grava o cabeçalho de um snapshot binário no início de `f` (antes dos registros na abertura,
+ * com `count == 0`, e de novo ao final com os valores definitivos).
+ * 
+ * Retorna:
+ *  - `true` se o cabeçalho foi gravado.
+ */
+bool snapshotWriteHeader(FILE* f, const char* magic, unsigned int recordSize, unsigned int count,
+                         unsigned long long lsn, unsigned int checksum);
+
+#endif
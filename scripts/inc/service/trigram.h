@@ -0,0 +1,100 @@
+#ifndef TRIGRAM_H
+#define TRIGRAM_H 0
+
+#include "../../shared/bool.h"
+
+/*
+    Índice invertido de trigramas dos nomes dos times.
+
+    Cada sequência de 3 bytes de um nome aponta para a lista das posições (slots do banco de times)
+    dos nomes que a contêm, em ordem crescente. Uma busca por substring intersecta as listas dos
+    trigramas da consulta: o resultado contém todos os nomes que têm a substring, mas pode trazer
+    nomes que só têm os trigramas fora de ordem, então o chamador confirma cada candidato.
+
+    As posições devem ser adicionadas em ordem crescente (o banco de times só acrescenta nomes).
+*/
+
+// Capacidade inicial da tabela de trigramas
+#define TRIGRAM_INDEX_INITIAL_CAPACITY 256
+
+// Lista de posições de um trigrama
+typedef struct {
+    int trigrama;     // Os 3 bytes do trigrama
+    int* posicoes;    // Posições dos nomes que contêm o trigrama, em ordem crescente (`NULL` = entrada livre)
+    int count;        // Quantidade de posições
+    int capacity;     // Quantidade de posições alocadas
+} TrigramPostings;
+
+// Tabela hash (endereçamento aberto) de trigrama -> lista de posições
+typedef struct {
+    TrigramPostings* tabela;  // Entradas da tabela
+    int capacity;             // Quantidade de entradas (sempre potência de 2)
+    int size;                 // Quantidade de entradas ocupadas
+} TrigramIndex;
+
+/**
+ * trigramIndexAdd
+ * 
+ * Adiciona todos os trigramas de um nome à lista da posição `pos`, que deve ser maior que as já
+ * adicionadas. Trigramas repetidos no mesmo nome entram uma vez.
+ * 
+ * Retorna:
+ *  - `true` se o nome foi indexado.
+ *  - `false` se faltou memória (o índice fica incompleto e deve ser descartado com `trigramIndexFree`).
+ */
+bool trigramIndexAdd(TrigramIndex* idx, int pos, const char* nome);
+
+/**
+ * trigramIndexSearch
+ * 
+ * Intersecta as listas de todos os trigramas da consulta, começando pela menor.
+ * 
+ * Parâmetros:
+ *  - `idx`: Índice de trigramas.
+ *  - `consulta`: Substring buscada, com pelo menos 3 bytes.
+ *  - `posicoes`: Recebe um vetor novo (liberar com `free`) com as posições candidatas, em ordem crescente.
+ *  - `count`: Recebe a quantidade de posições.
+ * 
+ * Retorna:
+ *  - `true` se a busca foi feita.
+ *  - `false` se a consulta tem menos de 3 bytes ou faltou memória.
+ */
+bool trigramIndexSearch(const TrigramIndex* idx, const char* consulta, int** posicoes, int* count);
+
+/**
+ * trigramIndexCandidates
+ * 
+ * Busca as posições dos nomes que têm pelo menos `minimo` trigramas distintos em comum com a consulta
+ * (filtro de candidatos da busca aproximada).
+ * 
+ * Parâmetros:
+ *  - `idx`: Índice de trigramas.
+ *  - `consulta`: Nome buscado.
+ *  - `minimo`: Quantidade mínima de trigramas em comum (pelo menos 1).
+ *  - `posicoes`: Recebe um vetor novo (liberar com `free`) com as posições, em ordem crescente.
+ *  - `count`: Recebe a quantidade de posições.
+ * 
+ * Retorna:
+ *  - `true` se a busca foi feita.
+ *  - `false` se `minimo` é menor que 1 ou faltou memória.
+ */
+bool trigramIndexCandidates(const TrigramIndex* idx, const char* consulta, int minimo, int** posicoes, int* count);
+
+/**
+ * trigramIndexDistinct
+ * 
+ * Conta os trigramas distintos de um nome.
+ * 
+ * Retorna:
+ *  - A quantidade de trigramas distintos (`0` para nomes com menos de 3 bytes).
+ */
+int trigramIndexDistinct(const char* nome);
+
+/**
+ * trigramIndexFree
+ * 
+ * Libera o índice, deixando-o vazio (pode ser reutilizado).
+ */
+void trigramIndexFree(TrigramIndex* idx);
+
+#endif
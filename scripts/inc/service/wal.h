@@ -0,0 +1,187 @@
+#ifndef WAL_H
+#define WAL_H 0
+
+#include "../../shared/bool.h"
+
+/*
+    Log de escrita antecipada (WAL) das partidas.
+
+    Cada alteração no banco de partidas (inserção, atualização de gols e remoção) é registrada
+    em um arquivo binário só de acréscimo (`<csv de partidas>.wal`) antes de ser aplicada em memória.
+    Ao iniciar, o banco carrega o CSV base e reaplica o log, recuperando as alterações feitas
+    nas execuções anteriores.
+
+    Formato:
+     - Cabeçalho: `PARTIDA_WAL_MAGIC` (4 bytes) + versão (uint32).
+     - Registros de tamanho fixo (`PARTIDA_WAL_RECORD_SIZE` bytes, ordem de bytes da máquina):
+       tipo (uint32), id, t1, t2, golsT1, golsT2 (int32), lsn (uint64) e CRC-32 dos bytes anteriores.
+       Um registro incompleto ou com CRC inválido no fim do arquivo (escrita interrompida) é descartado.
+
+    Commit em grupo: os registros ficam em um buffer e são gravados juntos, com um único `fsync`,
+    a cada `everyRecords` registros ou quando `intervalSeconds` segundos tiverem passado desde o
+    último `fsync` (ver `partidaWALSetSync`). Com `everyRecords == 1`, toda alteração já está em
+    disco quando a função do banco retorna; valores maiores trocam durabilidade por vazão.
+
+    Checkpoint: o banco grava um snapshot (o próprio CSV, reescrito de forma atômica) marcado com
+    o `lsn` do último registro que ele contém e então trunca o log. Na inicialização, registros com
+    `lsn` até essa marca são ignorados, de modo que uma queda entre a troca do CSV e o truncamento
+    não reaplica alterações duas vezes.
+*/
+
+#define PARTIDA_WAL_MAGIC "PWAL"
+#define PARTIDA_WAL_VERSION 1
+#define PARTIDA_WAL_HEADER_SIZE 8
+#define PARTIDA_WAL_RECORD_SIZE 36
+
+// Extensão acrescentada ao caminho do CSV de partidas para formar o caminho do log
+#define PARTIDA_WAL_EXTENSION ".wal"
+
+// Política padrão de `fsync`: a cada registro, sem intervalo
+#define PARTIDA_WAL_SYNC_EVERY 1
+#define PARTIDA_WAL_SYNC_INTERVAL 0
+
+// Tipo de um registro do log
+typedef enum {PARTIDA_WAL_INSERT = 1, PARTIDA_WAL_UPDATE = 2, PARTIDA_WAL_DELETE = 3} PartidaWALTipo;
+
+// Registro do log (forma em memória)
+typedef struct {
+    PartidaWALTipo tipo;
+    int id;                  // ID da partida
+    int t1;                  // ID do time mandante (inserção)
+    int t2;                  // ID do time visitante (inserção)
+    int golsT1;              // Gols do mandante (inserção e atualização)
+    int golsT2;              // Gols do visitante (inserção e atualização)
+    unsigned long long lsn;  // Número de sequência do registro (crescente, atribuído pelo log)
+} PartidaWALRegistro;
+
+/**
+ * partidaWALApplyFunc
+ * 
+ * Função chamada para cada registro válido durante a reaplicação do log.
+ * 
+ * Retorna:
+ *  - `true` se o registro foi aplicado, `false` se foi ignorado (ex.: partida inexistente);
+ *    registros ignorados são reportados em `stderr`.
+ */
+typedef bool (*partidaWALApplyFunc)(const PartidaWALRegistro* r, void* ctx);
+
+/**
+ * partidaWALOpen
+ * 
+ * Abre (ou cria) o log em `path`, reaplica com `apply` os registros válidos posteriores a `baseLsn`
+ * e deixa o arquivo pronto para novos registros. Um final de arquivo incompleto ou corrompido é truncado.
+ * 
+ * Parâmetros:
+ *  - `path`: Caminho do arquivo de log.
+ *  - `baseLsn`: `lsn` já coberto pelo snapshot carregado; registros até ele são ignorados.
+ *  - `apply`: Função chamada para cada registro (pode ser `NULL`).
+ *  - `ctx`: Contexto repassado a `apply`.
+ *  - `aplicados`: Saída opcional com a quantidade de registros aplicados.
+ * 
+ * Retorna:
+ *  - `true` se o log foi aberto.
+ *  - `false` se o arquivo não pôde ser aberto/criado ou tem um cabeçalho inválido.
+ */
+bool partidaWALOpen(const char* path, unsigned long long baseLsn, partidaWALApplyFunc apply, void* ctx, int* aplicados);
+
+/**
+ * partidaWALIsOpen
+ * 
+ * Retorna:
+ *  - `true` se há um log aberto para novos registros.
+ */
+bool partidaWALIsOpen();
+
+/**
+ * partidaWALAppend
+ * 
+ * Acrescenta um registro ao log, atribuindo seu `lsn`. Segundo a política de `fsync`, o registro
+ * pode ficar no buffer até o próximo commit em grupo.
+ * 
+ * Retorna:
+ *  - `true` se o registro foi aceito (e gravado, quando a política exige).
+ *  - `false` se o log não está aberto ou a gravação falhou. Nesse caso o registro é desfeito
+ *    (nem o buffer nem o arquivo ficam com ele, e o `lsn` é reaproveitado), então a alteração
+ *    não deve ser aplicada.
+ */
+bool partidaWALAppend(PartidaWALRegistro* r);
+
+/**
+ * partidaWALFlush
+ * 
+ * Grava os registros do buffer no arquivo e, se `sync` for `true`, força-os para o disco com `fsync`.
+ * Em caso de falha nada se perde: os registros ficam no buffer (ou no arquivo, se só o `fsync`
+ * falhou) para a próxima tentativa.
+ * 
+ * Retorna:
+ *  - `true` se a operação foi bem-sucedida (ou não havia log aberto).
+ */
+bool partidaWALFlush(bool sync);
+
+/**
+ * partidaWALTruncate
+ * 
+ * Esvazia o log (inclusive o buffer) após um checkpoint, cujo snapshot já contém todos os
+ * registros. Os próximos registros continuam a sequência de `lsn`.
+ * 
+ * Retorna:
+ *  - `true` se o log foi truncado e sincronizado.
+ *  - `false` se o log não está aberto ou a operação falhou.
+ */
+bool partidaWALTruncate();
+
+/**
+ * partidaWALClose
+ * 
+ * Grava os registros pendentes (com `fsync`) e fecha o log.
+ */
+void partidaWALClose();
+
+/**
+ * partidaWALSetSync
+ * 
+ * Configura o commit em grupo: `fsync` a cada `everyRecords` registros (mínimo 1) ou quando
+ * `intervalSeconds` segundos tiverem passado desde o último `fsync` (`0` desliga o intervalo).
+ * O intervalo é verificado a cada novo registro; quem fica muito tempo sem registrar nada deve
+ * acompanhar o prazo com `partidaWALSyncPrazoMs` e chamar `partidaWALFlush` quando ele vencer.
+ */
+void partidaWALSetSync(int everyRecords, int intervalSeconds);
+
+/**
+ * partidaWALSyncPrazoMs
+ * 
+ * Prazo do commit em grupo pelo intervalo de `partidaWALSetSync` (o tempo tem resolução de segundos).
+ * Lê o estado do log: quem chama segura a trava dos bancos (ver repo.h).
+ * 
+ * Retorna:
+ *  - Os milissegundos que faltam até os registros não sincronizados precisarem de `fsync`.
+ *  - `0` se o prazo já venceu.
+ *  - `-1` se não há registros pendentes ou o intervalo está desligado.
+ */
+long partidaWALSyncPrazoMs();
+
+/**
+ * partidaWALGetSize
+ * 
+ * Retorna:
+ *  - O tamanho do log em bytes, incluindo os registros ainda no buffer (`0` se não houver log aberto).
+ */
+long partidaWALGetSize();
+
+/**
+ * partidaWALGetLastLsn
+ * 
+ * Retorna:
+ *  - O `lsn` do último registro aceito pelo log (`0` se nenhum), usado para marcar um snapshot.
+ */
+unsigned long long partidaWALGetLastLsn();
+
+/**
+ * partidaWALGetSyncCount
+ * 
+ * Retorna:
+ *  - Quantos `fsync` o log fez desde que foi aberto (útil para medir o commit em grupo).
+ */
+long partidaWALGetSyncCount();
+
+#endif
@@ -0,0 +1,118 @@
+#ifndef RENDER_H
+#define RENDER_H 0
+
+#include <stdio.h>
+#include <stddef.h>
+#include "../../shared/bool.h"
+
+/*
+    Renderizador das listagens das views (times, partidas e tabela de classificação).
+
+    As linhas são formatadas em um buffer que cresce conforme a necessidade (inteiros formatados à mão,
+    sem `printf`) e gravadas no arquivo de saída em blocos de pelo menos `RENDER_FLUSH_BYTES` bytes.
+    O mesmo conjunto de colunas é escrito em três formatos:
+     - `FORMATO_TEXTO`: colunas alinhadas separadas por ` | `, com cabeçalho e linha de traços.
+     - `FORMATO_CSV`: separado por `;` (como os CSVs do banco), com a linha de cabeçalho.
+     - `FORMATO_JSON`: um vetor de objetos, um por linha, com os nomes das colunas como chaves.
+
+    Uso:
+        Renderer r;
+        renderBegin(&r, stdout, formato, colunas, nColunas);
+        para cada linha: renderInt / renderString / renderChar (uma vez por coluna, na ordem) e renderEndRow
+        renderEnd(&r);
+*/
+
+// Capacidade inicial do buffer de saída
+#define RENDER_INITIAL_CAPACITY 4096
+
+// Quantidade de bytes acumulados a partir da qual o buffer é gravado no arquivo
+#define RENDER_FLUSH_BYTES (64 * 1024)
+
+// Formatos de saída
+typedef enum {
+    FORMATO_TEXTO,
+    FORMATO_CSV,
+    FORMATO_JSON
+} FormatoSaida;
+
+// Coluna de uma listagem
+typedef struct {
+    const char* nome;    // Chave no JSON e cabeçalho no CSV (um identificador: vai sem escapes no JSON)
+    const char* titulo;  // Cabeçalho no texto
+    int largura;         // Largura mínima no texto (negativa = alinhada à esquerda, como no `printf`)
+} RenderColuna;
+
+// Estado de uma listagem em andamento
+typedef struct {
+    FILE* saida;                 // Arquivo de saída
+    FormatoSaida formato;        // Formato da listagem
+    const RenderColuna* colunas; // Colunas (o vetor deve existir até `renderEnd`)
+    int nColunas;                // Quantidade de colunas
+    int coluna;                  // Próxima coluna da linha atual
+    int linhas;                  // Linhas já terminadas
+    size_t folga;                // Espaço reservado para o separador (e a chave, no JSON) de um valor
+    char* buffer;                // Bytes ainda não gravados
+    size_t size;                 // Quantidade de bytes no buffer
+    size_t capacity;             // Tamanho alocado do buffer
+    bool erro;                   // Faltou memória ou a gravação falhou (o resto da listagem é descartado)
+} Renderer;
+
+/**
+ * renderParseFormato
+ * 
+ * Converte o nome de um formato (`texto`, `csv` ou `json`).
+ * 
+ * Retorna:
+ *  - `true` se o nome é válido (o formato é gravado em `formato`).
+ */
+bool renderParseFormato(const char* nome, FormatoSaida* formato);
+
+/**
+ * renderBegin
+ * 
+ * Inicia uma listagem e escreve o cabeçalho do formato.
+ * 
+ * Retorna:
+ *  - `true` se a listagem foi iniciada, `false` se faltou memória.
+ */
+bool renderBegin(Renderer* r, FILE* saida, FormatoSaida formato, const RenderColuna* colunas, int nColunas);
+
+/**
+ * renderInt
+ * 
+ * Escreve um inteiro na próxima coluna da linha atual.
+ */
+void renderInt(Renderer* r, long long valor);
+
+/**
+ * renderString
+ * 
+ * Escreve um texto na próxima coluna da linha atual (com as aspas e escapes do CSV e do JSON).
+ */
+void renderString(Renderer* r, const char* valor);
+
+/**
+ * renderChar
+ * 
+ * Escreve um único caractere na próxima coluna da linha atual (um texto de tamanho 1 no CSV e no JSON).
+ */
+void renderChar(Renderer* r, char valor);
+
+/**
+ * renderEndRow
+ * 
+ * Termina a linha atual, gravando o buffer no arquivo se ele passou de `RENDER_FLUSH_BYTES`.
+ */
+void renderEndRow(Renderer* r);
+
+/**
+ * renderEnd
+ * 
+ * Fecha a listagem (o `]` do JSON), grava o que restou no buffer e o libera.
+ * 
+ * Retorna:
+ *  - `true` se toda a listagem foi gravada, `false` se faltou memória ou a gravação falhou.
+ */
+bool renderEnd(Renderer* r);
+
+#endif
@@ -1,59 +1,113 @@
-#ifndef VIEW_H
-#define VIEW_H 0
-
-/**
- * viewBuscarTimesPorPrefixo
- * 
- * Exibe a interface para o usuário buscar times no banco de dados através de um prefixo.
- * O usuário fornecerá um prefixo e a função exibirá os times correspondentes.
- */
-void viewBuscarTimesPorPrefixo();
-
-/**
- * viewBuscarPartidas
- * 
- * Exibe a interface para o usuário buscar partidas no banco de dados.
- * O usuário poderá buscar partidas e a função exibirá os resultados correspondentes.
- */
-void viewBuscarPartidas();
-
-/**
- * viewAtualizarPartida
- * 
- * Exibe a interface para o usuário atualizar os dados de uma partida existente no banco de dados.
- * O usuário poderá alterar os gols ou times da partida.
- */
-void viewAtualizarPartida();
-
-/**
- * viewExcluirPartida
- * 
- * Exibe a interface para o usuário excluir uma partida do banco de dados.
- * O usuário fornecerá um identificador de partida e a função excluirá a partida correspondente.
- */
-void viewExcluirPartida();
-
-/**
- * viewInserirPartida
- * 
- * Exibe a interface para o usuário inserir uma nova partida no banco de dados.
- * O usuário fornecerá os dados da partida (times e gols) e a função adicionará a partida ao banco.
- */
-void viewInserirPartida();
-
-/**
- * viewTabelaClassificacao
- * 
- * Exibe a tabela de classificação atualizada dos times no torneio, com base nas partidas já realizadas.
- * A função calculará a classificação com base nos pontos e exibe a tabela na interface.
- */
-void viewTabelaClassificacao();
-
-/**
- * viewMenuPrincipal
- * 
- * Exibe o menu principal da interface, permitindo ao usuário escolher a ação desejada, como buscar times, buscar partidas, atualizar, excluir ou inserir partidas, entre outras.
- */
-char viewMenuPrincipal();
-
-#endif
+#ifndef VIEW_H
+#define VIEW_H 0
+
+#include <stdio.h>
+#include "./render.h"
+
+/**
+ * viewSetFormatoSaida
+ * 
+ * Define o formato (texto, CSV ou JSON) das listagens de times, de partidas e da tabela de
+ * classificação. Fora do formato texto, a tabela de classificação é emitida inteira, sem paginação.
+ */
+void viewSetFormatoSaida(FormatoSaida formato);
+
+/**
+ * viewBuscarTimesPorPrefixo
+ * 
+ * Exibe a interface para o usuário buscar times no banco de dados através de um prefixo.
+ * O usuário fornecerá um prefixo e a função exibirá os times correspondentes.
+ */
+void viewBuscarTimesPorPrefixo();
+
+/**
+ * viewBuscarPartidas
+ * 
+ * Exibe a interface para o usuário buscar partidas no banco de dados.
+ * O usuário poderá buscar partidas e a função exibirá os resultados correspondentes.
+ */
+void viewBuscarPartidas();
+
+/**
+ * viewAtualizarPartida
+ * 
+ * Exibe a interface para o usuário atualizar os dados de uma partida existente no banco de dados.
+ * O usuário poderá alterar os gols ou times da partida.
+ */
+void viewAtualizarPartida();
+
+/**
+ * viewExcluirPartida
+ * 
+ * Exibe a interface para o usuário excluir uma partida do banco de dados.
+ * O usuário fornecerá um identificador de partida e a função excluirá a partida correspondente.
+ */
+void viewExcluirPartida();
+
+/**
+ * viewInserirPartida
+ * 
+ * Exibe a interface para o usuário inserir uma nova partida no banco de dados.
+ * O usuário fornecerá os dados da partida (times e gols) e a função adicionará a partida ao banco.
+ */
+void viewInserirPartida();
+
+/**
+ * viewTabelaClassificacao
+ * 
+ * Exibe a tabela de classificação atualizada dos times no torneio, com base nas partidas já realizadas.
+ * A função calculará a classificação com base nos pontos e exibe a tabela na interface.
+ */
+void viewTabelaClassificacao();
+
+/**
+ * viewCheckpoint
+ * 
+ * Grava o estado atual dos times e das partidas nos CSVs e esvazia o log de alterações,
+ * informando ao usuário se a operação deu certo.
+ */
+void viewCheckpoint();
+
+/**
+ * viewExecutarComandos
+ * 
+ * Modo de comandos: lê uma linha por comando de `entrada`, sem menus nem confirmações, e grava uma
+ * linha de resposta por comando em `saida` (`OK ...` ou `ERR <motivo>`). Comandos:
+ *  - `insert <time1> <time2> <gols1> <gols2>`
+ *  - `update <id> <gols1|-> <gols2|->` (`-` mantém os gols atuais)
+ *  - `delete <id>`
+ *  - `get <id>`
+ *  - `search <mandante|visitante|ambos|time> <prefixo>`
+ *  - `table [n] [inicio] [versao]` (a resposta `OK <k> <versao>` é seguida de uma linha por time, a partir da
+ *    posição `inicio`; `versao` é o número da versão das estatísticas usada, ver repo.h. Passando o número
+ *    de uma resposta anterior, a página vem da mesma classificação, ou `ERR versao expirada` se ela já
+ *    saiu das últimas versões retidas)
+ *  - `checkpoint`
+ * Linhas vazias e linhas começando com `#` são ignoradas.
+ * 
+ * Retorna:
+ *  - A quantidade de comandos que falharam.
+ */
+int viewExecutarComandos(FILE* entrada, FILE* saida);
+
+/**
+ * viewServidor
+ * 
+ * Modo servidor: carrega os bancos uma vez e atende os comandos de `viewExecutarComandos`, com as
+ * mesmas respostas, de vários clientes ao mesmo tempo por um socket Unix em `caminho`. Um único laço
+ * de eventos (epoll) atende todas as conexões; cada cliente pode enviar vários comandos sem esperar
+ * as respostas, que chegam na ordem. Termina com SIGINT ou SIGTERM.
+ * 
+ * Retorna:
+ *  - `true` se o servidor foi iniciado e encerrado normalmente.
+ */
+bool viewServidor(const char* caminho);
+
+/**
+ * viewMenuPrincipal
+ * 
+ * Exibe o menu principal da interface, permitindo ao usuário escolher a ação desejada, como buscar times, buscar partidas, atualizar, excluir ou inserir partidas, entre outras.
+ */
+char viewMenuPrincipal();
+
+#endif
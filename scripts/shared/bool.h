@@ -1,6 +1,6 @@
-#ifndef BOOL_H
-#define BOOL_H 0
-
-typedef enum {false, true} bool;
-
+#ifndef BOOL_H
+#define BOOL_H 0
+
+typedef enum {false, true} bool;
+
 #endif
\ No newline at end of file
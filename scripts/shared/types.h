@@ -1,108 +1,183 @@
-#ifndef SHARED_TYPES_H
-#define SHARED_TYPES_H 0
-
-#include "./bool.h"
-
-// Definição de tipos de função para operações genéricas em listas e outros elementos
-
-/**
- * searchFunc
- * 
- * Tipo de função utilizado para definir uma condição de busca em elementos.
- * A função retorna `true` se o elemento corresponder ao critério de busca, e `false` caso contrário.
- * 
- * Parâmetros:
- *  - `void*`: Um ponteiro para o elemento a ser verificado.
- * 
- * Retorna:
- *  - `true` se o elemento corresponde à condição de busca.
- *  - `false` caso contrário.
- */
-typedef bool (*searchFunc)(void*);
-
-/**
- * freeFunc
- * 
- * Tipo de função utilizado para liberar a memória de um elemento.
- * A função deve liberar qualquer memória alocada para o elemento passado como parâmetro.
- * 
- * Parâmetros:
- *  - `void*`: Um ponteiro para o elemento a ser liberado.
- * 
- * Retorna:
- *  - Nenhum valor é retornado. A função é responsável apenas por desalocar a memória.
- */
-typedef void(*freeFunc)(void*);
-
-/**
- * foreachFunc
- * 
- * Tipo de função utilizado para realizar uma operação em cada elemento de uma lista ou coleção.
- * A função é chamada para cada elemento, permitindo a execução de ações específicas.
- * 
- * Parâmetros:
- *  - `void*`: Um ponteiro para o elemento em que a operação será realizada.
- * 
- * Retorna:
- *  - Nenhum valor é retornado. A função pode realizar ações sobre o elemento, como modificações ou exibição.
- */
-typedef void(*foreachFunc)(void*);
-
-/**
- * findFirstFunc
- * 
- * Tipo de função utilizado para verificar se um elemento atende a um critério específico e deve ser retornado primeiro.
- * A função retorna `true` se o elemento atender ao critério e `false` caso contrário.
- * 
- * Parâmetros:
- *  - `void*`: Um ponteiro para o elemento a ser verificado.
- * 
- * Retorna:
- *  - `true` se o elemento atende ao critério.
- *  - `false` caso contrário.
- */
-typedef bool(*findFirstFunc)(void*);
-
-/**
- * removeFunc
- * 
- * Tipo de função utilizado para determinar se um elemento deve ser removido de uma coleção.
- * A função retorna `true` se o elemento deve ser removido e `false` caso contrário.
- * 
- * Parâmetros:
- *  - `void*`: Um ponteiro para o elemento a ser verificado.
- * 
- * Retorna:
- *  - `true` se o elemento deve ser removido.
- *  - `false` caso contrário.
- */
-typedef bool(*removeFunc)(void*);
-
-// Definição do tipo de enumeração `Order`, utilizado para comparar elementos
-
-/**
- * Order
- * 
- * Enumeração utilizada para representar o resultado de uma comparação entre dois elementos.
- * O valor `less_than` indica que o primeiro elemento é menor que o segundo, `equal` indica que são iguais, e `greater_than` indica que o primeiro elemento é maior que o segundo.
- */
-typedef enum {less_than=-1, equal, greater_than} Order;
-
-/**
- * orderFunc
- * 
- * Tipo de função utilizado para comparar dois elementos de acordo com um critério específico.
- * A função deve retornar um valor do tipo `Order`, indicando o resultado da comparação.
- * 
- * Parâmetros:
- *  - `a`: Um ponteiro para o primeiro elemento a ser comparado.
- *  - `b`: Um ponteiro para o segundo elemento a ser comparado.
- * 
- * Retorna:
- *  - `less_than` se o primeiro elemento é menor que o segundo.
- *  - `equal` se os dois elementos são iguais.
- *  - `greater_than` se o primeiro elemento é maior que o segundo.
- */
-typedef Order(*orderFunc)(void* a, void* b);
-
-#endif
+#ifndef SHARED_TYPES_H
+#define SHARED_TYPES_H 0
+
+#include "./bool.h"
+
+// Definição de tipos de função para operações genéricas em listas e outros elementos
+
+/**
+ * searchFunc
+ * 
+ * Tipo de função utilizado para definir uma condição de busca em elementos.
+ * A função retorna `true` se o elemento corresponder ao critério de busca, e `false` caso contrário.
+ * 
+ * Parâmetros:
+ *  - `void*`: Um ponteiro para o elemento a ser verificado.
+ * 
+ * Retorna:
+ *  - `true` se o elemento corresponde à condição de busca.
+ *  - `false` caso contrário.
+ */
+typedef bool (*searchFunc)(void*);
+
+/**
+ * freeFunc
+ * 
+ * Tipo de função utilizado para liberar a memória de um elemento.
+ * A função deve liberar qualquer memória alocada para o elemento passado como parâmetro.
+ * 
+ * Parâmetros:
+ *  - `void*`: Um ponteiro para o elemento a ser liberado.
+ * 
+ * Retorna:
+ *  - Nenhum valor é retornado. A função é responsável apenas por desalocar a memória.
+ */
+typedef void(*freeFunc)(void*);
+
+/**
+ * foreachFunc
+ * 
+ * Tipo de função utilizado para realizar uma operação em cada elemento de uma lista ou coleção.
+ * A função é chamada para cada elemento, permitindo a execução de ações específicas.
+ * 
+ * Parâmetros:
+ *  - `void*`: Um ponteiro para o elemento em que a operação será realizada.
+ * 
+ * Retorna:
+ *  - Nenhum valor é retornado. A função pode realizar ações sobre o elemento, como modificações ou exibição.
+ */
+typedef void(*foreachFunc)(void*);
+
+/**
+ * findFirstFunc
+ * 
+ * Tipo de função utilizado para verificar se um elemento atende a um critério específico e deve ser retornado primeiro.
+ * A função retorna `true` se o elemento atender ao critério e `false` caso contrário.
+ * 
+ * Parâmetros:
+ *  - `void*`: Um ponteiro para o elemento a ser verificado.
+ * 
+ * Retorna:
+ *  - `true` se o elemento atende ao critério.
+ *  - `false` caso contrário.
+ */
+typedef bool(*findFirstFunc)(void*);
+
+/**
+ * removeFunc
+ * 
+ * Tipo de função utilizado para determinar se um elemento deve ser removido de uma coleção.
+ * A função retorna `true` se o elemento deve ser removido e `false` caso contrário.
+ * 
+ * Parâmetros:
+ *  - `void*`: Um ponteiro para o elemento a ser verificado.
+ * 
+ * Retorna:
+ *  - `true` se o elemento deve ser removido.
+ *  - `false` caso contrário.
+ */
+typedef bool(*removeFunc)(void*);
+
+// Definição do tipo de enumeração `Order`, utilizado para comparar elementos
+
+/**
+ * Order
+ * 
+ * Enumeração utilizada para representar o resultado de uma comparação entre dois elementos.
+ * O valor `less_than` indica que o primeiro elemento é menor que o segundo, `equal` indica que são iguais, e `greater_than` indica que o primeiro elemento é maior que o segundo.
+ */
+typedef enum {less_than=-1, equal, greater_than} Order;
+
+/**
+ * orderFunc
+ * 
+ * Tipo de função utilizado para comparar dois elementos de acordo com um critério específico.
+ * A função deve retornar um valor do tipo `Order`, indicando o resultado da comparação.
+ * 
+ * Parâmetros:
+ *  - `a`: Um ponteiro para o primeiro elemento a ser comparado.
+ *  - `b`: Um ponteiro para o segundo elemento a ser comparado.
+ * 
+ * Retorna:
+ *  - `less_than` se o primeiro elemento é menor que o segundo.
+ *  - `equal` se os dois elementos são iguais.
+ *  - `greater_than` se o primeiro elemento é maior que o segundo.
+ */
+typedef Order(*orderFunc)(void* a, void* b);
+
+// Variantes com contexto: o estado da operação (prefixo buscado, acumuladores, etc.) é passado
+// em `ctx` pelo chamador, em vez de ficar em variáveis globais. Assim a mesma função pode ser
+// usada por várias operações ao mesmo tempo (reentrância e uso por múltiplas threads).
+
+/**
+ * searchCtxFunc
+ * 
+ * Variante de `searchFunc` que recebe o contexto da busca.
+ * 
+ * Parâmetros:
+ *  - `elmt`: Um ponteiro para o elemento a ser verificado.
+ *  - `ctx`: Contexto fornecido pelo chamador da busca.
+ * 
+ * Retorna:
+ *  - `true` se o elemento corresponde à condição de busca.
+ *  - `false` caso contrário.
+ */
+typedef bool (*searchCtxFunc)(void* elmt, void* ctx);
+
+/**
+ * foreachCtxFunc
+ * 
+ * Variante de `foreachFunc` que recebe o contexto da iteração.
+ * 
+ * Parâmetros:
+ *  - `elmt`: Um ponteiro para o elemento em que a operação será realizada.
+ *  - `ctx`: Contexto fornecido pelo chamador da iteração.
+ */
+typedef void(*foreachCtxFunc)(void* elmt, void* ctx);
+
+/**
+ * findFirstCtxFunc
+ * 
+ * Variante de `findFirstFunc` que recebe o contexto da busca.
+ * 
+ * Parâmetros:
+ *  - `elmt`: Um ponteiro para o elemento a ser verificado.
+ *  - `ctx`: Contexto fornecido pelo chamador da busca.
+ * 
+ * Retorna:
+ *  - `true` se o elemento atende ao critério.
+ *  - `false` caso contrário.
+ */
+typedef bool(*findFirstCtxFunc)(void* elmt, void* ctx);
+
+/**
+ * removeCtxFunc
+ * 
+ * Variante de `removeFunc` que recebe o contexto da remoção.
+ * 
+ * Parâmetros:
+ *  - `elmt`: Um ponteiro para o elemento a ser verificado.
+ *  - `ctx`: Contexto fornecido pelo chamador da remoção.
+ * 
+ * Retorna:
+ *  - `true` se o elemento deve ser removido.
+ *  - `false` caso contrário.
+ */
+typedef bool(*removeCtxFunc)(void* elmt, void* ctx);
+
+/**
+ * orderCtxFunc
+ * 
+ * Variante de `orderFunc` que recebe o contexto da comparação (ex.: critérios de ordenação).
+ * 
+ * Parâmetros:
+ *  - `a`: Um ponteiro para o primeiro elemento a ser comparado.
+ *  - `b`: Um ponteiro para o segundo elemento a ser comparado.
+ *  - `ctx`: Contexto fornecido pelo chamador da ordenação.
+ * 
+ * Retorna:
+ *  - `less_than`, `equal` ou `greater_than`, como em `orderFunc`.
+ */
+typedef Order(*orderCtxFunc)(void* a, void* b, void* ctx);
+
+#endif
@@ -0,0 +1,786 @@
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+#include <pthread.h>
+#include <stdatomic.h>
+
+#include "../../inc/service/repo.h"
+#include "../../inc/service/wal.h"
+#include "../../inc/service/csv.h"
+#include "../views/render.c"
+
+/*
+    Benchmark dos bancos em memória.
+
+    Gera CSVs sintéticos em `bin/`, carrega os bancos a partir deles e mede as operações
+    mais usadas pelas views. Compile com a coleção desejada para comparar:
+        make clean bench && ./bench
+        make clean bench COLLECTION=array && ./bench
+        make clean bench STORE=columns && ./bench
+
+    Uso: ./bench [times] [partidas] [threads]
+    (`threads` é o máximo de threads da carga paralela e de leitores do teste de carga concorrente)
+*/
+
+#define BENCH_TIME_CSV "bin/bench_times.csv"
+#define BENCH_PARTIDA_CSV "bin/bench_partidas.csv"
+#define BENCH_PARTIDA_BIN "bin/bench_partidas.bin"
+#define BENCH_LISTAGEM "/dev/null"
+
+// Quantidades padrão
+#define BENCH_TIMES 1000
+#define BENCH_PARTIDAS 200000
+#define BENCH_THREADS 8
+
+// Teste de carga concorrente: duração de cada medição e pausa de cada escritor entre alterações
+#define BENCH_STRESS_MS 500
+#define BENCH_STRESS_PAUSA_US 100
+#define BENCH_STRESS_SESSAO_US 1000  // Duração de cada sessão do leitor da classificação
+
+static struct timespec inicio;  // Início da medição atual (relógio de parede, para incluir o `fsync`)
+static long somaGols;           // Acumulador usado para que o compilador não descarte as iterações
+
+/**
+ * cronometroIniciar
+ * 
+ * Inicia uma medição, zerando também os contadores de alocação das listas.
+ */
+static void cronometroIniciar() {
+    llResetAllocStats();
+    clock_gettime(CLOCK_MONOTONIC, &inicio);
+}
+
+/**
+ * cronometroReportar
+ * 
+ * Imprime o tempo decorrido desde `cronometroIniciar`, total e por operação, e as alocações
+ * de nós de lista no período: nós entregues (sem o pool, um `malloc` cada) e `malloc`s de blocos.
+ * 
+ * Parâmetros:
+ *  - `nome`: Nome da medição.
+ *  - `operacoes`: Quantidade de operações medidas.
+ * 
+ * Retorna:
+ *  - O tempo decorrido, em ms.
+ */
+static double cronometroReportar(const char* nome, int operacoes) {
+    struct timespec fim;
+    double ms;
+    long nos, blocos;
+
+    clock_gettime(CLOCK_MONOTONIC, &fim);
+    ms = (fim.tv_sec - inicio.tv_sec) * 1000.0 + (fim.tv_nsec - inicio.tv_nsec) / 1e6;
+
+    llGetAllocStats(&nos, &blocos);
+    printf("%-32s %10.2f ms  %10.1f ns/op  %10ld nos  %8ld mallocs\n",
+        nome, ms, operacoes > 0 ? ms * 1e6 / operacoes : 0.0, nos, blocos);
+
+    return ms;
+}
+
+/**
+ * lerCSVAntigo
+ * 
+ * Lê o CSV de partidas como os bancos liam antes do leitor de csv.h (`fgets` em um buffer de
+ * 100 bytes + `sscanf` por linha), apenas somando os campos.
+ * 
+ * Retorna:
+ *  - A quantidade de linhas lidas (sem o cabeçalho).
+ */
+static int lerCSVAntigo(const char* path) {
+    char buffer[100];
+    int id, t1, t2, g1, g2;
+    int linhas = 0;
+    FILE* f;
+
+    f = fopen(path, "r");
+    if(f == NULL)
+        return 0;
+
+    fgets(buffer, 100, f);
+    while(fgets(buffer, 100, f)) {
+        sscanf(buffer, PARTIDA_CSV_PATTERN, &id, &t1, &t2, &g1, &g2);
+        somaGols += g1 + g2;
+        linhas++;
+    }
+    fclose(f);
+
+    return linhas;
+}
+
+/**
+ * lerCSV
+ * 
+ * Lê o CSV de partidas com o leitor em fluxo de csv.h, somando os campos.
+ * 
+ * Retorna:
+ *  - A quantidade de linhas lidas (sem o cabeçalho), ou `-1` em caso de erro.
+ */
+static int lerCSV(const char* path) {
+    int id, t1, t2, g1, g2;
+    int linhas = 0;
+    CsvReader* csv;
+
+    csv = csvOpen(path, CSV_SEPARATOR);
+    if(csv == NULL)
+        return -1;
+
+    csvNextRow(csv);
+    while(csvNextRow(csv)) {
+        if(!csvGetInt(csv, 0, &id) || !csvGetInt(csv, 1, &t1) || !csvGetInt(csv, 2, &t2) ||
+           !csvGetInt(csv, 3, &g1) || !csvGetInt(csv, 4, &g2))
+            break;
+        somaGols += g1 + g2;
+        linhas++;
+    }
+
+    if(csvGetError(csv) != NULL) {
+        printf("%s: %s\n", path, csvGetError(csv));
+        linhas = -1;
+    }
+    csvClose(csv);
+
+    return linhas;
+}
+
+/**
+ * gerarCSVs
+ * 
+ * Escreve os CSVs sintéticos: `times` times com nomes de 10 letras e `partidas` partidas entre
+ * times sorteados (com semente fixa, para que as execuções sejam comparáveis).
+ * 
+ * Retorna:
+ *  - `true` se os arquivos foram escritos.
+ *  - `false` se algum arquivo não pôde ser aberto.
+ */
+static bool gerarCSVs(int times, int partidas) {
+    char nome[TIME_MAX_NAME_SIZE];
+    FILE* f;
+    int i, j, t1, t2;
+
+    srand(42);
+
+    f = fopen(BENCH_TIME_CSV, "w");
+    if(f == NULL) {
+        perror("fopen");
+        return false;
+    }
+
+    fprintf(f, "ID;nome\n");
+    for(i = 0; i < times; i++) {
+        for(j = 0; j < TIME_MAX_NAME_SIZE - 1; j++)
+            nome[j] = 'A' + rand() % 26;
+        nome[TIME_MAX_NAME_SIZE - 1] = '\0';
+        fprintf(f, "%d;%s\n", i, nome);
+    }
+    fclose(f);
+
+    f = fopen(BENCH_PARTIDA_CSV, "w");
+    if(f == NULL) {
+        perror("fopen");
+        return false;
+    }
+
+    fprintf(f, "ID;Time1;Time2;GolsTime1;GolsTime2\n");
+    for(i = 0; i < partidas; i++) {
+        t1 = rand() % times;
+        t2 = (t1 + 1 + rand() % (times - 1)) % times;
+        fprintf(f, "%d;%d;%d;%d;%d\n", i, t1, t2, rand() % 6, rand() % 6);
+    }
+    fclose(f);
+
+    return true;
+}
+
+// Callback de `llForeach` para a medição de iteração completa
+static void somarGols(void* p) {
+    somaGols += partidaGetGolsT1((Partida*)p) + partidaGetGolsT2((Partida*)p);
+}
+
+/**
+ * medirCargaParalela
+ * 
+ * Mede a carga do CSV de partidas do benchmark com `threads` threads e descarta o banco.
+ * 
+ * Retorna:
+ *  - `false` se a carga falhou.
+ */
+static bool medirCargaParalela(int threads) {
+    char rotulo[40];
+    double ms;
+    int n;
+
+    partidaDBSetLoadThreads(threads);
+    cronometroIniciar();
+    if(!startPartidaDBFromFile(BENCH_PARTIDA_CSV)) {
+        printf("Falha ao carregar o CSV de partidas\n");
+        return false;
+    }
+    n = llGetSize(partidaDBGetAllPartidas());
+    sprintf(rotulo, "carga CSV (%d thread%s)", threads, threads > 1 ? "s" : "");
+    ms = cronometroReportar(rotulo, n);
+    printf("%-32s %10.0f linhas/s\n", "", n * 1000.0 / ms);
+
+    stopPartidaDB();
+    return true;
+}
+
+// Colunas da listagem de partidas das views
+static const RenderColuna colunasPartida[] = {
+    {"id", "ID", 2}, {"mandante", "Mandante", -11}, {"visitante", "Visitante", -11},
+    {"gols_mandante", "GM", 2}, {"gols_visitante", "GS", 2}, {"resultado", "R", 1}
+};
+
+static FILE* listagem;  // Destino das listagens medidas
+
+static char resultadoPartida(Partida* p) {
+    if(partidaGetGolsT1(p) > partidaGetGolsT2(p)) return 'M';
+    if(partidaGetGolsT1(p) < partidaGetGolsT2(p)) return 'V';
+    return 'E';
+}
+
+/**
+ * imprimirPartidaPrintf
+ * 
+ * Uma linha da listagem de partidas como as views imprimiam antes do renderizador (um `fprintf` por partida).
+ */
+static void imprimirPartidaPrintf(void* p) {
+    Partida* pt = (Partida*)p;
+
+    fprintf(listagem, "%2d | %-11s | %-11s | %2d | %2d | %c\n", partidaGetId(pt), timeGetName(partidaGetT1(pt)),
+            timeGetName(partidaGetT2(pt)), partidaGetGolsT1(pt), partidaGetGolsT2(pt), resultadoPartida(pt));
+}
+
+static void renderPartidaBench(void* p, void* r) {
+    Partida* pt = (Partida*)p;
+
+    renderInt(r, partidaGetId(pt));
+    renderString(r, timeGetName(partidaGetT1(pt)));
+    renderString(r, timeGetName(partidaGetT2(pt)));
+    renderInt(r, partidaGetGolsT1(pt));
+    renderInt(r, partidaGetGolsT2(pt));
+    renderChar(r, resultadoPartida(pt));
+    renderEndRow(r);
+}
+
+/**
+ * medirListagem
+ * 
+ * Lista todas as partidas em `BENCH_LISTAGEM` com o renderizador no formato informado.
+ * 
+ * Retorna:
+ *  - `true` se a listagem foi gravada.
+ */
+static bool medirListagem(const char* nome, FormatoSaida formato) {
+    Renderer r;
+    bool ok;
+
+    cronometroIniciar();
+    ok = renderBegin(&r, listagem, formato, colunasPartida, sizeof(colunasPartida) / sizeof(colunasPartida[0]));
+    if(ok)
+        llForeachCtx(partidaDBGetAllPartidas(), renderPartidaBench, &r);
+    ok = renderEnd(&r) && ok;
+    fflush(listagem);
+    cronometroReportar(nome, llGetSize(partidaDBGetAllPartidas()));
+
+    return ok;
+}
+
+// Estado de uma thread do teste de carga concorrente
+typedef struct {
+    pthread_t tid;
+    unsigned int semente;  // Semente do `rand_r` (o `rand` tem uma trava interna, disputada pelas threads)
+    int partidas;          // Os IDs sorteados ficam em `0 .. partidas-1`
+    long operacoes;        // Operações concluídas
+    long soma;             // Acumulador, para que o compilador não descarte as leituras
+    bool versao;           // O leitor da classificação fixa uma versão em vez de segurar a trava
+} StressThread;
+
+static atomic_int stressParar;  // Fim da medição atual
+
+/**
+ * stressLeitor
+ * 
+ * Leitor do teste de carga: 60% `partidaDBGetById`, 30% busca de partidas por um prefixo de 2 letras
+ * e 10% soma da tabela viva de estatísticas, cada operação com a trava de leitura.
+ */
+static void* stressLeitor(void* arg) {
+    StressThread* t = (StressThread*)arg;
+    const TimeEstatisticas* estatisticas;
+    LinkedList* resultado;
+    char prefixo[TIME_MAX_NAME_SIZE];
+    Partida* p;
+    int sorteio, count, i;
+
+    while(!atomic_load_explicit(&stressParar, memory_order_relaxed)) {
+        sorteio = rand_r(&t->semente) % 10;
+        resultado = NULL;
+
+        repoReadLock();
+        if(sorteio < 6) {
+            p = partidaDBGetById(rand_r(&t->semente) % t->partidas);
+            if(p != NULL)
+                t->soma += partidaGetGolsT1(p);
+        } else if(sorteio < 9) {
+            prefixo[0] = 'A' + rand_r(&t->semente) % 26;
+            prefixo[1] = 'A' + rand_r(&t->semente) % 26;
+            prefixo[2] = '\0';
+            resultado = partidaDBSearchMandanteOrVisitante(prefixo, BUSCA_EXATA);
+            if(resultado != NULL)
+                t->soma += llGetSize(resultado);
+        } else {
+            estatisticas = partidaDBGetEstatisticas(&count);
+            for(i = 0; estatisticas != NULL && i < count; i++)
+                t->soma += estatisticas[i].gm;
+        }
+        repoReadUnlock();
+
+        // A lista é de quem buscou: pode ser liberada sem a trava
+        llFullFree(resultado, NULL);
+        t->operacoes++;
+    }
+
+    return NULL;
+}
+
+static int compareIntDecrescente(const void* a, const void* b) {
+    return *(const int*)b - *(const int*)a;
+}
+
+/**
+ * stressClassificacao
+ * 
+ * Leitor longo do teste de carga: ordena os pontos de todos os times e mantém a leitura aberta por
+ * `BENCH_STRESS_SESSAO_US` (como uma sessão paginada da classificação). Com `versao`, lê de uma
+ * versão fixada das estatísticas; sem, segura a trava de leitura durante a sessão inteira.
+ */
+static void* stressClassificacao(void* arg) {
+    StressThread* t = (StressThread*)arg;
+    struct timespec sessao = {0, BENCH_STRESS_SESSAO_US * 1000L};
+    const TimeEstatisticas* estatisticas;
+    PartidaDBVersao* v = NULL;
+    int* pontos;
+    int count = 0;
+    int i;
+
+    while(!atomic_load_explicit(&stressParar, memory_order_relaxed)) {
+        if(t->versao) {
+            v = partidaDBVersaoFixar();
+            estatisticas = partidaDBVersaoEstatisticas(v, &count);
+        } else {
+            repoReadLock();
+            estatisticas = partidaDBGetEstatisticas(&count);
+        }
+
+        pontos = estatisticas != NULL && count > 0 ? (int*)malloc(sizeof(int) * count) : NULL;
+        if(pontos != NULL) {
+            for(i = 0; i < count; i++)
+                pontos[i] = 3 * estatisticas[i].vitorias + estatisticas[i].empates;
+            qsort(pontos, count, sizeof(int), compareIntDecrescente);
+            t->soma += pontos[0];
+            free(pontos);
+        }
+
+        nanosleep(&sessao, NULL);
+
+        if(t->versao)
+            partidaDBVersaoSoltar(v);
+        else
+            repoReadUnlock();
+
+        t->operacoes++;
+    }
+
+    return NULL;
+}
+
+/**
+ * stressEscritor
+ * 
+ * Escritor do teste de carga: atualiza os gols de partidas sorteadas (cada atualização pega a trava
+ * de escrita sozinha), com uma pausa de `BENCH_STRESS_PAUSA_US` entre elas.
+ */
+static void* stressEscritor(void* arg) {
+    StressThread* t = (StressThread*)arg;
+    struct timespec pausa = {0, BENCH_STRESS_PAUSA_US * 1000L};
+
+    while(!atomic_load_explicit(&stressParar, memory_order_relaxed)) {
+        if(partidaDBAtualizarGols(rand_r(&t->semente) % t->partidas, rand_r(&t->semente) % 5, rand_r(&t->semente) % 5))
+            t->operacoes++;
+        nanosleep(&pausa, NULL);
+    }
+
+    return NULL;
+}
+
+/**
+ * medirStress
+ * 
+ * Roda `leitores` leitores e `escritores` escritores ao mesmo tempo por `BENCH_STRESS_MS` ms e
+ * imprime as leituras por segundo (total e por leitor) e as alterações por segundo.
+ * 
+ * Parâmetros:
+ *  - `leitor`: `stressLeitor` ou `stressClassificacao`.
+ *  - `versao`: Para `stressClassificacao`, lê de versões fixadas em vez de segurar a trava.
+ * 
+ * Retorna:
+ *  - `false` se alguma thread não pôde ser criada.
+ */
+static bool medirStress(int leitores, int escritores, int partidas, void* (*leitor)(void*), bool versao) {
+    StressThread t[2 * PARTIDA_LOAD_MAX_THREADS];
+    struct timespec duracao = {BENCH_STRESS_MS / 1000, (BENCH_STRESS_MS % 1000) * 1000000L};
+    struct timespec fim;
+    long leituras = 0, escritas = 0;
+    char rotulo[48];
+    int total = leitores + escritores;
+    int criadas;
+    int i;
+    bool ok = true;
+    double ms;
+
+    atomic_store(&stressParar, 0);
+
+    for(criadas = 0; criadas < total; criadas++) {
+        t[criadas].semente = 1234u + criadas;
+        t[criadas].partidas = partidas;
+        t[criadas].operacoes = 0;
+        t[criadas].soma = 0;
+        t[criadas].versao = versao;
+        if(pthread_create(&t[criadas].tid, NULL, criadas < leitores ? leitor : stressEscritor, &t[criadas]) != 0) {
+            ok = false;
+            break;
+        }
+    }
+
+    clock_gettime(CLOCK_MONOTONIC, &inicio);
+    nanosleep(&duracao, NULL);
+    atomic_store(&stressParar, 1);
+    clock_gettime(CLOCK_MONOTONIC, &fim);
+
+    for(i = 0; i < criadas; i++) {
+        pthread_join(t[i].tid, NULL);
+        if(i < leitores)
+            leituras += t[i].operacoes;
+        else
+            escritas += t[i].operacoes;
+        somaGols += t[i].soma;
+    }
+
+    if(!ok) {
+        printf("Falha ao criar as threads do teste de carga\n");
+        return false;
+    }
+
+    ms = (fim.tv_sec - inicio.tv_sec) * 1000.0 + (fim.tv_nsec - inicio.tv_nsec) / 1e6;
+    if(leitor == stressClassificacao)
+        sprintf(rotulo, "%d classif. %s + %d escritor%s", leitores, versao ? "versao" : "trava", escritores, escritores > 1 ? "es" : "");
+    else
+        sprintf(rotulo, "%d leitor%s + %d escritor%s", leitores, leitores > 1 ? "es" : "", escritores, escritores > 1 ? "es" : "");
+    printf("%-32s %10.0f leituras/s  %10.0f por leitor  %8.0f escritas/s\n",
+        rotulo, leituras * 1000.0 / ms, leituras * 1000.0 / ms / leitores, escritas * 1000.0 / ms);
+
+    return true;
+}
+
+int main(int argc, char* argv[]) {
+    int times = argc > 1 ? atoi(argv[1]) : BENCH_TIMES;
+    int partidas = argc > 2 ? atoi(argv[2]) : BENCH_PARTIDAS;
+    int threads = argc > 3 ? atoi(argv[3]) : BENCH_THREADS;
+    char prefixo[TIME_MAX_NAME_SIZE];
+    TimeEstatisticas* estatisticas;
+    LinkedList* resultado;
+    LLCursor cursor;
+    int i, n, count;
+    long fsyncs;
+    double ms;
+
+    if(times < 2 || partidas < 1 || threads < 1 || threads > PARTIDA_LOAD_MAX_THREADS) {
+        printf("Uso: %s [times >= 2] [partidas >= 1] [threads 1..%d]\n", argv[0], PARTIDA_LOAD_MAX_THREADS);
+        return 1;
+    }
+
+#ifdef COLLECTION_ARRAY_LIST
+    printf("Coleção: ArrayList | ");
+#else
+    printf("Coleção: LinkedList | ");
+#endif
+#ifdef PARTIDA_COLUMNS
+    printf("Armazenamento: colunas | %d times, %d partidas\n\n", times, partidas);
+#else
+    printf("Armazenamento: objetos | %d times, %d partidas\n\n", times, partidas);
+#endif
+
+    if(!gerarCSVs(times, partidas))
+        return 1;
+
+    // Cada execução parte do CSV recém-gerado: o log da execução anterior não vale mais
+    remove(BENCH_PARTIDA_CSV PARTIDA_WAL_EXTENSION);
+    remove(BENCH_PARTIDA_BIN PARTIDA_WAL_EXTENSION);
+
+    // Commit em grupo nas seções gerais; o custo do `fsync` por registro é medido ao final.
+    // O checkpoint automático fica desligado para não cair no meio de uma medição.
+    partidaWALSetSync(256, 0);
+    partidaDBSetCheckpointThreshold(0);
+
+    // Leitura do CSV de partidas, só a análise (sem montar o banco): antigo x leitor em fluxo
+    cronometroIniciar();
+    n = lerCSVAntigo(BENCH_PARTIDA_CSV);
+    ms = cronometroReportar("CSV fgets + sscanf", n);
+    printf("%-32s %10.0f linhas/s\n", "", n * 1000.0 / ms);
+
+    cronometroIniciar();
+    n = lerCSV(BENCH_PARTIDA_CSV);
+    ms = cronometroReportar("CSV leitor em fluxo", n);
+    printf("%-32s %10.0f linhas/s\n", "", n * 1000.0 / ms);
+
+    // Carga
+    cronometroIniciar();
+    if(!startTimeDBFromFile(BENCH_TIME_CSV) || !startPartidaDBFromFile(BENCH_PARTIDA_CSV)) {
+        printf("Falha ao carregar os CSVs do benchmark\n");
+        return 1;
+    }
+    cronometroReportar("carga (times + partidas)", times + partidas);
+
+    // Iteração completa sobre as partidas
+    n = 20;
+    cronometroIniciar();
+    for(i = 0; i < n; i++)
+        llForeach(partidaDBGetAllPartidas(), somarGols);
+    cronometroReportar("iteracao completa (x20)", n * partidas);
+
+    // Listagem de todas as partidas: `fprintf` por linha x renderizador (buffer próprio, inteiros à mão)
+    listagem = fopen(BENCH_LISTAGEM, "w");
+    if(listagem == NULL) {
+        printf("Falha ao abrir %s\n", BENCH_LISTAGEM);
+        return 1;
+    }
+
+    cronometroIniciar();
+    llForeach(partidaDBGetAllPartidas(), imprimirPartidaPrintf);
+    fflush(listagem);
+    cronometroReportar("listagem fprintf", partidas);
+
+    if(!medirListagem("listagem render texto", FORMATO_TEXTO) ||
+       !medirListagem("listagem render csv", FORMATO_CSV) ||
+       !medirListagem("listagem render json", FORMATO_JSON)) {
+        printf("Falha ao gravar a listagem\n");
+        return 1;
+    }
+    fclose(listagem);
+
+    // Paginação de 5 em 5: cópia por página (perto do fim da lista) x cursor (todas as páginas)
+    n = partidas / 5 < 200 ? partidas / 5 : 200;
+    cronometroIniciar();
+    for(i = n; i > 0; i--) {
+        resultado = llDeepCopy(partidaDBGetAllPartidas(), partidas - i * 5, partidas - i * 5 + 4);
+        llForeach(resultado, somarGols);
+        llFullFree(resultado, NULL);
+    }
+    cronometroReportar("paginacao llDeepCopy (fim)", n);
+
+    resultado = partidaDBGetAllPartidas();
+    cursor = llCursor(resultado);
+    cronometroIniciar();
+    for(i = 0; llCursorSeek(&cursor, i * 5); i++)
+        llCursorForeach(&cursor, 5, somarGols);
+    cronometroReportar("paginacao LLCursor (todas)", i);
+
+    // Busca por ID
+    n = partidas;
+    cronometroIniciar();
+    for(i = 0; i < n; i++)
+        if(partidaDBGetById(rand() % partidas) != NULL)
+            somaGols++;
+    cronometroReportar("partidaDBGetById", n);
+
+    // Busca de times por prefixo
+    n = 2000;
+    cronometroIniciar();
+    for(i = 0; i < n; i++) {
+        prefixo[0] = 'A' + rand() % 26;
+        prefixo[1] = '\0';
+        resultado = searchByPrefix(prefixo, BUSCA_EXATA);
+        llFullFree(resultado, NULL);
+    }
+    cronometroReportar("searchByPrefix (1 letra)", n);
+
+    // Prefixo seletivo: o custo é a varredura dos nomes, não a lista de resultados
+    n = 2000;
+    cronometroIniciar();
+    for(i = 0; i < n; i++) {
+        prefixo[0] = 'A' + rand() % 26;
+        prefixo[1] = 'A' + rand() % 26;
+        prefixo[2] = 'A' + rand() % 26;
+        prefixo[3] = '\0';
+        resultado = searchByPrefix(prefixo, BUSCA_EXATA);
+        llFullFree(resultado, NULL);
+    }
+    ms = cronometroReportar("searchByPrefix (3 letras)", n);
+    printf("%-32s %10.0f times/s\n", "", (double)n * times * 1000.0 / ms);
+
+    // Mesma busca sem diferenciar maiúsculas/minúsculas: usa as chaves normalizadas e o seu índice
+    n = 2000;
+    cronometroIniciar();
+    for(i = 0; i < n; i++) {
+        prefixo[0] = 'a' + rand() % 26;
+        prefixo[1] = 'a' + rand() % 26;
+        prefixo[2] = 'a' + rand() % 26;
+        prefixo[3] = '\0';
+        resultado = searchByPrefix(prefixo, BUSCA_NORMALIZADA);
+        llFullFree(resultado, NULL);
+    }
+    cronometroReportar("searchByPrefix normalizada", n);
+
+    // Substring em qualquer posição do nome: intersecção das listas do índice de trigramas
+    n = 2000;
+    cronometroIniciar();
+    for(i = 0; i < n; i++) {
+        prefixo[0] = 'A' + rand() % 26;
+        prefixo[1] = 'A' + rand() % 26;
+        prefixo[2] = 'A' + rand() % 26;
+        prefixo[3] = '\0';
+        resultado = searchBySubstring(prefixo, BUSCA_EXATA);
+        llFullFree(resultado, NULL);
+    }
+    cronometroReportar("searchBySubstring (3 letras)", n);
+
+    // "Você quis dizer": nome de um time com uma letra trocada, com 1 e com 2 erros aceitos
+    n = 200;
+    cronometroIniciar();
+    for(i = 0; i < n; i++) {
+        strcpy(prefixo, timeGetName(timeDBGetByID(rand() % times)));
+        prefixo[rand() % strlen(prefixo)] = 'a' + rand() % 26;
+        resultado = searchBySimilarName(prefixo, 1, TIME_SUGESTOES_MAX);
+        llFullFree(resultado, NULL);
+    }
+    cronometroReportar("searchBySimilarName (1 erro)", n);
+
+    n = 200;
+    cronometroIniciar();
+    for(i = 0; i < n; i++) {
+        strcpy(prefixo, timeGetName(timeDBGetByID(rand() % times)));
+        prefixo[rand() % strlen(prefixo)] = 'a' + rand() % 26;
+        resultado = searchBySimilarName(prefixo, TIME_SUGESTOES_MAX_DISTANCIA, TIME_SUGESTOES_MAX);
+        llFullFree(resultado, NULL);
+    }
+    cronometroReportar("searchBySimilarName (2 erros)", n);
+
+    // Busca de partidas por time
+    n = 200;
+    cronometroIniciar();
+    for(i = 0; i < n; i++) {
+        prefixo[0] = 'A' + rand() % 26;
+        prefixo[1] = 'A' + rand() % 26;
+        prefixo[2] = '\0';
+        resultado = partidaDBSearchMandanteOrVisitante(prefixo, BUSCA_EXATA);
+        llFullFree(resultado, NULL);
+    }
+    cronometroReportar("partidaDBSearchMandanteOrVis.", n);
+
+    // Tabela de classificação calculada do zero
+    n = 20;
+    cronometroIniciar();
+    for(i = 0; i < n; i++) {
+        estatisticas = partidaDBCalcularEstatisticas(&count);
+        free(estatisticas);
+    }
+    cronometroReportar("partidaDBCalcularEstatisticas", n * partidas);
+
+    // Remoção de 10% das partidas
+    n = partidas / 10;
+    cronometroIniciar();
+    for(i = 0; i < n; i++)
+        partidaDBRemove(i * 10);
+    cronometroReportar("partidaDBRemove (10%)", n);
+
+    // Atualização de gols com o log: `fsync` a cada registro x commit em grupo
+    n = 500;
+    partidaWALSetSync(1, 0);
+    fsyncs = partidaWALGetSyncCount();
+    cronometroIniciar();
+    for(i = 0; i < n; i++)
+        partidaDBAtualizarGols(1 + (i % 9) * 10, i % 5, i % 3);
+    cronometroReportar("atualizar gols (fsync/registro)", n);
+    printf("%-32s %10ld\n", "  fsyncs", partidaWALGetSyncCount() - fsyncs);
+
+    n = 50000;
+    partidaWALSetSync(256, 0);
+    fsyncs = partidaWALGetSyncCount();
+    cronometroIniciar();
+    for(i = 0; i < n; i++)
+        partidaDBAtualizarGols(1 + (i % 9) * 10, i % 5, i % 3);
+    partidaWALFlush(true);
+    cronometroReportar("atualizar gols (grupo de 256)", n);
+    printf("%-32s %10ld\n", "  fsyncs", partidaWALGetSyncCount() - fsyncs);
+
+    // Reinício reaplicando o log inteiro x checkpoint + reinício só com o snapshot
+    n = (int)(partidaWALGetSize() / PARTIDA_WAL_RECORD_SIZE);
+    stopPartidaDB();
+    cronometroIniciar();
+    if(!startPartidaDBFromFile(BENCH_PARTIDA_CSV)) {
+        printf("Falha ao reiniciar o banco de partidas\n");
+        return 1;
+    }
+    cronometroReportar("reinicio (CSV + log)", partidas + n);
+
+    cronometroIniciar();
+    if(!partidaDBCheckpoint()) {
+        printf("Falha no checkpoint\n");
+        return 1;
+    }
+    cronometroReportar("checkpoint", llGetSize(partidaDBGetAllPartidas()));
+
+    stopPartidaDB();
+    cronometroIniciar();
+    if(!startPartidaDBFromFile(BENCH_PARTIDA_CSV)) {
+        printf("Falha ao reiniciar o banco de partidas\n");
+        return 1;
+    }
+    cronometroReportar("reinicio (snapshot)", llGetSize(partidaDBGetAllPartidas()));
+
+    // Mesmo estado no snapshot binário (mmap, sem análise de texto)
+    cronometroIniciar();
+    if(!partidaDBExport(BENCH_PARTIDA_BIN, true)) {
+        printf("Falha ao gravar o snapshot binario\n");
+        return 1;
+    }
+    cronometroReportar("exportar snapshot binario", llGetSize(partidaDBGetAllPartidas()));
+
+    stopPartidaDB();
+    cronometroIniciar();
+    if(!startPartidaDBFromFile(BENCH_PARTIDA_BIN)) {
+        printf("Falha ao carregar o snapshot binario\n");
+        return 1;
+    }
+    cronometroReportar("reinicio (snapshot binario)", llGetSize(partidaDBGetAllPartidas()));
+
+    // Leitores em paralelo (1, 2, 4, ..., `threads`), sozinhos e com um escritor, pela trava de leitores/escritor
+    for(n = 0; n <= 1; n++) {
+        for(i = 1; i < threads; i *= 2)
+            if(!medirStress(i, n, partidas, stressLeitor, false))
+                return 1;
+        if(!medirStress(threads, n, partidas, stressLeitor, false))
+            return 1;
+    }
+
+    // Sessões longas da classificação com um escritor: segurando a trava e com versões fixadas
+    if(!medirStress(1, 1, partidas, stressClassificacao, false) || !medirStress(1, 1, partidas, stressClassificacao, true))
+        return 1;
+    partidaWALFlush(true);
+    printf("%-32s %10s\n", "  estatisticas consistentes", partidaDBVerificarEstatisticas() ? "sim" : "nao");
+
+    stopPartidaDB();
+
+    // Carga do CSV de partidas com 1, 2, 4, ..., `threads` threads (o CSV já é o snapshot do checkpoint)
+    for(i = 1; i < threads; i *= 2)
+        if(!medirCargaParalela(i))
+            return 1;
+    if(!medirCargaParalela(threads))
+        return 1;
+    partidaDBSetLoadThreads(PARTIDA_LOAD_THREADS);
+
+    printf("\n(checksum %ld)\n", somaGols);
+
+    return 0;
+}
@@ -0,0 +1,661 @@
+#ifndef ARRAY_LIST_C
+#define ARRAY_LIST_C 0
+
+#include <stdlib.h>
+#include <string.h>
+#include "./../../shared/types.h"
+
+// Capacidade inicial de uma ArrayList após a primeira inserção
+#define ARRAY_LIST_INITIAL_CAPACITY 8
+
+/*
+    @struct ArrayList
+    Esta estrutura encapsula um vetor dinâmico de ponteiros (`void*`).
+    Os elementos ficam contíguos na memória, o que evita uma alocação por elemento
+    e torna a iteração amigável à cache. A capacidade dobra quando o vetor enche.
+*/
+typedef struct ArrayList
+{
+    void** data;   // Vetor de elementos
+    int size;      // Quantidade de elementos
+    int capacity;  // Quantidade de posições alocadas em `data`
+} ArrayList;
+
+/**
+ * newArrayList
+ * 
+ * Cria uma nova lista contígua vazia (sem alocar o vetor de elementos).
+ * 
+ * Retorna:
+ *  - Um ponteiro para a nova instância de `ArrayList`, ou `NULL` se a alocação falhar.
+ */
+ArrayList* newArrayList() {
+    ArrayList* l = (ArrayList*)malloc(sizeof(ArrayList));
+
+    if(l == NULL)
+        return NULL;
+
+    l->data = NULL;
+    l->size = 0;
+    l->capacity = 0;
+
+    return l;
+}
+
+/**
+ * alReserve
+ * 
+ * Garante que o vetor comporte pelo menos `capacity` elementos.
+ * 
+ * Parâmetros:
+ *  - `l`: Ponteiro para a lista.
+ *  - `capacity`: Capacidade mínima desejada.
+ * 
+ * Retorna:
+ *  - `true` se a lista comporta `capacity` elementos.
+ *  - `false` se a lista for `NULL` ou a realocação falhar.
+ */
+bool alReserve(ArrayList* l, int capacity) {
+    void** resized;
+
+    if(l == NULL)
+        return false;
+
+    if(capacity <= l->capacity)
+        return true;
+
+    resized = (void**)realloc(l->data, sizeof(void*) * capacity);
+    if(resized == NULL)
+        return false;
+
+    l->data = resized;
+    l->capacity = capacity;
+
+    return true;
+}
+
+/**
+ * alShrink
+ * 
+ * Reduz a capacidade do vetor para o número atual de elementos.
+ * 
+ * Parâmetros:
+ *  - `l`: Ponteiro para a lista.
+ * 
+ * Retorna:
+ *  - `true` se a operação foi bem-sucedida.
+ *  - `false` se a lista for `NULL` ou a realocação falhar.
+ */
+bool alShrink(ArrayList* l) {
+    void** resized;
+
+    if(l == NULL)
+        return false;
+
+    if(l->size == l->capacity)
+        return true;
+
+    if(l->size == 0) {
+        free(l->data);
+        l->data = NULL;
+        l->capacity = 0;
+        return true;
+    }
+
+    resized = (void**)realloc(l->data, sizeof(void*) * l->size);
+    if(resized == NULL)
+        return false;
+
+    l->data = resized;
+    l->capacity = l->size;
+
+    return true;
+}
+
+/**
+ * alAdd
+ * 
+ * Adiciona um novo elemento (void*) ao final da lista, em O(1) amortizado.
+ * 
+ * Parâmetros:
+ *  - `l`: Ponteiro para a lista onde o elemento será adicionado.
+ *  - `elmt`: Ponteiro para o elemento a ser adicionado.
+ * 
+ * Retorna:
+ *  - `true` se o elemento foi adicionado com sucesso.
+ *  - `false` se a lista ou o elemento forem `NULL` ou se houver falha na alocação.
+ */
+bool alAdd(ArrayList* l, void* elmt) {
+    if(l == NULL || elmt == NULL)
+        return false;
+
+    if(l->size == l->capacity)
+        if(!alReserve(l, l->capacity > 0 ? l->capacity * 2 : ARRAY_LIST_INITIAL_CAPACITY))
+            return false;
+
+    l->data[l->size++] = elmt;
+
+    return true;
+}
+
+/**
+ * salAdd
+ * 
+ * Adiciona um novo elemento (void*) ao final da lista, impedindo a inserção de `NULL`.
+ * 
+ * Parâmetros:
+ *  - `l`: Ponteiro para a lista onde o elemento será adicionado.
+ *  - `elmt`: Ponteiro para o elemento a ser adicionado.
+ * 
+ * Retorna:
+ *  - `true` se o elemento foi adicionado com sucesso.
+ *  - `false` se o elemento for `NULL`.
+ */
+bool salAdd(ArrayList* l, void* elmt) {
+    if(elmt == NULL)
+        return false;
+
+    return alAdd(l, elmt);
+}
+
+/**
+ * alGet
+ * 
+ * Obtém o elemento na posição indicada pelo índice, em O(1).
+ * 
+ * Parâmetros:
+ *  - `l`: Ponteiro para a lista.
+ *  - `index`: Índice do elemento a ser obtido.
+ * 
+ * Retorna:
+ *  - O elemento ou `NULL` se a lista for `NULL` ou o índice for inválido.
+ */
+void* alGet(ArrayList* l, const int index) {
+    if(l == NULL || index < 0 || index >= l->size)
+        return NULL;
+
+    return l->data[index];
+}
+
+/**
+ * alGetLast
+ * 
+ * Obtém o último elemento armazenado na lista.
+ * 
+ * Parâmetros:
+ *  - `l`: Ponteiro para a lista.
+ * 
+ * Retorna:
+ *  - O último elemento ou `NULL` se a lista for `NULL` ou vazia.
+ */
+void* alGetLast(ArrayList* l) {
+    if(l == NULL || l->size == 0)
+        return NULL;
+
+    return l->data[l->size - 1];
+}
+
+/**
+ * alIsEmpty
+ * 
+ * Verifica se a lista está vazia.
+ * 
+ * Parâmetros:
+ *  - `l`: Ponteiro para a lista.
+ * 
+ * Retorna:
+ *  - `true` se a lista estiver vazia.
+ *  - `false` caso contrário.
+ */
+bool alIsEmpty(ArrayList* l) {
+    if(l == NULL)
+        return false;
+
+    return l->size == 0;
+}
+
+/**
+ * alFullFree
+ * 
+ * Libera a lista, liberando também os elementos com a função `freeFunc` fornecida.
+ * 
+ * Parâmetros:
+ *  - `l`: Ponteiro para a lista.
+ *  - `f`: Função de liberação dos dados (pode ser `NULL`).
+ */
+void alFullFree(ArrayList* l, freeFunc f) {
+    int i;
+
+    if(l == NULL)
+        return;
+
+    if(f != NULL)
+        for(i = 0; i < l->size; i++)
+            f(l->data[i]);
+
+    free(l->data);
+    free(l);
+}
+
+/**
+ * alSearchAll
+ * 
+ * Busca todos os elementos da lista que atendem à condição especificada pela função `searchFunc`.
+ * 
+ * Parâmetros:
+ *  - `l`: Ponteiro para a lista.
+ *  - `func`: Função que define a condição de busca.
+ * 
+ * Retorna:
+ *  - Uma nova lista contendo todos os elementos que atendem à condição, ou `NULL` em caso de erro.
+ */
+ArrayList* alSearchAll(ArrayList* l, searchFunc func) {
+    ArrayList* nl;
+    int i;
+
+    if(l == NULL || func == NULL)
+        return NULL;
+
+    nl = newArrayList();
+    if(nl == NULL)
+        return NULL;
+
+    for(i = 0; i < l->size; i++)
+        if(func(l->data[i]) && !alAdd(nl, l->data[i])) {
+            alFullFree(nl, NULL);
+            return NULL;
+        }
+
+    return nl;
+}
+
+/**
+ * alSearchAllCtx
+ * 
+ * Variante de `alSearchAll` cuja condição recebe o contexto `ctx`.
+ * 
+ * Parâmetros:
+ *  - `l`: Ponteiro para a lista.
+ *  - `func`: Função que define a condição de busca.
+ *  - `ctx`: Contexto repassado a cada chamada de `func`.
+ * 
+ * Retorna:
+ *  - Uma nova lista contendo todos os elementos que atendem à condição, ou `NULL` em caso de erro.
+ */
+ArrayList* alSearchAllCtx(ArrayList* l, searchCtxFunc func, void* ctx) {
+    ArrayList* nl;
+    int i;
+
+    if(l == NULL || func == NULL)
+        return NULL;
+
+    nl = newArrayList();
+    if(nl == NULL)
+        return NULL;
+
+    for(i = 0; i < l->size; i++)
+        if(func(l->data[i], ctx) && !alAdd(nl, l->data[i])) {
+            alFullFree(nl, NULL);
+            return NULL;
+        }
+
+    return nl;
+}
+
+/**
+ * alForeach
+ * 
+ * Aplica a função `foreachFunc` a cada elemento da lista.
+ * 
+ * Parâmetros:
+ *  - `l`: Ponteiro para a lista.
+ *  - `f`: Função a ser aplicada em cada elemento.
+ */
+void alForeach(ArrayList* l, foreachFunc f) {
+    int i;
+
+    if(l == NULL || f == NULL)
+        return;
+
+    for(i = 0; i < l->size; i++)
+        f(l->data[i]);
+}
+
+/**
+ * alForeachCtx
+ * 
+ * Variante de `alForeach` cuja função recebe o contexto `ctx`.
+ * 
+ * Parâmetros:
+ *  - `l`: Ponteiro para a lista.
+ *  - `f`: Função a ser aplicada em cada elemento.
+ *  - `ctx`: Contexto repassado a cada chamada de `f`.
+ */
+void alForeachCtx(ArrayList* l, foreachCtxFunc f, void* ctx) {
+    int i;
+
+    if(l == NULL || f == NULL)
+        return;
+
+    for(i = 0; i < l->size; i++)
+        f(l->data[i], ctx);
+}
+
+/**
+ * alFindFirst
+ * 
+ * Encontra e retorna o primeiro elemento da lista que atende à condição definida pela função `findFirstFunc`.
+ * 
+ * Parâmetros:
+ *  - `l`: Ponteiro para a lista.
+ *  - `f`: Função que define a condição de busca.
+ * 
+ * Retorna:
+ *  - O primeiro elemento que atende à condição ou `NULL` se nenhum elemento atender.
+ */
+void* alFindFirst(ArrayList* l, findFirstFunc f) {
+    int i;
+
+    if(l == NULL || f == NULL)
+        return NULL;
+
+    for(i = 0; i < l->size; i++)
+        if(f(l->data[i]))
+            return l->data[i];
+
+    return NULL;
+}
+
+/**
+ * alFindFirstCtx
+ * 
+ * Variante de `alFindFirst` cuja condição recebe o contexto `ctx`.
+ * 
+ * Parâmetros:
+ *  - `l`: Ponteiro para a lista.
+ *  - `f`: Função que define a condição de busca.
+ *  - `ctx`: Contexto repassado a cada chamada de `f`.
+ * 
+ * Retorna:
+ *  - O primeiro elemento que atende à condição ou `NULL` se nenhum elemento atender.
+ */
+void* alFindFirstCtx(ArrayList* l, findFirstCtxFunc f, void* ctx) {
+    int i;
+
+    if(l == NULL || f == NULL)
+        return NULL;
+
+    for(i = 0; i < l->size; i++)
+        if(f(l->data[i], ctx))
+            return l->data[i];
+
+    return NULL;
+}
+
+/**
+ * alRemoveAt
+ * 
+ * Remove o elemento do índice informado, deslocando os seguintes uma posição para trás.
+ * 
+ * Parâmetros:
+ *  - `l`: Ponteiro para a lista.
+ *  - `index`: Índice do elemento a ser removido.
+ * 
+ * Retorna:
+ *  - `true` se o elemento foi removido.
+ *  - `false` se a lista for `NULL` ou o índice for inválido.
+ */
+bool alRemoveAt(ArrayList* l, int index) {
+    if(l == NULL || index < 0 || index >= l->size)
+        return false;
+
+    memmove(&l->data[index], &l->data[index + 1], sizeof(void*) * (l->size - index - 1));
+    l->size--;
+
+    return true;
+}
+
+/**
+ * alRemoveFirstFound
+ * 
+ * Remove o primeiro elemento da lista que atende à condição especificada pela função `removeFunc`.
+ * 
+ * Parâmetros:
+ *  - `l`: Ponteiro para a lista.
+ *  - `f`: Função que define a condição para remoção.
+ * 
+ * Retorna:
+ *  - `true` se o elemento foi removido com sucesso.
+ *  - `false` se nenhum elemento foi removido.
+ */
+bool alRemoveFirstFound(ArrayList* l, removeFunc f) {
+    int i;
+
+    if(l == NULL || f == NULL)
+        return false;
+
+    for(i = 0; i < l->size; i++)
+        if(f(l->data[i]))
+            return alRemoveAt(l, i);
+
+    return false;
+}
+
+/**
+ * alRemoveFirstFoundCtx
+ * 
+ * Variante de `alRemoveFirstFound` cuja condição recebe o contexto `ctx`.
+ * 
+ * Parâmetros:
+ *  - `l`: Ponteiro para a lista.
+ *  - `f`: Função que define a condição para remoção.
+ *  - `ctx`: Contexto repassado a cada chamada de `f`.
+ * 
+ * Retorna:
+ *  - `true` se o elemento foi removido com sucesso.
+ *  - `false` se nenhum elemento foi removido.
+ */
+bool alRemoveFirstFoundCtx(ArrayList* l, removeCtxFunc f, void* ctx) {
+    int i;
+
+    if(l == NULL || f == NULL)
+        return false;
+
+    for(i = 0; i < l->size; i++)
+        if(f(l->data[i], ctx))
+            return alRemoveAt(l, i);
+
+    return false;
+}
+
+/**
+ * alRemoveElement
+ * 
+ * Remove a primeira ocorrência de um elemento (comparando ponteiros).
+ * 
+ * Parâmetros:
+ *  - `l`: Ponteiro para a lista.
+ *  - `elmt`: Elemento a ser removido.
+ * 
+ * Retorna:
+ *  - `true` se o elemento foi removido.
+ *  - `false` caso contrário.
+ */
+bool alRemoveElement(ArrayList* l, void* elmt) {
+    int i;
+
+    if(l == NULL)
+        return false;
+
+    for(i = 0; i < l->size; i++)
+        if(l->data[i] == elmt)
+            return alRemoveAt(l, i);
+
+    return false;
+}
+
+/**
+ * mergeRuns
+ * 
+ * Função auxiliar que intercala as sequências ordenadas `src[lo..mid)` e `src[mid..hi)` em `dst[lo..hi)`.
+ * Em caso de empate o elemento da primeira sequência vem primeiro (ordenação estável).
+ */
+static void mergeRuns(void** src, void** dst, int lo, int mid, int hi, orderCtxFunc f, void* ctx) {
+    int i = lo;
+    int j = mid;
+    int k;
+
+    for(k = lo; k < hi; k++) {
+        if(i < mid && (j >= hi || f(src[j], src[i], ctx) != less_than))
+            dst[k] = src[i++];
+        else
+            dst[k] = src[j++];
+    }
+}
+
+/**
+ * alSortCtx
+ * 
+ * Ordena a lista em ordem crescente segundo `orderCtxFunc`, com merge sort estável de baixo para cima
+ * (O(n log n), usando um vetor auxiliar de `n` ponteiros).
+ * 
+ * Parâmetros:
+ *  - `l`: Ponteiro para a lista.
+ *  - `f`: Função de comparação; `f(a, b, ctx) == less_than` coloca `a` antes de `b`.
+ *  - `ctx`: Contexto repassado a `f`.
+ * 
+ * Retorna:
+ *  - `true` se a lista foi ordenada com sucesso.
+ *  - `false` se a lista ou a função forem `NULL`, ou se faltar memória.
+ */
+bool alSortCtx(ArrayList* l, orderCtxFunc f, void* ctx) {
+    void** aux;
+    void** src;
+    void** dst;
+    void** swap;
+    int width;
+    int lo;
+    int mid;
+    int hi;
+
+    if(l == NULL || f == NULL)
+        return false;
+
+    if(l->size < 2)
+        return true;
+
+    aux = (void**)malloc(sizeof(void*) * l->size);
+    if(aux == NULL)
+        return false;
+
+    src = l->data;
+    dst = aux;
+    for(width = 1; width < l->size; width *= 2) {
+        for(lo = 0; lo < l->size; lo += 2 * width) {
+            mid = lo + width < l->size ? lo + width : l->size;
+            hi = lo + 2 * width < l->size ? lo + 2 * width : l->size;
+            mergeRuns(src, dst, lo, mid, hi, f, ctx);
+        }
+        swap = src;
+        src = dst;
+        dst = swap;
+    }
+
+    if(src != l->data)
+        memcpy(l->data, src, sizeof(void*) * l->size);
+
+    free(aux);
+    return true;
+}
+
+// Adapta uma `orderFunc` (sem contexto) para a ordenação com contexto
+typedef struct {
+    orderFunc f;
+} OrderAdapter;
+
+static Order orderAdapterCall(void* a, void* b, void* ctx) {
+    return ((OrderAdapter*)ctx)->f(a, b);
+}
+
+/**
+ * alSort
+ * 
+ * Ordena a lista em ordem crescente segundo `orderFunc` (ver `alSortCtx`).
+ * 
+ * Parâmetros:
+ *  - `l`: Ponteiro para a lista.
+ *  - `f`: Função de comparação; `f(a, b) == less_than` coloca `a` antes de `b`.
+ * 
+ * Retorna:
+ *  - `true` se a lista foi ordenada com sucesso.
+ *  - `false` se a lista ou a função forem `NULL`, ou se faltar memória.
+ */
+bool alSort(ArrayList* l, orderFunc f) {
+    OrderAdapter adapter;
+
+    if(l == NULL || f == NULL)
+        return false;
+
+    adapter.f = f;
+    return alSortCtx(l, orderAdapterCall, &adapter);
+}
+
+/**
+ * alCopy
+ * 
+ * Copia para uma nova lista os elementos entre os índices `start` e `end` (inclusive).
+ * 
+ * Parâmetros:
+ *  - `l`: Ponteiro para a lista.
+ *  - `start`: Índice de início da cópia.
+ *  - `end`: Índice de término da cópia (limitado ao último índice válido).
+ * 
+ * Retorna:
+ *  - A nova lista, ou `NULL` se os índices forem inválidos ou faltar memória.
+ */
+ArrayList* alCopy(ArrayList* l, int start, int end) {
+    ArrayList* copy;
+    int n;
+
+    if(l == NULL || start < 0 || start >= l->size || end < start)
+        return NULL;
+
+    if(end >= l->size)
+        end = l->size - 1;
+
+    n = end - start + 1;
+
+    copy = newArrayList();
+    if(copy == NULL)
+        return NULL;
+
+    if(!alReserve(copy, n)) {
+        alFullFree(copy, NULL);
+        return NULL;
+    }
+
+    memcpy(copy->data, &l->data[start], sizeof(void*) * n);
+    copy->size = n;
+
+    return copy;
+}
+
+/**
+ * alGetSize
+ * 
+ * Retorna o número de elementos presentes na lista.
+ * 
+ * Parâmetros:
+ *  - `l`: Ponteiro para a lista.
+ * 
+ * Retorna:
+ *  - O número de elementos na lista, ou `-1` se a lista for `NULL`.
+ */
+int alGetSize(ArrayList* l) {
+    if(l == NULL)
+        return -1;
+
+    return l->size;
+}
+
+#endif
@@ -0,0 +1,167 @@
+#ifndef COLLECTION_C
+#define COLLECTION_C 0
+
+#include <stdlib.h>
+
+#include "./../../inc/collections/Collection.h"
+
+// Com a LinkedList como coleção todas as operações são apelidos (ver Collection.h);
+// este arquivo só implementa os adaptadores da ArrayList.
+#ifdef COLLECTION_ARRAY_LIST
+
+/**
+ * colAddHandle
+ * 
+ * Adiciona um elemento à ArrayList; a referência é o próprio elemento.
+ * 
+ * Parâmetros:
+ *  - `c`: Coleção.
+ *  - `element`: Elemento a ser adicionado.
+ * 
+ * Retorna:
+ *  - O próprio elemento, ou `NULL` em caso de falha.
+ */
+ColHandle colAddHandle(Collection* c, void* element) {
+    if(!alAdd(c, element))
+        return NULL;
+
+    return element;
+}
+
+/**
+ * colHandleGet
+ * 
+ * Obtém o elemento de uma referência (na ArrayList, a referência já é o elemento).
+ */
+void* colHandleGet(ColHandle h) {
+    return h;
+}
+
+/**
+ * colRemoveHandle
+ * 
+ * Remove o elemento da ArrayList, deslocando os seguintes (O(n)).
+ */
+bool colRemoveHandle(Collection* c, ColHandle h) {
+    return alRemoveElement(c, h);
+}
+
+/**
+ * colSearchAll
+ * 
+ * Percorre a ArrayList e copia para uma nova LinkedList os elementos que atendem à condição.
+ * 
+ * Parâmetros:
+ *  - `c`: Coleção.
+ *  - `f`: Condição de busca.
+ * 
+ * Retorna:
+ *  - A nova LinkedList, ou `NULL` em caso de erro.
+ */
+LinkedList* colSearchAll(Collection* c, searchFunc f) {
+    LinkedList* l;
+    void* e;
+    int i;
+
+    if(c == NULL || f == NULL)
+        return NULL;
+
+    l = newLinkedList();
+    if(l == NULL)
+        return NULL;
+
+    for(i = 0; i < alGetSize(c); i++) {
+        e = alGet(c, i);
+        if(f(e) && !llAdd(l, e)) {
+            llFullFree(l, NULL);
+            return NULL;
+        }
+    }
+
+    return l;
+}
+
+/**
+ * colSearchAllCtx
+ * 
+ * Variante de `colSearchAll` cuja condição recebe o contexto `ctx`.
+ * 
+ * Parâmetros:
+ *  - `c`: Coleção.
+ *  - `f`: Condição de busca.
+ *  - `ctx`: Contexto repassado a cada chamada de `f`.
+ * 
+ * Retorna:
+ *  - A nova LinkedList, ou `NULL` em caso de erro.
+ */
+LinkedList* colSearchAllCtx(Collection* c, searchCtxFunc f, void* ctx) {
+    LinkedList* l;
+    void* e;
+    int i;
+
+    if(c == NULL || f == NULL)
+        return NULL;
+
+    l = newLinkedList();
+    if(l == NULL)
+        return NULL;
+
+    for(i = 0; i < alGetSize(c); i++) {
+        e = alGet(c, i);
+        if(f(e, ctx) && !llAdd(l, e)) {
+            llFullFree(l, NULL);
+            return NULL;
+        }
+    }
+
+    return l;
+}
+
+/**
+ * colView
+ * 
+ * Retorna a LinkedList com todos os elementos da ArrayList guardada em `cache`, montando-a
+ * só se ela ainda não existe (ver `colViewFree`).
+ * 
+ * Parâmetros:
+ *  - `c`: Coleção.
+ *  - `cache`: Lista guardada pelo dono da coleção.
+ * 
+ * Retorna:
+ *  - A lista com os elementos, ou `NULL` em caso de erro.
+ */
+LinkedList* colView(Collection* c, LinkedList** cache) {
+    int i;
+
+    if(*cache != NULL)
+        return *cache;
+
+    if(c == NULL)
+        return NULL;
+
+    *cache = newLinkedList();
+    if(*cache == NULL)
+        return NULL;
+
+    for(i = 0; i < alGetSize(c); i++)
+        if(!llAdd(*cache, alGet(c, i))) {
+            colViewFree(cache);
+            return NULL;
+        }
+
+    return *cache;
+}
+
+/**
+ * colViewFree
+ * 
+ * Libera a lista guardada por `colView`; a próxima chamada monta uma nova.
+ */
+void colViewFree(LinkedList** cache) {
+    llFullFree(*cache, NULL);
+    *cache = NULL;
+}
+
+#endif
+
+#endif
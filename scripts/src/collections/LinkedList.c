@@ -1,526 +1,1118 @@
-#ifndef LINKED_LIST_C
-#define LINKED_LIST_C 0
-
-#include <stdlib.h>
-#include "./../../shared/types.h"
-
-// Estrutura Node usada para representar os elementos da lista encadeada
-typedef struct Node
-{
-    void* data;          // Dados do nó (elemento genérico)
-    struct Node* next;   // Ponteiro para o próximo nó na lista
-} Node;
-
-/*
-    @struct LinkedList
-    Esta estrutura encapsula o conceito de lista encadeada (LinkedList).
-    Como nenhum comportamento específico foi definido, ela será utilizada como uma fila,
-    facilitando a ordenação dos elementos (ex: ordenação por ID dos times).
-*/
-typedef struct LinkedList
-{
-    Node* first;  // Ponteiro para o primeiro nó da lista
-    Node* last;   // Ponteiro para o último nó da lista
-    int size;     // Tamanho da lista (quantidade de elementos)
-} LinkedList;
-
-/**
- * newLinkedList
- * 
- * Cria uma nova lista encadeada vazia.
- * 
- * Retorna:
- *  - Um ponteiro para a nova instância de `LinkedList`, ou `NULL` se a alocação falhar.
- */
-LinkedList* newLinkedList() {
-    LinkedList* l = (LinkedList*)malloc(sizeof(LinkedList));
-    
-    if(l == NULL)
-        return NULL;
-
-    l->first = NULL;
-    l->last = NULL;
-    l->size = 0;
-
-    return l;
-}
-
-/**
- * llAddN
- * 
- * Função auxiliar que adiciona um nó (Node) ao final da lista encadeada.
- * 
- * Parâmetros:
- *  - `l`: Ponteiro para a lista onde o nó será adicionado.
- *  - `n`: Ponteiro para o nó a ser adicionado.
- */
-static void llAddN(LinkedList* l, Node* n) {
-    if(l->first == NULL) {
-        l->first = n;
-        l->last = n;
-    } else {
-        l->last->next = n;
-        l->last = n;
-    }
-
-    l->size++;
-}
-
-/**
- * llAdd
- * 
- * Adiciona um novo elemento (void*) ao final da lista encadeada.
- * 
- * Parâmetros:
- *  - `l`: Ponteiro para a lista onde o elemento será adicionado.
- *  - `elmt`: Ponteiro para o elemento a ser adicionado.
- * 
- * Retorna:
- *  - `true` se o elemento foi adicionado com sucesso.
- *  - `false` se a lista for `NULL` ou se houver falha na alocação.
- */
-bool llAdd(LinkedList* l, void* elmt) {
-    Node* n;
-
-    if(l == NULL || elmt == NULL)
-        return false;
-
-    n = (Node*)malloc(sizeof(Node));
-    if(n == NULL)
-        return false;
-
-    n->data = elmt;
-    n->next = NULL;
-
-    llAddN(l, n);
-
-    return true;
-}
-
-/**
- * sllAdd
- * 
- * Adiciona um novo elemento (void*) ao final da lista encadeada.
- * Função que impede a inserção de `NULL` como elemento.
- * 
- * Parâmetros:
- *  - `l`: Ponteiro para a lista onde o elemento será adicionado.
- *  - `elmt`: Ponteiro para o elemento a ser adicionado.
- * 
- * Retorna:
- *  - `true` se o elemento foi adicionado com sucesso.
- *  - `false` se o elemento for `NULL`.
- */
-bool sllAdd(LinkedList* l, void* elmt) {
-    if(elmt == NULL)
-        return false;
-    
-    return llAdd(l, elmt);
-}
-
-/**
- * getAt
- * 
- * Função auxiliar para obter o nó na lista encadeada no índice especificado.
- * 
- * ATENÇÃO:
- *  - Esta função não é segura. Se a lista for `NULL` ou o índice for inválido, causará falha de segmentação.
- * 
- * Parâmetros:
- *  - `l`: Ponteiro para a lista encadeada.
- *  - `idx`: Índice do nó a ser obtido.
- * 
- * Retorna:
- *  - O nó no índice especificado ou `NULL` se o índice for inválido.
- */
-static Node* getAt(LinkedList* l, const  int idx) {
-      int i;
-      int stop = idx;
-
-    Node* n = l->first;
-
-    for(i = 0; i < stop; i++)
-        n = n->next;
-
-    return n;
-}
-
-/**
- * llGet
- * 
- * Obtém o elemento armazenado no nó na posição indicada pelo índice.
- * 
- * Parâmetros:
- *  - `l`: Ponteiro para a lista encadeada.
- *  - `index`: Índice do elemento a ser obtido.
- * 
- * Retorna:
- *  - O elemento armazenado no nó ou `NULL` se a lista for `NULL` ou o índice for inválido.
- */
-void* llGet(LinkedList* l, const int index) {
-    Node* n;
-
-    if(l == NULL)
-        return NULL;
-
-    if(index >= l->size)
-        return NULL;
-
-    n = getAt(l, index);
-
-    if(n == NULL)
-        return NULL;
-
-    return n->data;
-}
-
-/**
- * llGetLast
- * 
- * Obtém o último elemento armazenado na lista.
- * 
- * Parâmetros:
- *  - `l`: Ponteiro para a lista encadeada.
- * 
- * Retorna:
- *  - O último elemento ou `NULL` se a lista for `NULL` ou vazia.
- */
-void* llGetLast(LinkedList* l) {
-    if(l == NULL || l->last == NULL)
-        return NULL;
-
-    return l->last->data;
-}
-
-/**
- * llIsEmpty
- * 
- * Verifica se a lista encadeada está vazia.
- * 
- * Parâmetros:
- *  - `l`: Ponteiro para a lista encadeada.
- * 
- * Retorna:
- *  - `true` se a lista estiver vazia.
- *  - `false` caso contrário.
- */
-bool llIsEmpty(LinkedList* l) {
-    if(l == NULL)
-        return false;
-
-    return l->first == NULL;
-}
-
-/**
- * llFree
- * 
- * Libera todos os nós da lista, sem liberar os dados armazenados neles.
- * 
- * Parâmetros:
- *  - `l`: Ponteiro para a lista encadeada.
- */
-static void llFree(LinkedList* l) {
-    Node* last; 
-    Node* current;
-
-    for(current = l->first; current != NULL;) {
-        last = current;
-        current = current->next;
-        free(last);
-    }
-}
-
-/**
- * llFreeData
- * 
- * Libera todos os nós da lista, além de liberar os dados armazenados em cada nó usando a função fornecida.
- * 
- * Parâmetros:
- *  - `l`: Ponteiro para a lista encadeada.
- *  - `f`: Função de liberação dos dados (ex: `free`).
- */
-static void llFreeData(LinkedList* l, freeFunc f) {
-    Node* last; 
-    Node* current;
-
-    for(current = l->first; current != NULL;) {
-        f(current->data);
-        last = current;
-        current = current->next;
-        free(last);
-    }
-}
-
-/**
- * llFullFree
- * 
- * Libera todos os nós da lista, liberando também os dados associados com a função `freeFunc` fornecida.
- * 
- * Parâmetros:
- *  - `l`: Ponteiro para a lista encadeada.
- *  - `f`: Função de liberação dos dados (pode ser `NULL`).
- */
-void llFullFree(LinkedList* l, freeFunc f) {
-    if(l == NULL)
-        return;
-
-    if(f == NULL)
-        llFree(l);
-    else
-        llFreeData(l, f);
-
-    free(f);
-}
-
-/**
- * llSearchAll
- * 
- * Busca todos os elementos da lista que atendem à condição especificada pela função `searchFunc`.
- * 
- * Parâmetros:
- *  - `l`: Ponteiro para a lista encadeada.
- *  - `func`: Função que define a condição de busca.
- * 
- * Retorna:
- *  - Uma nova lista contendo todos os elementos que atendem à condição da função `searchFunc`.
- */
-LinkedList* llSearchAll(LinkedList* l, searchFunc func) {
-    LinkedList* nl = newLinkedList();
-    Node* n;
-    bool ok;
-    if(l == NULL || func == NULL || nl == NULL)
-        return NULL;
-
-    for(n = l->first; n != NULL; n = n->next)
-        if(func(n->data)) {
-            ok = llAdd(nl, n->data);
-            if(!ok) {
-                llFullFree(nl, NULL);
-                return NULL;
-            }
-        }
-
-    return nl;
-}
-
-/**
- * llForeach
- * 
- * Aplica a função `foreachFunc` a cada elemento da lista.
- * 
- * Parâmetros:
- *  - `l`: Ponteiro para a lista encadeada.
- *  - `f`: Função a ser aplicada em cada elemento.
- */
-void llForeach(LinkedList* l, foreachFunc f) {
-    Node* n;
-    if(l == NULL || f == NULL)
-        return;
-
-    for(n = l->first; n != NULL; n = n->next)
-        f(n->data);
-}
-
-/**
- * llFindFirst
- * 
- * Encontra e retorna o primeiro elemento da lista que atende à condição definida pela função `findFirstFunc`.
- * 
- * Parâmetros:
- *  - `l`: Ponteiro para a lista encadeada.
- *  - `f`: Função que define a condição de busca.
- * 
- * Retorna:
- *  - O primeiro elemento que atende à condição ou `NULL` se nenhum elemento atender.
- */
-void* llFindFirst(LinkedList* l, findFirstFunc f) {
-    Node* n;
-    if(l == NULL || f == NULL)
-        return NULL;
-    
-    for(n = l->first; n != NULL; n = n->next)
-        if(f(n->data))
-            return n->data;
-    
-    return NULL;
-}
-
-/**
- * llRemoveFirstFound
- * 
- * Remove o primeiro elemento da lista que atende à condição especificada pela função `removeFunc`.
- * 
- * Parâmetros:
- *  - `l`: Ponteiro para a lista encadeada.
- *  - `f`: Função que define a condição para remoção.
- * 
- * Retorna:
- *  - `true` se o elemento foi removido com sucesso.
- *  - `false` se nenhum elemento foi removido.
- */
-bool llRemoveFirstFound(LinkedList* l, removeFunc f) {
-    Node* n;
-    Node* b = NULL;
-    if(l == NULL || f == NULL)
-        return false;
-
-    for(n = l->first; n != NULL; n = n->next) {
-        if(f(n->data)) {
-            if(b == NULL) {
-                l->first = n->next;
-                if(l->first == NULL)
-                    l->last = NULL;
-                free(n);
-            } else {
-                b->next = n->next;
-                if(b->next == NULL)
-                    l->last = b;
-                free(n);
-            }
-
-            l->size--;
-            return true;
-        }
-
-        b = n;
-    }
-
-    return false;
-}
-
-/**
- * llBoubleSort
- * 
- * Realiza a ordenação por bolha (bubble sort) na lista encadeada, usando a função `orderFunc` para comparar os elementos.
- * 
- * Parâmetros:
- *  - `l`: Ponteiro para a lista encadeada.
- *  - `f`: Função de comparação que determina a ordem dos elementos.
- * 
- * Retorna:
- *  - `true` se a lista foi ordenada com sucesso.
- *  - `false` caso haja algum erro (por exemplo, se a lista ou a função de comparação forem `NULL`).
- */
-bool llBoubleSort(LinkedList* l, orderFunc f) {
-    Node* a;
-    Node* b;
-    void* swapAux;
-    
-    if(l == NULL || f == NULL)
-        return false;
-
-    for(a=l->first; a != NULL; a = a->next)
-        for(b=l->first; b != NULL; b = b->next)
-            if(f(a->data, b->data) == greater_than) {
-                swapAux = b->data;
-                b->data = a->data;
-                a->data = swapAux;
-            }
-
-    return true;
-}
-
-/**
- * nodeCopy
- * 
- * Cria uma cópia de um nó da lista.
- * 
- * Parâmetros:
- *  - `n`: Ponteiro para o nó a ser copiado.
- * 
- * Retorna:
- *  - Uma cópia do nó ou `NULL` se a alocação falhar.
- */
-static Node* nodeCopy(Node* n) {
-    Node* cp;
-
-    if(n == NULL)
-        return NULL;
-
-    cp = (Node*)malloc(sizeof(Node));
-    if(cp == NULL)
-        return NULL;
-
-    cp->data = n->data;
-    cp->next = NULL;
-    return cp;
-}
-
-/**
- * llDeepCopy
- * 
- * Cria uma cópia profunda de uma parte da lista encadeada, entre os índices `start` e `end`.
- * 
- * Parâmetros:
- *  - `l`: Ponteiro para a lista encadeada.
- *  - `start`: Índice de início da cópia.
- *  - `end`: Índice de término da cópia.
- * 
- * Retorna:
- *  - Uma nova lista encadeada contendo a cópia dos elementos entre os índices especificados.
- *  - `NULL` se ocorrer algum erro (por exemplo, índices inválidos ou falha de alocação).
- */
-LinkedList* llDeepCopy(LinkedList* l, int start, int end) {
-    LinkedList* lCopy;
-    Node* n;
-    Node* copy;
-    Node* lastCopy;
-    int i;
-
-    if(l == NULL || l->first == NULL || start < 0 || end < start || end > l->size)
-        return NULL;
-
-    lCopy = newLinkedList();
-    if(lCopy == NULL)
-        return NULL;
-
-    n = l->first;
-    for(i=0; i < start; i++)
-        n = n->next;
-
-    copy = nodeCopy(n);
-    if(copy == NULL) {
-        free(copy);
-        return NULL;
-    }
-
-    lCopy->first = copy;
-    lastCopy = copy;
-    for(; i < end; i++) {
-        n = n->next;
-        if(n == NULL)
-            break; // early stop
-        copy = nodeCopy(n);
-        if(copy == NULL) {
-            llFullFree(lCopy, NULL);
-            return NULL;
-        }
-        lastCopy->next = copy;
-        lastCopy = copy;
-    }
-
-    lCopy->last = copy;
-    lCopy->size = end-start;
-
-    return lCopy;
-}
-
-/**
- * llGetSize
- * 
- * Retorna o número de elementos presentes na lista encadeada.
- * 
- * Parâmetros:
- *  - `l`: Ponteiro para a lista encadeada.
- * 
- * Retorna:
- *  - O número de elementos na lista, ou `-1` se a lista for `NULL`.
- */
-int llGetSize(LinkedList* l) {
-    if(l == NULL)
-        return -1;
-
-    return l->size;
-}
-
-#endif
+#ifndef LINKED_LIST_C
+#define LINKED_LIST_C 0
+
+#include <stdlib.h>
+#include "./../../shared/types.h"
+#include "./../../inc/collections/LinkedList.h"
+
+// Estrutura Node usada para representar os elementos da lista encadeada
+typedef struct Node
+{
+    void* data;          // Dados do nó (elemento genérico)
+    struct Node* next;   // Ponteiro para o próximo nó na lista
+    struct Node* prev;   // Ponteiro para o nó anterior (permite remoção em O(1) via `llRemoveNode`)
+} Node;
+
+/*
+    Bloco de nós do pool de uma lista. Os nós de cada lista são alocados em blocos contíguos
+    (de `LL_POOL_FIRST_CHUNK` nós, dobrando até `LL_POOL_MAX_CHUNK`) e os nós removidos voltam
+    para uma lista de livres da própria lista, sendo reaproveitados nas próximas inserções.
+    Assim, uma lista com n elementos faz O(log n) chamadas a `malloc` e é liberada em O(blocos).
+*/
+typedef struct NodeChunk
+{
+    struct NodeChunk* next;  // Bloco alocado anteriormente
+    int used;                // Nós já entregues deste bloco
+    int capacity;            // Quantidade de nós do bloco
+    Node nodes[];            // Nós do bloco
+} NodeChunk;
+
+// Tamanho do primeiro bloco e tamanho máximo de um bloco (em nós)
+#define LL_POOL_FIRST_CHUNK 8
+#define LL_POOL_MAX_CHUNK 4096
+
+/*
+    @struct LinkedList
+    Esta estrutura encapsula o conceito de lista encadeada (LinkedList).
+    Como nenhum comportamento específico foi definido, ela será utilizada como uma fila,
+    facilitando a ordenação dos elementos (ex: ordenação por ID dos times).
+*/
+typedef struct LinkedList
+{
+    Node* first;  // Ponteiro para o primeiro nó da lista
+    Node* last;   // Ponteiro para o último nó da lista
+    int size;     // Tamanho da lista (quantidade de elementos)
+    NodeChunk* chunks;  // Blocos do pool de nós (o primeiro é o bloco atual)
+    Node* freeNodes;    // Nós removidos, prontos para reuso (encadeados por `next`)
+} LinkedList;
+
+#ifdef LINKED_LIST_STATS
+// Contadores de alocação da thread (ver `llGetAllocStats`): listas montadas por várias threads não disputam os contadores
+static _Thread_local long statsNodes;
+static _Thread_local long statsChunks;
+#endif
+
+/**
+ * newLinkedList
+ * 
+ * Cria uma nova lista encadeada vazia.
+ * 
+ * Retorna:
+ *  - Um ponteiro para a nova instância de `LinkedList`, ou `NULL` se a alocação falhar.
+ */
+LinkedList* newLinkedList() {
+    LinkedList* l = (LinkedList*)malloc(sizeof(LinkedList));
+    
+    if(l == NULL)
+        return NULL;
+
+    l->first = NULL;
+    l->last = NULL;
+    l->size = 0;
+    l->chunks = NULL;
+    l->freeNodes = NULL;
+
+    return l;
+}
+
+/**
+ * nodeAlloc
+ * 
+ * Função auxiliar que obtém um nó do pool da lista: reaproveita um nó livre, usa a próxima posição
+ * do bloco atual ou, se o bloco estiver cheio, aloca um novo bloco com o dobro do tamanho.
+ * 
+ * Parâmetros:
+ *  - `l`: Lista dona do nó.
+ * 
+ * Retorna:
+ *  - O nó (com campos não inicializados), ou `NULL` se faltar memória.
+ */
+static Node* nodeAlloc(LinkedList* l) {
+    NodeChunk* c = l->chunks;
+    Node* n;
+    int capacity;
+
+#ifdef LINKED_LIST_STATS
+    statsNodes++;
+#endif
+
+    if(l->freeNodes != NULL) {
+        n = l->freeNodes;
+        l->freeNodes = n->next;
+        return n;
+    }
+
+    if(c == NULL || c->used == c->capacity) {
+        capacity = c == NULL ? LL_POOL_FIRST_CHUNK : c->capacity * 2;
+        if(capacity > LL_POOL_MAX_CHUNK)
+            capacity = LL_POOL_MAX_CHUNK;
+
+        c = (NodeChunk*)malloc(sizeof(NodeChunk) + sizeof(Node) * capacity);
+        if(c == NULL)
+            return NULL;
+
+#ifdef LINKED_LIST_STATS
+        statsChunks++;
+#endif
+
+        c->next = l->chunks;
+        c->used = 0;
+        c->capacity = capacity;
+        l->chunks = c;
+    }
+
+    return &c->nodes[c->used++];
+}
+
+/**
+ * nodeRelease
+ * 
+ * Função auxiliar que devolve um nó à lista de livres da lista dona (a memória só é liberada em `llFullFree`).
+ * 
+ * Parâmetros:
+ *  - `l`: Lista dona do nó.
+ *  - `n`: Nó a ser devolvido.
+ */
+static void nodeRelease(LinkedList* l, Node* n) {
+    n->data = NULL;
+    n->next = l->freeNodes;
+    l->freeNodes = n;
+}
+
+/**
+ * llAddN
+ * 
+ * Função auxiliar que adiciona um nó (Node) ao final da lista encadeada.
+ * 
+ * Parâmetros:
+ *  - `l`: Ponteiro para a lista onde o nó será adicionado.
+ *  - `n`: Ponteiro para o nó a ser adicionado.
+ */
+static void llAddN(LinkedList* l, Node* n) {
+    n->prev = l->last;
+
+    if(l->first == NULL) {
+        l->first = n;
+        l->last = n;
+    } else {
+        l->last->next = n;
+        l->last = n;
+    }
+
+    l->size++;
+}
+
+/**
+ * llAddNode
+ * 
+ * Adiciona um novo elemento (void*) ao final da lista encadeada e retorna o nó criado.
+ * O nó pode ser guardado por índices externos para acesso e remoção em O(1).
+ * 
+ * Parâmetros:
+ *  - `l`: Ponteiro para a lista onde o elemento será adicionado.
+ *  - `elmt`: Ponteiro para o elemento a ser adicionado.
+ * 
+ * Retorna:
+ *  - O nó criado, ou `NULL` se a lista ou o elemento forem `NULL` ou se houver falha na alocação.
+ */
+Node* llAddNode(LinkedList* l, void* elmt) {
+    Node* n;
+
+    if(l == NULL || elmt == NULL)
+        return NULL;
+
+    n = nodeAlloc(l);
+    if(n == NULL)
+        return NULL;
+
+    n->data = elmt;
+    n->next = NULL;
+
+    llAddN(l, n);
+
+    return n;
+}
+
+/**
+ * llAdd
+ * 
+ * Adiciona um novo elemento (void*) ao final da lista encadeada.
+ * 
+ * Parâmetros:
+ *  - `l`: Ponteiro para a lista onde o elemento será adicionado.
+ *  - `elmt`: Ponteiro para o elemento a ser adicionado.
+ * 
+ * Retorna:
+ *  - `true` se o elemento foi adicionado com sucesso.
+ *  - `false` se a lista for `NULL` ou se houver falha na alocação.
+ */
+bool llAdd(LinkedList* l, void* elmt) {
+    return llAddNode(l, elmt) != NULL;
+}
+
+/**
+ * llNodeGet
+ * 
+ * Obtém o elemento armazenado em um nó.
+ * 
+ * Parâmetros:
+ *  - `n`: Ponteiro para o nó.
+ * 
+ * Retorna:
+ *  - O elemento armazenado, ou `NULL` se o nó for `NULL`.
+ */
+void* llNodeGet(Node* n) {
+    if(n == NULL)
+        return NULL;
+
+    return n->data;
+}
+
+/**
+ * sllAdd
+ * 
+ * Adiciona um novo elemento (void*) ao final da lista encadeada.
+ * Função que impede a inserção de `NULL` como elemento.
+ * 
+ * Parâmetros:
+ *  - `l`: Ponteiro para a lista onde o elemento será adicionado.
+ *  - `elmt`: Ponteiro para o elemento a ser adicionado.
+ * 
+ * Retorna:
+ *  - `true` se o elemento foi adicionado com sucesso.
+ *  - `false` se o elemento for `NULL`.
+ */
+bool sllAdd(LinkedList* l, void* elmt) {
+    if(elmt == NULL)
+        return false;
+    
+    return llAdd(l, elmt);
+}
+
+/**
+ * getAt
+ * 
+ * Função auxiliar para obter o nó na lista encadeada no índice especificado.
+ * Percorre a partir da ponta mais próxima (início ou fim), então custa O(min(idx, tamanho - idx)).
+ * 
+ * ATENÇÃO:
+ *  - Esta função não é segura. Se a lista for `NULL` ou o índice for inválido, causará falha de segmentação.
+ * 
+ * Parâmetros:
+ *  - `l`: Ponteiro para a lista encadeada.
+ *  - `idx`: Índice do nó a ser obtido.
+ * 
+ * Retorna:
+ *  - O nó no índice especificado ou `NULL` se o índice for inválido.
+ */
+static Node* getAt(LinkedList* l, const  int idx) {
+      int i;
+      int stop = idx;
+
+    Node* n;
+
+    if(stop > l->size / 2) {
+        n = l->last;
+        for(i = l->size - 1; i > stop; i--)
+            n = n->prev;
+        return n;
+    }
+
+    n = l->first;
+    for(i = 0; i < stop; i++)
+        n = n->next;
+
+    return n;
+}
+
+/**
+ * llGet
+ * 
+ * Obtém o elemento armazenado no nó na posição indicada pelo índice.
+ * 
+ * Parâmetros:
+ *  - `l`: Ponteiro para a lista encadeada.
+ *  - `index`: Índice do elemento a ser obtido.
+ * 
+ * Retorna:
+ *  - O elemento armazenado no nó ou `NULL` se a lista for `NULL` ou o índice for inválido.
+ */
+void* llGet(LinkedList* l, const int index) {
+    Node* n;
+
+    if(l == NULL)
+        return NULL;
+
+    if(index >= l->size)
+        return NULL;
+
+    n = getAt(l, index);
+
+    if(n == NULL)
+        return NULL;
+
+    return n->data;
+}
+
+/**
+ * llGetLast
+ * 
+ * Obtém o último elemento armazenado na lista.
+ * 
+ * Parâmetros:
+ *  - `l`: Ponteiro para a lista encadeada.
+ * 
+ * Retorna:
+ *  - O último elemento ou `NULL` se a lista for `NULL` ou vazia.
+ */
+void* llGetLast(LinkedList* l) {
+    if(l == NULL || l->last == NULL)
+        return NULL;
+
+    return l->last->data;
+}
+
+/**
+ * llIsEmpty
+ * 
+ * Verifica se a lista encadeada está vazia.
+ * 
+ * Parâmetros:
+ *  - `l`: Ponteiro para a lista encadeada.
+ * 
+ * Retorna:
+ *  - `true` se a lista estiver vazia.
+ *  - `false` caso contrário.
+ */
+bool llIsEmpty(LinkedList* l) {
+    if(l == NULL)
+        return false;
+
+    return l->first == NULL;
+}
+
+/**
+ * llFree
+ * 
+ * Libera todos os nós da lista, sem liberar os dados armazenados neles.
+ * Como os nós vivem nos blocos do pool, o custo é O(blocos), e não O(nós).
+ * 
+ * Parâmetros:
+ *  - `l`: Ponteiro para a lista encadeada.
+ */
+static void llFree(LinkedList* l) {
+    NodeChunk* last;
+    NodeChunk* current;
+
+    for(current = l->chunks; current != NULL;) {
+        last = current;
+        current = current->next;
+        free(last);
+    }
+}
+
+/**
+ * llFreeData
+ * 
+ * Libera os dados armazenados em cada nó da lista usando a função fornecida.
+ * Os nós são liberados depois, junto com os blocos, por `llFree`.
+ * 
+ * Parâmetros:
+ *  - `l`: Ponteiro para a lista encadeada.
+ *  - `f`: Função de liberação dos dados (ex: `free`).
+ */
+static void llFreeData(LinkedList* l, freeFunc f) {
+    Node* current;
+
+    for(current = l->first; current != NULL; current = current->next)
+        f(current->data);
+}
+
+/**
+ * llFullFree
+ * 
+ * Libera todos os nós da lista, liberando também os dados associados com a função `freeFunc` fornecida.
+ * Sem `freeFunc` o custo é O(blocos do pool); com ela, cada elemento precisa ser visitado.
+ * 
+ * Parâmetros:
+ *  - `l`: Ponteiro para a lista encadeada.
+ *  - `f`: Função de liberação dos dados (pode ser `NULL`).
+ */
+void llFullFree(LinkedList* l, freeFunc f) {
+    if(l == NULL)
+        return;
+
+    if(f != NULL)
+        llFreeData(l, f);
+
+    llFree(l);
+    free(l);
+}
+
+/**
+ * llSearchAll
+ * 
+ * Busca todos os elementos da lista que atendem à condição especificada pela função `searchFunc`.
+ * 
+ * Parâmetros:
+ *  - `l`: Ponteiro para a lista encadeada.
+ *  - `func`: Função que define a condição de busca.
+ * 
+ * Retorna:
+ *  - Uma nova lista contendo todos os elementos que atendem à condição da função `searchFunc`.
+ */
+LinkedList* llSearchAll(LinkedList* l, searchFunc func) {
+    LinkedList* nl = newLinkedList();
+    Node* n;
+    bool ok;
+    if(l == NULL || func == NULL || nl == NULL)
+        return NULL;
+
+    for(n = l->first; n != NULL; n = n->next)
+        if(func(n->data)) {
+            ok = llAdd(nl, n->data);
+            if(!ok) {
+                llFullFree(nl, NULL);
+                return NULL;
+            }
+        }
+
+    return nl;
+}
+
+/**
+ * llSearchAllCtx
+ * 
+ * Variante de `llSearchAll` cuja condição recebe o contexto `ctx`.
+ * 
+ * Parâmetros:
+ *  - `l`: Ponteiro para a lista encadeada.
+ *  - `func`: Função que define a condição de busca.
+ *  - `ctx`: Contexto repassado a cada chamada de `func`.
+ * 
+ * Retorna:
+ *  - Uma nova lista contendo todos os elementos que atendem à condição, ou `NULL` em caso de erro.
+ */
+LinkedList* llSearchAllCtx(LinkedList* l, searchCtxFunc func, void* ctx) {
+    LinkedList* nl;
+    Node* n;
+
+    if(l == NULL || func == NULL)
+        return NULL;
+
+    nl = newLinkedList();
+    if(nl == NULL)
+        return NULL;
+
+    for(n = l->first; n != NULL; n = n->next)
+        if(func(n->data, ctx) && !llAdd(nl, n->data)) {
+            llFullFree(nl, NULL);
+            return NULL;
+        }
+
+    return nl;
+}
+
+/**
+ * llForeach
+ * 
+ * Aplica a função `foreachFunc` a cada elemento da lista.
+ * 
+ * Parâmetros:
+ *  - `l`: Ponteiro para a lista encadeada.
+ *  - `f`: Função a ser aplicada em cada elemento.
+ */
+void llForeach(LinkedList* l, foreachFunc f) {
+    Node* n;
+    if(l == NULL || f == NULL)
+        return;
+
+    for(n = l->first; n != NULL; n = n->next)
+        f(n->data);
+}
+
+/**
+ * llForeachCtx
+ * 
+ * Variante de `llForeach` cuja função recebe o contexto `ctx`.
+ * 
+ * Parâmetros:
+ *  - `l`: Ponteiro para a lista encadeada.
+ *  - `f`: Função a ser aplicada em cada elemento.
+ *  - `ctx`: Contexto repassado a cada chamada de `f`.
+ */
+void llForeachCtx(LinkedList* l, foreachCtxFunc f, void* ctx) {
+    Node* n;
+    if(l == NULL || f == NULL)
+        return;
+
+    for(n = l->first; n != NULL; n = n->next)
+        f(n->data, ctx);
+}
+
+/**
+ * llFindFirst
+ * 
+ * Encontra e retorna o primeiro elemento da lista que atende à condição definida pela função `findFirstFunc`.
+ * 
+ * Parâmetros:
+ *  - `l`: Ponteiro para a lista encadeada.
+ *  - `f`: Função que define a condição de busca.
+ * 
+ * Retorna:
+ *  - O primeiro elemento que atende à condição ou `NULL` se nenhum elemento atender.
+ */
+void* llFindFirst(LinkedList* l, findFirstFunc f) {
+    Node* n;
+    if(l == NULL || f == NULL)
+        return NULL;
+    
+    for(n = l->first; n != NULL; n = n->next)
+        if(f(n->data))
+            return n->data;
+    
+    return NULL;
+}
+
+/**
+ * llFindFirstCtx
+ * 
+ * Variante de `llFindFirst` cuja condição recebe o contexto `ctx`.
+ * 
+ * Parâmetros:
+ *  - `l`: Ponteiro para a lista encadeada.
+ *  - `f`: Função que define a condição de busca.
+ *  - `ctx`: Contexto repassado a cada chamada de `f`.
+ * 
+ * Retorna:
+ *  - O primeiro elemento que atende à condição ou `NULL` se nenhum elemento atender.
+ */
+void* llFindFirstCtx(LinkedList* l, findFirstCtxFunc f, void* ctx) {
+    Node* n;
+    if(l == NULL || f == NULL)
+        return NULL;
+
+    for(n = l->first; n != NULL; n = n->next)
+        if(f(n->data, ctx))
+            return n->data;
+
+    return NULL;
+}
+
+/**
+ * llUnlink
+ * 
+ * Função auxiliar que desencadeia um nó da lista, ajustando `first`, `last` e o tamanho.
+ * O nó não é liberado.
+ * 
+ * Parâmetros:
+ *  - `l`: Ponteiro para a lista encadeada.
+ *  - `n`: Nó a ser desencadeado (deve pertencer a `l`).
+ */
+static void llUnlink(LinkedList* l, Node* n) {
+    if(n->prev == NULL)
+        l->first = n->next;
+    else
+        n->prev->next = n->next;
+
+    if(n->next == NULL)
+        l->last = n->prev;
+    else
+        n->next->prev = n->prev;
+
+    l->size--;
+}
+
+/**
+ * llRemoveFirstFound
+ * 
+ * Remove o primeiro elemento da lista que atende à condição especificada pela função `removeFunc`.
+ * 
+ * Parâmetros:
+ *  - `l`: Ponteiro para a lista encadeada.
+ *  - `f`: Função que define a condição para remoção.
+ * 
+ * Retorna:
+ *  - `true` se o elemento foi removido com sucesso.
+ *  - `false` se nenhum elemento foi removido.
+ */
+bool llRemoveFirstFound(LinkedList* l, removeFunc f) {
+    Node* n;
+    if(l == NULL || f == NULL)
+        return false;
+
+    for(n = l->first; n != NULL; n = n->next) {
+        if(f(n->data)) {
+            llUnlink(l, n);
+            nodeRelease(l, n);
+            return true;
+        }
+    }
+
+    return false;
+}
+
+/**
+ * llRemoveFirstFoundCtx
+ * 
+ * Variante de `llRemoveFirstFound` cuja condição recebe o contexto `ctx`.
+ * 
+ * Parâmetros:
+ *  - `l`: Ponteiro para a lista encadeada.
+ *  - `f`: Função que define a condição para remoção.
+ *  - `ctx`: Contexto repassado a cada chamada de `f`.
+ * 
+ * Retorna:
+ *  - `true` se o elemento foi removido com sucesso.
+ *  - `false` se nenhum elemento foi removido.
+ */
+bool llRemoveFirstFoundCtx(LinkedList* l, removeCtxFunc f, void* ctx) {
+    Node* n;
+    if(l == NULL || f == NULL)
+        return false;
+
+    for(n = l->first; n != NULL; n = n->next) {
+        if(f(n->data, ctx)) {
+            llUnlink(l, n);
+            nodeRelease(l, n);
+            return true;
+        }
+    }
+
+    return false;
+}
+
+/**
+ * llRemoveNode
+ * 
+ * Remove da lista o nó informado (obtido por `llAddNode`) em O(1), sem liberar o elemento armazenado.
+ * 
+ * Parâmetros:
+ *  - `l`: Ponteiro para a lista encadeada que contém o nó.
+ *  - `n`: Nó a ser removido.
+ * 
+ * Retorna:
+ *  - `true` se o nó foi removido.
+ *  - `false` se a lista ou o nó forem `NULL`.
+ */
+bool llRemoveNode(LinkedList* l, Node* n) {
+    if(l == NULL || n == NULL)
+        return false;
+
+    llUnlink(l, n);
+    nodeRelease(l, n);
+
+    return true;
+}
+
+/**
+ * mergeNodes
+ * 
+ * Função auxiliar que intercala duas sequências ordenadas de nós (encadeadas por `next`).
+ * Em caso de empate o nó de `a` vem primeiro, o que torna a ordenação estável.
+ * 
+ * Parâmetros:
+ *  - `a`: Primeira sequência (elementos que estavam antes na lista).
+ *  - `b`: Segunda sequência.
+ *  - `f`: Função de comparação.
+ *  - `ctx`: Contexto repassado a `f`.
+ * 
+ * Retorna:
+ *  - O primeiro nó da sequência intercalada.
+ */
+static Node* mergeNodes(Node* a, Node* b, orderCtxFunc f, void* ctx) {
+    Node head;
+    Node* tail = &head;
+
+    while(a != NULL && b != NULL) {
+        if(f(b->data, a->data, ctx) == less_than) {
+            tail->next = b;
+            b = b->next;
+        } else {
+            tail->next = a;
+            a = a->next;
+        }
+        tail = tail->next;
+    }
+
+    tail->next = a != NULL ? a : b;
+    return head.next;
+}
+
+/**
+ * mergeSortNodes
+ * 
+ * Função auxiliar que ordena por intercalação (merge sort) os `n` primeiros nós a partir de `first`.
+ * A profundidade de recursão é O(log n).
+ * 
+ * Parâmetros:
+ *  - `first`: Primeiro nó da sequência.
+ *  - `n`: Quantidade de nós da sequência.
+ *  - `f`: Função de comparação.
+ *  - `ctx`: Contexto repassado a `f`.
+ * 
+ * Retorna:
+ *  - O primeiro nó da sequência ordenada (o último nó aponta para `NULL`).
+ */
+static Node* mergeSortNodes(Node* first, int n, orderCtxFunc f, void* ctx) {
+    Node* middle;
+    Node* beforeMiddle;
+    int half = n / 2;
+    int i;
+
+    if(n <= 1) {
+        if(first != NULL)
+            first->next = NULL;
+        return first;
+    }
+
+    beforeMiddle = first;
+    for(i = 1; i < half; i++)
+        beforeMiddle = beforeMiddle->next;
+    middle = beforeMiddle->next;
+    beforeMiddle->next = NULL;
+
+    return mergeNodes(mergeSortNodes(first, half, f, ctx), mergeSortNodes(middle, n - half, f, ctx), f, ctx);
+}
+
+/**
+ * llSortCtx
+ * 
+ * Variante de `llSort` cuja função de comparação recebe o contexto `ctx`
+ * (mesma ordenação estável em O(n log n), sem alocar memória).
+ * 
+ * Parâmetros:
+ *  - `l`: Ponteiro para a lista encadeada.
+ *  - `f`: Função de comparação; `f(a, b, ctx) == less_than` coloca `a` antes de `b`.
+ *  - `ctx`: Contexto repassado a `f`.
+ * 
+ * Retorna:
+ *  - `true` se a lista foi ordenada com sucesso.
+ *  - `false` se a lista ou a função de comparação forem `NULL`.
+ */
+bool llSortCtx(LinkedList* l, orderCtxFunc f, void* ctx) {
+    Node* n;
+    Node* prev = NULL;
+
+    if(l == NULL || f == NULL)
+        return false;
+
+    l->first = mergeSortNodes(l->first, l->size, f, ctx);
+
+    // Refaz os ponteiros `prev` e o último nó
+    for(n = l->first; n != NULL; n = n->next) {
+        n->prev = prev;
+        prev = n;
+    }
+    l->last = prev;
+
+    return true;
+}
+
+// Adapta uma `orderFunc` (sem contexto) para a ordenação com contexto
+typedef struct {
+    orderFunc f;
+} OrderAdapter;
+
+static Order orderAdapterCall(void* a, void* b, void* ctx) {
+    return ((OrderAdapter*)ctx)->f(a, b);
+}
+
+/**
+ * llSort
+ * 
+ * Ordena a lista encadeada em ordem crescente segundo `orderFunc`, usando merge sort sobre os nós.
+ * A ordenação é estável (elementos iguais mantêm a ordem relativa) e custa O(n log n),
+ * sem alocar memória. Os nós são reencadeados, não copiados.
+ * 
+ * Parâmetros:
+ *  - `l`: Ponteiro para a lista encadeada.
+ *  - `f`: Função de comparação; `f(a, b) == less_than` coloca `a` antes de `b`.
+ * 
+ * Retorna:
+ *  - `true` se a lista foi ordenada com sucesso.
+ *  - `false` caso haja algum erro (por exemplo, se a lista ou a função de comparação forem `NULL`).
+ */
+bool llSort(LinkedList* l, orderFunc f) {
+    OrderAdapter adapter;
+
+    if(l == NULL || f == NULL)
+        return false;
+
+    adapter.f = f;
+    return llSortCtx(l, orderAdapterCall, &adapter);
+}
+
+/**
+ * nodeCopy
+ * 
+ * Cria uma cópia de um nó da lista, alocada no pool da lista de destino.
+ * 
+ * Parâmetros:
+ *  - `l`: Lista que receberá a cópia.
+ *  - `n`: Ponteiro para o nó a ser copiado.
+ * 
+ * Retorna:
+ *  - Uma cópia do nó ou `NULL` se a alocação falhar.
+ */
+static Node* nodeCopy(LinkedList* l, Node* n) {
+    Node* cp;
+
+    if(n == NULL)
+        return NULL;
+
+    cp = nodeAlloc(l);
+    if(cp == NULL)
+        return NULL;
+
+    cp->data = n->data;
+    cp->next = NULL;
+    cp->prev = NULL;
+    return cp;
+}
+
+/**
+ * llDeepCopy
+ * 
+ * Cria uma cópia profunda de uma parte da lista encadeada, entre os índices `start` e `end`.
+ * 
+ * Parâmetros:
+ *  - `l`: Ponteiro para a lista encadeada.
+ *  - `start`: Índice de início da cópia.
+ *  - `end`: Índice de término da cópia.
+ * 
+ * Retorna:
+ *  - Uma nova lista encadeada contendo a cópia dos elementos entre os índices especificados.
+ *  - `NULL` se ocorrer algum erro (por exemplo, índices inválidos ou falha de alocação).
+ */
+LinkedList* llDeepCopy(LinkedList* l, int start, int end) {
+    LinkedList* lCopy;
+    Node* n;
+    Node* copy;
+    Node* lastCopy;
+    int i;
+
+    if(l == NULL || l->first == NULL || start < 0 || end < start || end > l->size)
+        return NULL;
+
+    lCopy = newLinkedList();
+    if(lCopy == NULL)
+        return NULL;
+
+    n = l->first;
+    for(i=0; i < start; i++)
+        n = n->next;
+
+    copy = nodeCopy(lCopy, n);
+    if(copy == NULL) {
+        llFullFree(lCopy, NULL);
+        return NULL;
+    }
+
+    lCopy->first = copy;
+    lastCopy = copy;
+    for(; i < end; i++) {
+        n = n->next;
+        if(n == NULL)
+            break; // early stop
+        copy = nodeCopy(lCopy, n);
+        if(copy == NULL) {
+            llFullFree(lCopy, NULL);
+            return NULL;
+        }
+        copy->prev = lastCopy;
+        lastCopy->next = copy;
+        lastCopy = copy;
+    }
+
+    lCopy->last = copy;
+    lCopy->size = end-start;
+
+    return lCopy;
+}
+
+/**
+ * llGetSize
+ * 
+ * Retorna o número de elementos presentes na lista encadeada.
+ * 
+ * Parâmetros:
+ *  - `l`: Ponteiro para a lista encadeada.
+ * 
+ * Retorna:
+ *  - O número de elementos na lista, ou `-1` se a lista for `NULL`.
+ */
+int llGetSize(LinkedList* l) {
+    if(l == NULL)
+        return -1;
+
+    return l->size;
+}
+
+/**
+ * llCursor
+ * 
+ * Cria um cursor posicionado no primeiro elemento da lista.
+ * 
+ * Parâmetros:
+ *  - `l`: Ponteiro para a lista encadeada.
+ * 
+ * Retorna:
+ *  - O cursor (fora da lista se ela for `NULL` ou estiver vazia).
+ */
+LLCursor llCursor(LinkedList* l) {
+    LLCursor c;
+
+    c.list = l;
+    c.node = l == NULL ? NULL : l->first;
+    c.index = 0;
+
+    return c;
+}
+
+/**
+ * llCursorValid
+ * 
+ * Verifica se o cursor está sobre um elemento.
+ * 
+ * Parâmetros:
+ *  - `c`: Cursor.
+ * 
+ * Retorna:
+ *  - `true` se o cursor aponta para um nó, `false` caso contrário.
+ */
+bool llCursorValid(const LLCursor* c) {
+    return c != NULL && c->node != NULL;
+}
+
+/**
+ * llCursorGet
+ * 
+ * Obtém o elemento sob o cursor.
+ * 
+ * Parâmetros:
+ *  - `c`: Cursor.
+ * 
+ * Retorna:
+ *  - O elemento, ou `NULL` se o cursor não estiver sobre um nó.
+ */
+void* llCursorGet(const LLCursor* c) {
+    if(!llCursorValid(c))
+        return NULL;
+
+    return c->node->data;
+}
+
+/**
+ * llCursorNext
+ * 
+ * Avança o cursor para o próximo nó.
+ * 
+ * Parâmetros:
+ *  - `c`: Cursor.
+ * 
+ * Retorna:
+ *  - `true` se o cursor está sobre um nó após avançar.
+ */
+bool llCursorNext(LLCursor* c) {
+    if(!llCursorValid(c))
+        return false;
+
+    c->node = c->node->next;
+    c->index++;
+
+    return c->node != NULL;
+}
+
+/**
+ * llCursorPrev
+ * 
+ * Volta o cursor para o nó anterior.
+ * 
+ * Parâmetros:
+ *  - `c`: Cursor.
+ * 
+ * Retorna:
+ *  - `true` se o cursor está sobre um nó após voltar.
+ */
+bool llCursorPrev(LLCursor* c) {
+    if(!llCursorValid(c))
+        return false;
+
+    c->node = c->node->prev;
+    c->index--;
+
+    return c->node != NULL;
+}
+
+/**
+ * llCursorSeek
+ * 
+ * Posiciona o cursor no índice informado, partindo do ponto mais próximo entre a posição atual,
+ * o início e o fim da lista.
+ * 
+ * Parâmetros:
+ *  - `c`: Cursor.
+ *  - `index`: Índice de destino.
+ * 
+ * Retorna:
+ *  - `true` se o cursor foi posicionado.
+ *  - `false` se o índice for inválido (o cursor não é alterado).
+ */
+bool llCursorSeek(LLCursor* c, int index) {
+    LinkedList* l;
+    Node* n;
+    int i;
+
+    if(c == NULL || c->list == NULL || index < 0 || index >= c->list->size)
+        return false;
+
+    l = c->list;
+
+    // Ponto de partida: a posição lembrada, se for a mais próxima; senão a ponta mais próxima
+    if(c->node != NULL && abs(index - c->index) <= index && abs(index - c->index) < l->size - index) {
+        n = c->node;
+        i = c->index;
+    } else if(index <= l->size / 2) {
+        n = l->first;
+        i = 0;
+    } else {
+        n = l->last;
+        i = l->size - 1;
+    }
+
+    for(; i < index; i++)
+        n = n->next;
+    for(; i > index; i--)
+        n = n->prev;
+
+    c->node = n;
+    c->index = index;
+
+    return true;
+}
+
+/**
+ * llCursorForeach
+ * 
+ * Executa `f` para até `count` elementos a partir da posição do cursor, sem alocar nem mover o cursor.
+ * 
+ * Parâmetros:
+ *  - `c`: Cursor com a posição inicial.
+ *  - `count`: Quantidade máxima de elementos.
+ *  - `f`: Função a ser aplicada em cada elemento.
+ * 
+ * Retorna:
+ *  - A quantidade de elementos visitados.
+ */
+int llCursorForeach(const LLCursor* c, int count, foreachFunc f) {
+    Node* n;
+    int i;
+
+    if(!llCursorValid(c) || f == NULL)
+        return 0;
+
+    for(i = 0, n = c->node; i < count && n != NULL; i++, n = n->next)
+        f(n->data);
+
+    return i;
+}
+
+/**
+ * llGetAllocStats
+ * 
+ * Obtém os contadores de alocação das listas feitas pela thread atual.
+ * 
+ * Parâmetros:
+ *  - `nodes`: Recebe a quantidade de nós entregues (sem o pool, seria uma chamada a `malloc` por nó).
+ *  - `chunks`: Recebe a quantidade de blocos alocados com `malloc`.
+ * 
+ * Retorna:
+ *  - `true` se os contadores estão habilitados (compilado com `-DLINKED_LIST_STATS`).
+ *  - `false` caso contrário (os valores recebem `0`).
+ */
+bool llGetAllocStats(long* nodes, long* chunks) {
+#ifdef LINKED_LIST_STATS
+    *nodes = statsNodes;
+    *chunks = statsChunks;
+    return true;
+#else
+    *nodes = 0;
+    *chunks = 0;
+    return false;
+#endif
+}
+
+/**
+ * llResetAllocStats
+ * 
+ * Zera os contadores de alocação das listas da thread atual.
+ */
+void llResetAllocStats() {
+#ifdef LINKED_LIST_STATS
+    statsNodes = 0;
+    statsChunks = 0;
+#endif
+}
+
+#endif
@@ -1,36 +1,89 @@
-#include <stdio.h>
-#include "../inc/service/repo.h"
-#include "../inc/views/view.h"
-
-int main() {
-    bool ok;
-
-    ok = startTimeDB();
-    if(!ok) {
-        printf("Can't start TIME DB, check the var path at inc/service/repo.h");
-        return 1;
-    }
-
-    ok = startPartidaDB();
-    if(!ok) {
-        printf("Can't start PARTIDA DB, check the var path at inc/service/repo.h");
-        return 1;
-    }
-
-    while (1) {
-    char opc = viewMenuPrincipal();
-
-    if (opc == 'Q') break;
-
-    switch (opc) {
-        case '1': viewBuscarTimesPorPrefixo(); break;
-        case '2': viewBuscarPartidas(); break;
-        case '3': viewAtualizarPartida(); break;
-        case '4': viewExcluirPartida(); break;
-        case '5': viewInserirPartida(); break;
-        case '6': viewTabelaClassificacao(); break;
-        }
-    }
-
-    return 0;
+#include <stdio.h>
+#include <string.h>
+#include "../inc/service/repo.h"
+#include "../inc/views/view.h"
+
+// Uso: main [-f texto|csv|json]   -> menu interativo, com as listagens no formato escolhido
+//      main -b [arq]               -> modo de comandos, lendo de `arq` (ou da entrada padrão, sem `arq` ou com `-`)
+//      main -s <socket>            -> modo servidor, atendendo os mesmos comandos por um socket Unix
+int main(int argc, char* argv[]) {
+    FILE* comandos = NULL;
+    const char* caminhoSocket = NULL;
+    FormatoSaida formato;
+    int erros;
+    bool ok;
+    int i;
+
+    for(i = 1; i < argc; i++) {
+        if(strcmp(argv[i], "-f") == 0 && i + 1 < argc && renderParseFormato(argv[i + 1], &formato)) {
+            viewSetFormatoSaida(formato);
+            i++;
+        } else if(strcmp(argv[i], "-b") == 0 && comandos == NULL && caminhoSocket == NULL) {
+            comandos = stdin;
+
+            if(i + 1 < argc && strcmp(argv[i + 1], "-") == 0) {
+                i++;
+            } else if(i + 1 < argc && argv[i + 1][0] != '-') {
+                comandos = fopen(argv[++i], "r");
+                if(comandos == NULL) {
+                    perror(argv[i]);
+                    return 1;
+                }
+            }
+        } else if(strcmp(argv[i], "-s") == 0 && i + 1 < argc && comandos == NULL) {
+            caminhoSocket = argv[++i];
+        } else {
+            fprintf(stderr, "Uso: %s [-f texto|csv|json] [-b [arquivo|-] | -s socket]\n", argv[0]);
+            return 1;
+        }
+    }
+
+    ok = startTimeDB();
+    if(!ok) {
+        printf("Can't start TIME DB, check the var path at inc/service/repo.h");
+        return 1;
+    }
+
+    ok = startPartidaDB();
+    if(!ok) {
+        printf("Can't start PARTIDA DB, check the var path at inc/service/repo.h");
+        return 1;
+    }
+
+    if(caminhoSocket != NULL) {
+        ok = viewServidor(caminhoSocket);
+
+        stopPartidaDB();
+        return ok ? 0 : 1;
+    }
+
+    if(comandos != NULL) {
+        erros = viewExecutarComandos(comandos, stdout);
+
+        if(comandos != stdin)
+            fclose(comandos);
+
+        stopPartidaDB();
+        return erros > 0 ? 2 : 0;
+    }
+
+    while (1) {
+    char opc = viewMenuPrincipal();
+
+    if (opc == 'Q') break;
+
+    switch (opc) {
+        case '1': viewBuscarTimesPorPrefixo(); break;
+        case '2': viewBuscarPartidas(); break;
+        case '3': viewAtualizarPartida(); break;
+        case '4': viewExcluirPartida(); break;
+        case '5': viewInserirPartida(); break;
+        case '6': viewTabelaClassificacao(); break;
+        case '7': viewCheckpoint(); break;
+        }
+    }
+
+    stopPartidaDB();
+
+    return 0;
 }
\ No newline at end of file
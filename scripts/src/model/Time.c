@@ -1,154 +1,244 @@
-#ifndef TIME_C
-#define TIME_C 0
-
-#include <stdlib.h>
-#include "../../inc/service/model.h"
-#include "./../../shared/bool.h"
-
-// Estrutura que representa um time com ID e nome.
-struct Time {
-    int id;                  // ID único do time
-    char name[TIME_MAX_NAME_SIZE]; // Nome do time
-};
-
-/**
- * tSetName
- * 
- * Define o nome do time na estrutura `Time`, garantindo que o nome não ultrapasse o tamanho máximo especificado por `TIME_MAX_NAME_SIZE`.
- * 
- * Parâmetros:
- *  - `t`: Ponteiro para o time.
- *  - `n`: Nome do time (string) a ser atribuído ao time.
- */
-static void tSetName(Time* t, const char* n) {
-    int i;
-    char c;
-
-    for(i = 0; i < TIME_MAX_NAME_SIZE; i++)
-    {
-        c = n[i];
-        t->name[i] = c;
-        if(c == '\0')
-            return;
-    }
-    
-    t->name[TIME_MAX_NAME_SIZE] = '\0'; // Garante que a string será terminada com '\0'
-}
-
-/**
- * newTime
- * 
- * Cria um novo time com um ID e um nome fornecidos.
- * 
- * Parâmetros:
- *  - `id`: ID único do time.
- *  - `name`: Nome do time (string).
- * 
- * Retorna:
- *  - Um ponteiro para a nova instância de `Time`, ou `NULL` se a alocação de memória falhar.
- */
-Time* newTime(const int id, const char name[TIME_MAX_NAME_SIZE]) {
-    Time* t = (Time*)malloc(sizeof(Time));
-    if(t == NULL)
-        return NULL;
-
-    t->id = id;
-    tSetName(t, name);
-    
-    return t;
-}
-
-/**
- * freeTime
- * 
- * Libera a memória alocada para o time.
- * 
- * Parâmetros:
- *  - `t`: Ponteiro para o time a ser liberado.
- */
-void freeTime(void* t) {
-    if(t == NULL)
-        return;
-
-    free(t);
-}
-
-/**
- * timeGetId
- * 
- * Obtém o ID do time.
- * 
- * Parâmetros:
- *  - `t`: Ponteiro para o time.
- * 
- * Retorna:
- *  - O ID do time, ou `TIME_NOT_FOUND_FLAG` se o ponteiro para o time for `NULL`.
- */
-int timeGetId(const Time* t) {
-    if(t == NULL)
-        return TIME_NOT_FOUND_FLAG;
-
-    return t->id;
-}
-
-/**
- * timeSetId
- * 
- * Define o ID de um time.
- * 
- * Parâmetros:
- *  - `t`: Ponteiro para o time.
- *  - `id`: Novo ID do time.
- * 
- * Retorna:
- *  - `true` se o ID foi definido com sucesso.
- *  - `false` se o ponteiro para o time for `NULL` ou o ID for inválido (menor que 0).
- */
-bool timeSetId(Time* t, const int id) {
-    if(t == NULL || id < 0)
-        return false;
-    
-    t->id = id;
-    return true;
-}
-
-/**
- * timeGetName
- * 
- * Obtém o nome do time.
- * 
- * Parâmetros:
- *  - `t`: Ponteiro para o time.
- * 
- * Retorna:
- *  - O nome do time (string), ou `NULL` se o ponteiro para o time for `NULL`.
- */
-char* timeGetName(Time* t) {
-    if(t == NULL)
-        return NULL;
-
-    return t->name;
-}
-
-/**
- * timeSetName
- * 
- * Define o nome de um time.
- * 
- * Parâmetros:
- *  - `t`: Ponteiro para o time.
- *  - `new_nome`: Novo nome do time (string).
- * 
- * Retorna:
- *  - `true` se o nome foi definido com sucesso.
- *  - `false` se o ponteiro para o time for `NULL`.
- */
-bool timeSetName(Time* t, char new_nome[TIME_MAX_NAME_SIZE]) {
-    if(t == NULL)
-        return false;
-
-    tSetName(t, new_nome);
-    return true;
-}
-
-#endif
+#ifndef TIME_C
+#define TIME_C 0
+
+#include <stdlib.h>
+#include "../../inc/service/model.h"
+#include "./../../shared/bool.h"
+
+// Estrutura que representa um time com ID e nome.
+struct Time {
+    int id;                  // ID único do time
+    char name[TIME_MAX_NAME_SIZE]; // Nome do time
+    char normalizado[TIME_MAX_NAME_SIZE]; // Nome sem caixa nem acentos (chave das buscas normalizadas)
+};
+
+// Letra sem acento de cada caractere de U+00C0 a U+00FF ('-': não há, só a caixa muda)
+static const char timeLatin1Base[64 + 1] =
+    "aaaaaa-ceeeeiiiidnooooo-ouuuuy--"
+    "aaaaaa-ceeeeiiiidnooooo-ouuuuy-y";
+
+/**
+ * timeNormalizeLatin1
+ * 
+ * Normaliza um caractere de U+00C0 a U+00FF: a letra sem acento, ou a minúscula quando não há
+ * letra equivalente (Æ -> æ); `×`, `÷`, `ß` e as minúsculas sem equivalente ficam como estão.
+ */
+static int timeNormalizeLatin1(int c) {
+    char base = timeLatin1Base[c - 0xC0];
+
+    if(base != '-')
+        return base;
+
+    if(c <= 0xDE && c != 0xD7)
+        return c + 0x20;
+
+    return c;
+}
+
+/**
+ * tSetName
+ * 
+ * Define o nome do time na estrutura `Time`, garantindo que o nome não ultrapasse o tamanho máximo especificado por `TIME_MAX_NAME_SIZE`
+ * (até `TIME_MAX_NAME_SIZE - 1` caracteres mais o `'\0'`, que ocupa a última posição do vetor).
+ * 
+ * Parâmetros:
+ *  - `t`: Ponteiro para o time.
+ *  - `n`: Nome do time (string) a ser atribuído ao time.
+ */
+static void tSetName(Time* t, const char* n) {
+    int i;
+    char c;
+
+    for(i = 0; i < TIME_MAX_NAME_SIZE - 1; i++)
+    {
+        c = n[i];
+        t->name[i] = c;
+        if(c == '\0')
+            break;
+    }
+    
+    t->name[TIME_MAX_NAME_SIZE - 1] = '\0'; // Garante que a string será terminada com '\0' dentro do vetor
+    timeNormalizeName(t->name, t->normalizado);
+}
+
+/**
+ * newTime
+ * 
+ * Cria um novo time com um ID e um nome fornecidos.
+ * 
+ * Parâmetros:
+ *  - `id`: ID único do time.
+ *  - `name`: Nome do time (string).
+ * 
+ * Retorna:
+ *  - Um ponteiro para a nova instância de `Time`, ou `NULL` se a alocação de memória falhar.
+ */
+Time* newTime(const int id, const char name[TIME_MAX_NAME_SIZE]) {
+    Time* t = (Time*)malloc(sizeof(Time));
+    if(t == NULL)
+        return NULL;
+
+    t->id = id;
+    tSetName(t, name);
+    
+    return t;
+}
+
+/**
+ * freeTime
+ * 
+ * Libera a memória alocada para o time.
+ * 
+ * Parâmetros:
+ *  - `t`: Ponteiro para o time a ser liberado.
+ */
+void freeTime(void* t) {
+    if(t == NULL)
+        return;
+
+    free(t);
+}
+
+/**
+ * timeGetId
+ * 
+ * Obtém o ID do time.
+ * 
+ * Parâmetros:
+ *  - `t`: Ponteiro para o time.
+ * 
+ * Retorna:
+ *  - O ID do time, ou `TIME_NOT_FOUND_FLAG` se o ponteiro para o time for `NULL`.
+ */
+int timeGetId(const Time* t) {
+    if(t == NULL)
+        return TIME_NOT_FOUND_FLAG;
+
+    return t->id;
+}
+
+/**
+ * timeSetId
+ * 
+ * Define o ID de um time.
+ * 
+ * Parâmetros:
+ *  - `t`: Ponteiro para o time.
+ *  - `id`: Novo ID do time.
+ * 
+ * Retorna:
+ *  - `true` se o ID foi definido com sucesso.
+ *  - `false` se o ponteiro para o time for `NULL` ou o ID for inválido (menor que 0).
+ */
+bool timeSetId(Time* t, const int id) {
+    if(t == NULL || id < 0)
+        return false;
+    
+    t->id = id;
+    return true;
+}
+
+/**
+ * timeGetName
+ * 
+ * Obtém o nome do time.
+ * 
+ * Parâmetros:
+ *  - `t`: Ponteiro para o time.
+ * 
+ * Retorna:
+ *  - O nome do time (string), ou `NULL` se o ponteiro para o time for `NULL`.
+ */
+char* timeGetName(Time* t) {
+    if(t == NULL)
+        return NULL;
+
+    return t->name;
+}
+
+/**
+ * timeSetName
+ * 
+ * Define o nome de um time.
+ * 
+ * Parâmetros:
+ *  - `t`: Ponteiro para o time.
+ *  - `new_nome`: Novo nome do time (string).
+ * 
+ * Retorna:
+ *  - `true` se o nome foi definido com sucesso.
+ *  - `false` se o ponteiro para o time for `NULL`.
+ */
+bool timeSetName(Time* t, char new_nome[TIME_MAX_NAME_SIZE]) {
+    if(t == NULL)
+        return false;
+
+    tSetName(t, new_nome);
+    return true;
+}
+
+/**
+ * timeGetNormalizedName
+ * 
+ * Obtém o nome normalizado do time, calculado por `tSetName`.
+ * 
+ * Parâmetros:
+ *  - `t`: Ponteiro para o time.
+ * 
+ * Retorna:
+ *  - O nome normalizado (string), ou `NULL` se o ponteiro para o time for `NULL`.
+ */
+char* timeGetNormalizedName(Time* t) {
+    if(t == NULL)
+        return NULL;
+
+    return t->normalizado;
+}
+
+/**
+ * timeNormalizeName
+ * 
+ * Normaliza o nome byte a byte: `A-Z` viram minúsculas; um par UTF-8 `0xC3 0x80-0xBF` (U+00C0 a U+00FF)
+ * vira a letra sem acento; um byte `>= 0xC0` que não inicia uma sequência UTF-8 é lido como Latin-1.
+ * As demais sequências UTF-8 são copiadas sem alteração.
+ * 
+ * Parâmetros:
+ *  - `nome`: Nome a ser normalizado.
+ *  - `chave`: Destino do nome normalizado.
+ */
+void timeNormalizeName(const char* nome, char chave[TIME_MAX_NAME_SIZE]) {
+    const unsigned char* s = (const unsigned char*)nome;
+    bool continuacao;
+    int i = 0;
+    int j = 0;
+    int c;
+
+    while(i < TIME_MAX_NAME_SIZE - 1 && s[i] != '\0') {
+        c = s[i];
+        continuacao = i + 1 < TIME_MAX_NAME_SIZE - 1 && s[i + 1] >= 0x80 && s[i + 1] <= 0xBF;
+
+        if(c == 0xC3 && continuacao) {
+            c = timeNormalizeLatin1(s[i + 1] + 0x40);
+            if(c < 0x80) {
+                chave[j++] = (char)c;
+            } else {
+                chave[j++] = (char)0xC3;
+                chave[j++] = (char)(c - 0x40);
+            }
+            i += 2;
+            continue;
+        }
+
+        if(c >= 'A' && c <= 'Z')
+            c += 'a' - 'A';
+        else if(c >= 0xC0 && !continuacao)
+            c = timeNormalizeLatin1(c);
+
+        chave[j++] = (char)c;
+        i++;
+    }
+
+    chave[j] = '\0';
+}
+
+#endif
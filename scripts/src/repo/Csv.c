@@ -0,0 +1,390 @@
+#ifndef CSV_C
+#define CSV_C 0
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <limits.h>
+
+#include "./../../inc/service/csv.h"
+
+// Capacidade inicial do vetor de campos de uma linha
+#define CSV_INITIAL_FIELDS 8
+
+// Campo de uma linha, apontando para dentro do buffer
+typedef struct {
+    const char* start;
+    int len;
+} CsvField;
+
+struct CsvReader {
+    FILE* f;            // Arquivo lido (`NULL` quando o leitor percorre um bloco de memória)
+    char sep;           // Separador de campos
+    char* buffer;       // Bloco lido do arquivo
+    bool ownsBuffer;    // `false` quando `buffer` pertence a quem chamou `csvOpenMemory`
+    size_t capacity;    // Tamanho alocado de `buffer`
+    size_t next;        // Início da próxima linha em `buffer`
+    size_t end;         // Fim dos dados válidos em `buffer`
+    bool eof;           // `true` quando o arquivo já foi lido até o fim
+    long row;           // Número da linha atual (a partir de 1, sem `rowBase`)
+    long rowBase;       // Linhas antes do início do bloco lido (ver `csvSetRowBase`)
+    CsvField* fields;   // Campos da linha atual
+    int fieldCount;     // Quantidade de campos da linha atual
+    int fieldCapacity;  // Posições alocadas em `fields`
+    bool failed;        // `true` se houve erro
+    long errorRow;      // Linha do erro (sem `rowBase`)
+    int errorCol;       // Coluna do erro (a partir de 0), ou `-1`
+    const char* errorMsg;  // Descrição do erro
+    char error[128];    // Mensagem formatada por `csvGetError`
+};
+
+/**
+ * csvFail
+ * 
+ * Registra um erro na coluna `col` (a partir de 0) da linha atual; `col < 0` omite a coluna.
+ */
+static bool csvFail(CsvReader* r, int col, const char* msg) {
+    r->failed = true;
+    r->errorRow = r->row;
+    r->errorCol = col;
+    r->errorMsg = msg;
+
+    return false;
+}
+
+/**
+ * csvFill
+ * 
+ * Move o resto não consumido para o início do buffer (dobrando-o se ele já estiver cheio)
+ * e lê mais um bloco do arquivo.
+ * 
+ * Retorna:
+ *  - `true` se a operação foi bem-sucedida (mesmo que nada tenha sido lido no fim do arquivo).
+ *  - `false` se faltou memória ou a leitura falhou.
+ */
+static bool csvFill(CsvReader* r) {
+    size_t resto = r->end - r->next;
+    size_t lidos;
+    char* maior;
+
+    if(r->next > 0) {
+        memmove(r->buffer, r->buffer + r->next, resto);
+        r->next = 0;
+        r->end = resto;
+    }
+
+    // Uma linha maior que o buffer inteiro: cresce em vez de truncar
+    if(r->end == r->capacity) {
+        maior = (char*)realloc(r->buffer, r->capacity * 2);
+        if(maior == NULL)
+            return csvFail(r, -1, "memoria insuficiente");
+        r->buffer = maior;
+        r->capacity *= 2;
+    }
+
+    lidos = fread(r->buffer + r->end, 1, r->capacity - r->end, r->f);
+    r->end += lidos;
+
+    if(lidos == 0) {
+        if(ferror(r->f))
+            return csvFail(r, -1, "erro de leitura");
+        r->eof = true;
+    }
+
+    return true;
+}
+
+/**
+ * csvSplit
+ * 
+ * Separa a linha `[start, start + len)` em campos.
+ * 
+ * Retorna:
+ *  - `true` se a operação foi bem-sucedida, `false` se faltou memória.
+ */
+static bool csvSplit(CsvReader* r, const char* start, size_t len) {
+    const char* fim = start + len;
+    const char* sep;
+    CsvField* maior;
+
+    r->fieldCount = 0;
+
+    while(true) {
+        if(r->fieldCount == r->fieldCapacity) {
+            maior = (CsvField*)realloc(r->fields, sizeof(CsvField) * r->fieldCapacity * 2);
+            if(maior == NULL)
+                return csvFail(r, -1, "memoria insuficiente");
+            r->fields = maior;
+            r->fieldCapacity *= 2;
+        }
+
+        sep = (const char*)memchr(start, r->sep, fim - start);
+        if(sep == NULL)
+            sep = fim;
+
+        r->fields[r->fieldCount].start = start;
+        r->fields[r->fieldCount].len = (int)(sep - start);
+        r->fieldCount++;
+
+        if(sep == fim)
+            return true;
+        start = sep + 1;
+    }
+}
+
+/**
+ * csvOpen
+ * 
+ * Abre o arquivo e aloca o buffer de leitura e o vetor de campos.
+ * 
+ * Retorna:
+ *  - O leitor, ou `NULL` em caso de erro.
+ */
+CsvReader* csvOpen(const char* path, char sep) {
+    CsvReader* r = (CsvReader*)calloc(1, sizeof(CsvReader));
+    if(r == NULL)
+        return NULL;
+
+    r->f = fopen(path, "rb");
+    r->buffer = (char*)malloc(CSV_BUFFER_SIZE);
+    r->ownsBuffer = true;
+    r->fields = (CsvField*)malloc(sizeof(CsvField) * CSV_INITIAL_FIELDS);
+
+    if(r->f == NULL || r->buffer == NULL || r->fields == NULL) {
+        if(r->f == NULL)
+            perror("fopen");
+        csvClose(r);
+        return NULL;
+    }
+
+    r->sep = sep;
+    r->capacity = CSV_BUFFER_SIZE;
+    r->fieldCapacity = CSV_INITIAL_FIELDS;
+
+    return r;
+}
+
+/**
+ * csvOpenMemory
+ * 
+ * Cria um leitor sobre `len` bytes já em memória, sem cópia.
+ * 
+ * Retorna:
+ *  - O leitor, ou `NULL` se faltar memória.
+ */
+CsvReader* csvOpenMemory(const char* data, size_t len, char sep) {
+    CsvReader* r = (CsvReader*)calloc(1, sizeof(CsvReader));
+    if(r == NULL)
+        return NULL;
+
+    r->fields = (CsvField*)malloc(sizeof(CsvField) * CSV_INITIAL_FIELDS);
+    if(r->fields == NULL) {
+        free(r);
+        return NULL;
+    }
+
+    // O bloco inteiro já está disponível: `csvFill` nunca é chamado e o buffer não é alterado
+    r->buffer = (char*)data;
+    r->capacity = len;
+    r->end = len;
+    r->eof = true;
+    r->sep = sep;
+    r->fieldCapacity = CSV_INITIAL_FIELDS;
+
+    return r;
+}
+
+/**
+ * csvNextRow
+ * 
+ * Procura o próximo `\n` no buffer (lendo mais blocos quando necessário) e separa os campos
+ * da linha encontrada. A última linha pode terminar sem `\n`.
+ * 
+ * Retorna:
+ *  - `true` se há uma nova linha, `false` no fim do arquivo ou em caso de erro.
+ */
+bool csvNextRow(CsvReader* r) {
+    char* start;
+    char* nl;
+    size_t len;
+
+    if(r->failed)
+        return false;
+
+    while(true) {
+        start = r->buffer + r->next;
+        nl = (char*)memchr(start, '\n', r->end - r->next);
+
+        if(nl == NULL && !r->eof) {
+            if(!csvFill(r))
+                return false;
+            continue;
+        }
+
+        if(nl == NULL) {
+            // Fim do arquivo: a última linha pode não ter `\n`
+            if(r->next == r->end)
+                return false;
+            len = r->end - r->next;
+            r->next = r->end;
+        } else {
+            len = (size_t)(nl - start);
+            r->next += len + 1;
+        }
+
+        r->row++;
+        if(len > 0 && start[len - 1] == '\r')
+            len--;
+
+        if(len > 0)
+            return csvSplit(r, start, len);
+    }
+}
+
+/**
+ * csvGetRow
+ * 
+ * Retorna o número da linha atual.
+ */
+long csvGetRow(CsvReader* r) {
+    return r->rowBase + r->row;
+}
+
+/**
+ * csvSetRowBase
+ * 
+ * Define quantas linhas do arquivo vêm antes do bloco lido.
+ */
+void csvSetRowBase(CsvReader* r, long rows) {
+    r->rowBase = rows;
+}
+
+/**
+ * csvGetFieldCount
+ * 
+ * Retorna a quantidade de campos da linha atual.
+ */
+int csvGetFieldCount(CsvReader* r) {
+    return r->fieldCount;
+}
+
+/**
+ * csvGetField
+ * 
+ * Retorna o início do campo `col` da linha atual (com o tamanho em `len`), ou `NULL`.
+ */
+const char* csvGetField(CsvReader* r, int col, int* len) {
+    if(col < 0 || col >= r->fieldCount)
+        return NULL;
+
+    *len = r->fields[col].len;
+    return r->fields[col].start;
+}
+
+/**
+ * csvGetInt
+ * 
+ * Converte o campo `col` em `int`, acumulando os dígitos em negativo para aceitar `INT_MIN`.
+ * 
+ * Retorna:
+ *  - `true` se o campo é um inteiro válido, `false` caso contrário.
+ */
+bool csvGetInt(CsvReader* r, int col, int* out) {
+    const char* s;
+    const char* fim;
+    bool negativo = false;
+    int len, v = 0, d;
+
+    s = csvGetField(r, col, &len);
+    if(s == NULL)
+        return csvFail(r, col, "coluna ausente");
+    fim = s + len;
+
+    if(s < fim && (*s == '-' || *s == '+')) {
+        negativo = *s == '-';
+        s++;
+    }
+
+    if(s == fim)
+        return csvFail(r, col, "inteiro esperado");
+
+    for(; s < fim; s++) {
+        if(*s < '0' || *s > '9')
+            return csvFail(r, col, "inteiro invalido");
+
+        d = *s - '0';
+        if(v < (INT_MIN + d) / 10)
+            return csvFail(r, col, "inteiro fora do intervalo");
+        v = v * 10 - d;
+    }
+
+    if(!negativo) {
+        if(v == INT_MIN)
+            return csvFail(r, col, "inteiro fora do intervalo");
+        v = -v;
+    }
+
+    *out = v;
+    return true;
+}
+
+/**
+ * csvGetString
+ * 
+ * Copia o campo `col` para `out` (com `size` posições, incluindo o terminador).
+ * 
+ * Retorna:
+ *  - `true` se o campo existe e cabe, `false` caso contrário.
+ */
+bool csvGetString(CsvReader* r, int col, char* out, int size) {
+    const char* s;
+    int len;
+
+    s = csvGetField(r, col, &len);
+    if(s == NULL)
+        return csvFail(r, col, "coluna ausente");
+
+    if(len >= size)
+        return csvFail(r, col, "texto longo demais");
+
+    memcpy(out, s, len);
+    out[len] = '\0';
+
+    return true;
+}
+
+/**
+ * csvGetError
+ * 
+ * Formata a descrição do último erro (com a linha já somada a `rowBase`), ou retorna `NULL`.
+ */
+const char* csvGetError(CsvReader* r) {
+    if(!r->failed)
+        return NULL;
+
+    if(r->errorCol < 0)
+        snprintf(r->error, sizeof(r->error), "linha %ld: %s", r->rowBase + r->errorRow, r->errorMsg);
+    else
+        snprintf(r->error, sizeof(r->error), "linha %ld, coluna %d: %s", r->rowBase + r->errorRow, r->errorCol + 1, r->errorMsg);
+
+    return r->error;
+}
+
+/**
+ * csvClose
+ * 
+ * Fecha o arquivo e libera o leitor (aceita um leitor parcialmente aberto).
+ */
+void csvClose(CsvReader* r) {
+    if(r == NULL)
+        return;
+
+    if(r->f != NULL)
+        fclose(r->f);
+    if(r->ownsBuffer)
+        free(r->buffer);
+    free(r->fields);
+    free(r);
+}
+
+#endif
@@ -0,0 +1,225 @@
+#ifndef PARTIDA_COLUMNS_C
+#define PARTIDA_COLUMNS_C 0
+
+#include <stdlib.h>
+#include <string.h>
+
+#ifdef __SSE2__
+    #include <emmintrin.h>
+#endif
+
+#include "./../../inc/service/columns.h"
+
+/**
+ * partidaColumnsFits
+ * 
+ * Verifica se os valores cabem nos tipos estreitos das colunas.
+ */
+bool partidaColumnsFits(int t1, int t2, int golsT1, int golsT2) {
+    return t1 >= 0 && t1 <= PARTIDA_COLUMNS_MAX_TIME && t2 >= 0 && t2 <= PARTIDA_COLUMNS_MAX_TIME &&
+           golsT1 >= 0 && golsT1 <= PARTIDA_COLUMNS_MAX_GOLS && golsT2 >= 0 && golsT2 <= PARTIDA_COLUMNS_MAX_GOLS;
+}
+
+/**
+ * partidaColumnsRealloc
+ * 
+ * Realoca uma coluna para `capacity` linhas, mantendo o vetor antigo se faltar memória.
+ * 
+ * Retorna:
+ *  - `true` se a coluna foi realocada.
+ */
+static bool partidaColumnsRealloc(void** coluna, int capacity, size_t size) {
+    void* resized = realloc(*coluna, size * capacity);
+
+    if(resized == NULL)
+        return false;
+
+    *coluna = resized;
+    return true;
+}
+
+/**
+ * partidaColumnsGrow
+ * 
+ * Dobra a capacidade de todas as colunas. Se uma realocação falhar, as colunas já realocadas
+ * continuam válidas (só maiores) e a capacidade não muda.
+ * 
+ * Retorna:
+ *  - `true` se as colunas comportam mais uma linha.
+ */
+static bool partidaColumnsGrow(PartidaColumns* c) {
+    int capacity = c->capacity > 0 ? c->capacity * 2 : PARTIDA_COLUMNS_INITIAL_CAPACITY;
+
+    if(!partidaColumnsRealloc((void**)&c->id, capacity, sizeof(int32_t)) ||
+       !partidaColumnsRealloc((void**)&c->t1, capacity, sizeof(uint16_t)) ||
+       !partidaColumnsRealloc((void**)&c->t2, capacity, sizeof(uint16_t)) ||
+       !partidaColumnsRealloc((void**)&c->golsT1, capacity, sizeof(uint8_t)) ||
+       !partidaColumnsRealloc((void**)&c->golsT2, capacity, sizeof(uint8_t)))
+        return false;
+
+    c->capacity = capacity;
+    return true;
+}
+
+/**
+ * partidaColumnsAppend
+ * 
+ * Adiciona uma partida ao final das colunas.
+ * 
+ * Retorna:
+ *  - A linha da nova partida, ou `-1` se ela não cabe ou faltou memória.
+ */
+int partidaColumnsAppend(PartidaColumns* c, int id, int t1, int t2, int golsT1, int golsT2) {
+    if(!partidaColumnsFits(t1, t2, golsT1, golsT2))
+        return -1;
+
+    if(c->count == c->capacity && !partidaColumnsGrow(c))
+        return -1;
+
+    c->id[c->count] = id;
+    c->t1[c->count] = (uint16_t)t1;
+    c->t2[c->count] = (uint16_t)t2;
+    c->golsT1[c->count] = (uint8_t)golsT1;
+    c->golsT2[c->count] = (uint8_t)golsT2;
+
+    return c->count++;
+}
+
+/**
+ * partidaColumnsRemoveAt
+ * 
+ * Remove a linha `row`, movendo a última para o seu lugar.
+ * 
+ * Retorna:
+ *  - `true` se uma linha foi movida para `row`.
+ */
+bool partidaColumnsRemoveAt(PartidaColumns* c, int row) {
+    int last;
+
+    if(row < 0 || row >= c->count)
+        return false;
+
+    last = --c->count;
+    if(row == last)
+        return false;
+
+    c->id[row] = c->id[last];
+    c->t1[row] = c->t1[last];
+    c->t2[row] = c->t2[last];
+    c->golsT1[row] = c->golsT1[last];
+    c->golsT2[row] = c->golsT2[last];
+
+    return true;
+}
+
+/**
+ * partidaColumnsSetGols
+ * 
+ * Troca os gols da linha `row`.
+ * 
+ * Retorna:
+ *  - `true` se os gols foram gravados, `false` se a linha é inválida ou os gols não cabem.
+ */
+bool partidaColumnsSetGols(PartidaColumns* c, int row, int golsT1, int golsT2) {
+    if(row < 0 || row >= c->count || !partidaColumnsFits(0, 0, golsT1, golsT2))
+        return false;
+
+    c->golsT1[row] = (uint8_t)golsT1;
+    c->golsT2[row] = (uint8_t)golsT2;
+
+    return true;
+}
+
+/**
+ * partidaColumnsResultados
+ * 
+ * Calcula o resultado do time 1 em `m` partidas: `0` = vitória, `1` = empate, `2` = derrota
+ * (o do time 2 é `2 - resultado`). Com SSE2, 16 partidas por instrução: `2 * (g1 <= g2) - (g1 == g2)`;
+ * o restante (ou tudo, sem SSE2) vai pelo laço escalar sem desvios.
+ */
+static void partidaColumnsResultados(const uint8_t* g1, const uint8_t* g2, uint8_t* resultado, int m) {
+    int i = 0;
+
+#ifdef __SSE2__
+    const __m128i um = _mm_set1_epi8(1);
+    const __m128i dois = _mm_set1_epi8(2);
+    __m128i a, b, menorOuIgual, igual;
+
+    for(; i + 16 <= m; i += 16) {
+        a = _mm_loadu_si128((const __m128i*)(g1 + i));
+        b = _mm_loadu_si128((const __m128i*)(g2 + i));
+        menorOuIgual = _mm_cmpeq_epi8(_mm_max_epu8(a, b), b);
+        igual = _mm_cmpeq_epi8(a, b);
+        _mm_storeu_si128((__m128i*)(resultado + i),
+                         _mm_sub_epi8(_mm_and_si128(menorOuIgual, dois), _mm_and_si128(igual, um)));
+    }
+#endif
+
+    for(; i < m; i++)
+        resultado[i] = (uint8_t)((g1[i] <= g2[i]) + (g1[i] < g2[i]));
+}
+
+/**
+ * partidaColumnsEstatisticas
+ * 
+ * Soma às estatísticas o resultado de todas as partidas, bloco a bloco.
+ * 
+ * Retorna:
+ *  - `true` se as estatísticas foram somadas, `false` se faltou memória.
+ */
+bool partidaColumnsEstatisticas(const PartidaColumns* c, TimeEstatisticas* stats, int n) {
+    uint8_t resultado[PARTIDA_COLUMNS_BLOCK];
+    int (*contagem)[3];  // Por time: vitórias, empates e derrotas
+    int inicio;
+    int m;
+    int i;
+
+    contagem = (int (*)[3])calloc(n > 0 ? n : 1, sizeof(*contagem));
+    if(contagem == NULL)
+        return false;
+
+    for(inicio = 0; inicio < c->count; inicio += PARTIDA_COLUMNS_BLOCK) {
+        const uint16_t* t1 = c->t1 + inicio;
+        const uint16_t* t2 = c->t2 + inicio;
+        const uint8_t* g1 = c->golsT1 + inicio;
+        const uint8_t* g2 = c->golsT2 + inicio;
+
+        m = c->count - inicio < PARTIDA_COLUMNS_BLOCK ? c->count - inicio : PARTIDA_COLUMNS_BLOCK;
+
+        partidaColumnsResultados(g1, g2, resultado, m);
+
+        for(i = 0; i < m; i++) {
+            contagem[t1[i]][resultado[i]]++;
+            contagem[t2[i]][2 - resultado[i]]++;
+            stats[t1[i]].gm += g1[i];
+            stats[t1[i]].gs += g2[i];
+            stats[t2[i]].gm += g2[i];
+            stats[t2[i]].gs += g1[i];
+        }
+    }
+
+    for(i = 0; i < n; i++) {
+        stats[i].vitorias += contagem[i][0];
+        stats[i].empates += contagem[i][1];
+        stats[i].derrotas += contagem[i][2];
+    }
+
+    free(contagem);
+    return true;
+}
+
+/**
+ * partidaColumnsFree
+ * 
+ * Libera as colunas, deixando-as vazias.
+ */
+void partidaColumnsFree(PartidaColumns* c) {
+    free(c->id);
+    free(c->t1);
+    free(c->t2);
+    free(c->golsT1);
+    free(c->golsT2);
+    memset(c, 0, sizeof(*c));
+}
+
+#endif
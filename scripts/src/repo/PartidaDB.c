@@ -1,385 +1,2555 @@
-#ifndef PARTIDA_DB_C
-#define PARTIDA_DB_C 0
-
-#include <stdio.h>
-
-#include "./../../inc/service/repo.h"
-#include "./../../inc/collections/LinkedList.h"
-
-// Estrutura que representa o banco de dados de partidas.
-struct PartidaDB {
-    LinkedList* partidas;  // Lista de partidas
-};
-
-// Instância global do banco de dados de partidas
-static PartidaDB partidaDB;
-static int partidaIDSearch;  // ID da partida sendo pesquisada
-Partida* partidaJournal = NULL;  // Partida em transação
-
-/**
- * partidaDBStartInsertTransaction
- * 
- * Inicia uma transação de inserção para a partida.
- * 
- * Retorna:
- *  - `true` se a transação de inserção já não estiver em andamento.
- *  - `false` caso contrário (se já houver uma transação aberta).
- */
-bool partidaDBStartInsertTransaction() {
-    if(partidaJournal == NULL)
-        return true;
-    return false;
-}
-
-/**
- * partidaDBInsertCommit
- * 
- * Commit da transação de inserção, adicionando a partida ao banco de dados de partidas.
- * 
- * Retorna:
- *  - `true` se a operação foi bem-sucedida.
- *  - `false` caso contrário (em caso de falha na adição).
- */
-bool partidaDBInsertCommit() {
-    bool ok;
-
-    ok = sllAdd(partidaDB.partidas, partidaJournal);
-    if(!ok) {
-        return false;
-    }
-    partidaJournal = NULL;
-
-    return true;
-}
-
-/**
- * partidaDBInsertRollBack
- * 
- * Cancela a transação de inserção, liberando a memória alocada para a partida em transação.
- */
-void partidaDBInsertRollBack() {
-    if(partidaJournal != NULL) {
-        freePartida(partidaJournal);
-        partidaJournal = NULL;
-    }
-}
-
-/**
- * nextPartidaID
- * 
- * Retorna o próximo ID disponível para uma nova partida com base no ID da última partida.
- * 
- * Retorna:
- *  - O próximo ID disponível para uma nova partida.
- */
-static int nextPartidaID() {
-    Partida* last = (Partida*)llGetLast(partidaDB.partidas);
-    return partidaGetId(last) + 1;
-}
-
-/**
- * addPartida
- * 
- * Adiciona uma nova partida ao banco de dados de partidas.
- * 
- * Parâmetros:
- *  - `t1ID`: ID do time 1.
- *  - `t2ID`: ID do time 2.
- *  - `gT1`: Gols do time 1.
- *  - `gT2`: Gols do time 2.
- * 
- * Retorna:
- *  - `SUCCESS` se a partida foi adicionada com sucesso.
- *  - Outros valores para indicar erros específicos (ex: time com IDs iguais, memória insuficiente, time inexistente).
- */
-AddPartidaReponse addPartida(int t1ID, int t2ID, int gT1, int gT2) {
-    Time* t1;
-    Time* t2;
-
-    if(partidaDB.partidas == NULL)
-        return PARTIDA_DATABASE_NOT_STARTED_YET;
-    
-    if(partidaJournal != NULL)
-        return ANOTHER_TRANSACTION_NOT_CLOSE;
-
-    if(t1ID == t2ID)
-        return TIME_1_EQUALS_TIME_2;
-
-    t1 = timeDBGetByID(t1ID);
-    if(t1 == NULL)
-        return TIME_1_DOES_NOT_EXISTS;
-
-    t2 = timeDBGetByID(t2ID);
-    if(t2 == NULL)
-        return TIME_2_DOES_NOT_EXISTS;
-
-    if(llIsEmpty(partidaDB.partidas))
-        partidaJournal = newPartida(0, t1, t2, gT1, gT2);
-    else
-        partidaJournal = newPartida(nextPartidaID(), t1, t2, gT1, gT2);
-
-    if(partidaJournal == NULL) {
-        return MEMORY_NOT_ENOUGH_EXCEPTION;
-    }
-
-    return SUCCESS;
-}
-
-/**
- * partidaFromFile
- * 
- * Cria uma partida a partir de uma string do arquivo CSV.
- * 
- * Parâmetros:
- *  - `buff`: Buffer contendo os dados da partida no formato CSV.
- * 
- * Retorna:
- *  - Um ponteiro para a nova partida criada, ou `NULL` em caso de falha.
- */
-static Partida* partidaFromFile(const char* buff) {
-    int id;
-    int t1ID;
-    int t2ID;
-    int gT1;
-    int gT2;
-
-    Time* t1;
-    Time* t2;
-
-    sscanf(buff, PARTIDA_CSV_PATTERN, &id, &t1ID, &t2ID, &gT1, &gT2);
-
-    t1 = timeDBGetByID(t1ID);
-    if(t1 == NULL)
-        return NULL;
-    t2 = timeDBGetByID(t2ID);
-    if(t2 == NULL)
-        return NULL;
-
-    return newPartida(id, t1, t2, gT1, gT2);
-}
-
-/**
- * startPartidaDB
- * 
- * Inicializa o banco de dados de partidas, lendo as partidas de um arquivo CSV.
- * 
- * Retorna:
- *  - `true` se o banco de dados foi inicializado corretamente.
- *  - `false` em caso de falha (como falha ao abrir o arquivo ou alocar memória).
- */
-bool startPartidaDB() {
-    char buffer[100];
-    Partida* p;
-    FILE* f;
-
-    if(partidaDB.partidas == NULL) {
-        partidaDB.partidas = newLinkedList();
-
-        if(partidaDB.partidas == NULL)
-            return false;
-        
-        f = fopen(PARTIDA_CSV, "r");
-        
-        if(f == NULL) {
-            perror("fopen");
-            return false;
-        }
-
-        // Limpa o cabeçalho do CSV
-        fgets(buffer, 100, f);
-
-        while(fgets(buffer, 100, f))
-        {
-            p = partidaFromFile(buffer);
-            if(p == NULL) {
-                llFullFree(partidaDB.partidas, freePartida);
-                return false;
-            }
-            llAdd(partidaDB.partidas, p);
-        }
-    }
-
-    return true;
-}
-
-/**
- * partidaDBMandantePrefixCheck
- * 
- * Verifica se a partida tem o time mandante com o prefixo especificado.
- * 
- * Parâmetros:
- *  - `partida`: Ponteiro para a partida a ser verificada.
- * 
- * Retorna:
- *  - `true` se o time mandante tiver o prefixo especificado.
- *  - `false` caso contrário.
- */
-bool partidaDBMandantePrefixCheck(void* partida) {
-    if(partida == NULL)
-        return false;
-
-    return checkPrefix(partidaGetT1((Partida*)partida));
-}
-
-/**
- * partidaDBSearchMandante
- * 
- * Pesquisa todas as partidas em que o time mandante tenha o prefixo especificado.
- * 
- * Parâmetros:
- *  - `timeName`: Nome do time (prefixo) a ser buscado.
- * 
- * Retorna:
- *  - Uma lista de partidas que correspondem à pesquisa, ou `NULL` se não houver partidas.
- */
-LinkedList* partidaDBSearchMandante(char timeName[TIME_MAX_NAME_SIZE]) {
-    if(!timeDBStarted() || partidaDB.partidas == NULL)
-        return NULL;
-
-    setPrefix(timeName);
-    return llSearchAll(partidaDB.partidas, partidaDBMandantePrefixCheck);
-}
-
-/**
- * partidaDBVisitantePrefixCheck
- * 
- * Verifica se a partida tem o time visitante com o prefixo especificado.
- * 
- * Parâmetros:
- *  - `partida`: Ponteiro para a partida a ser verificada.
- * 
- * Retorna:
- *  - `true` se o time visitante tiver o prefixo especificado.
- *  - `false` caso contrário.
- */
-bool partidaDBVisitantePrefixCheck(void* partida) {
-    if(partida == NULL)
-        return false;
-
-    return checkPrefix(partidaGetT2((Partida*)partida));
-}
-
-/**
- * partidaDBSearchVisitante
- * 
- * Pesquisa todas as partidas em que o time visitante tenha o prefixo especificado.
- * 
- * Parâmetros:
- *  - `timeName`: Nome do time (prefixo) a ser buscado.
- * 
- * Retorna:
- *  - Uma lista de partidas que correspondem à pesquisa, ou `NULL` se não houver partidas.
- */
-LinkedList* partidaDBSearchVisitante(char timeName[TIME_MAX_NAME_SIZE]) {
-    if(!timeDBStarted() || partidaDB.partidas == NULL)
-        return NULL;
-
-    setPrefix(timeName);
-    return llSearchAll(partidaDB.partidas, partidaDBVisitantePrefixCheck);
-}
-
-/**
- * partidaDBMandanteOrVisitantePrefixCheck
- * 
- * Verifica se a partida tem o time mandante ou visitante com o prefixo especificado.
- * 
- * Parâmetros:
- *  - `partida`: Ponteiro para a partida a ser verificada.
- * 
- * Retorna:
- *  - `true` se algum dos times (mandante ou visitante) tiver o prefixo especificado.
- *  - `false` caso contrário.
- */
-bool partidaDBMandanteOrVisitantePrefixCheck(void* partida) {
-    if(partida == NULL)
-        return false;
-
-    return checkPrefix(partidaGetT1((Partida*)partida)) || checkPrefix(partidaGetT2((Partida*)partida));
-}
-
-/**
- * partidaDBSearchMandanteOrVisitante
- * 
- * Pesquisa todas as partidas em que o time mandante ou visitante tenha o prefixo especificado.
- * 
- * Parâmetros:
- *  - `timeName`: Nome do time (prefixo) a ser buscado.
- * 
- * Retorna:
- *  - Uma lista de partidas que correspondem à pesquisa, ou `NULL` se não houver partidas.
- */
-LinkedList* partidaDBSearchMandanteOrVisitante(char timeName[TIME_MAX_NAME_SIZE]) {
-    if(!timeDBStarted() || partidaDB.partidas == NULL)
-        return NULL;
-
-    setPrefix(timeName);
-    return llSearchAll(partidaDB.partidas, partidaDBMandanteOrVisitantePrefixCheck);
-}
-
-/**
- * partidaGetById
- * 
- * Função auxiliar para encontrar uma partida pelo ID.
- * 
- * Parâmetros:
- *  - `p`: Ponteiro para a partida a ser verificada.
- * 
- * Retorna:
- *  - `true` se o ID da partida corresponder ao ID de pesquisa.
- *  - `false` caso contrário.
- */
-static bool partidaGetById(void* p) {
-    if(p == NULL)
-        return false;
-
-    return partidaGetId((Partida*)p) == partidaIDSearch;
-}
-
-/**
- * partidaDBGetById
- * 
- * Pesquisa uma partida pelo seu ID.
- * 
- * Parâmetros:
- *  - `id`: ID da partida a ser pesquisada.
- * 
- * Retorna:
- *  - A partida correspondente ao ID, ou `NULL` se não encontrar.
- */
-Partida* partidaDBGetById(int id) {
-    if(partidaDB.partidas == NULL)
-        return NULL;
-
-    partidaIDSearch = id;
-
-    return llFindFirst(partidaDB.partidas, partidaGetById);
-}
-
-/**
- * printPartida
- * 
- * Imprime os detalhes de uma partida.
- * 
- * Parâmetros:
- *  - `p`: Ponteiro para a partida a ser impressa.
- */
-void printPartida(Partida* p) {
-    if(p == NULL)
-        printf("Partida Indefinida\n");
-    else
-        printf("ID: %d, Time 1: %s, Time 2: %s, Gols Time 1: %d, Gols Time 2: %d\n", partidaGetId(p), timeGetName(partidaGetT1(p)), timeGetName(partidaGetT2(p)), partidaGetGolsT1(p), partidaGetGolsT2(p));
-}
-
-/**
- * partidaDBGetAllPartidas
- * 
- * Retorna todas as partidas armazenadas no banco de dados de partidas.
- * 
- * Retorna:
- *  - Lista com todas as partidas.
- */
-LinkedList* partidaDBGetAllPartidas() {
-    return partidaDB.partidas;
-}
-
-#endif
+#ifndef PARTIDA_DB_C
+#define PARTIDA_DB_C 0
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <pthread.h>
+
+#include "./../../inc/service/repo.h"
+#include "./../../inc/service/wal.h"
+#include "./../../inc/service/snapshot.h"
+#include "./../../inc/service/csv.h"
+#include "./../../inc/service/columns.h"
+#include "./../../inc/collections/Collection.h"
+
+// Entrada do índice por ID das partidas. Uma posição com `node == NULL` está livre.
+typedef struct {
+    int id;           // ID da partida
+    int linha;        // Linha da partida em `colunas` (`-1` se o armazenamento colunar está desligado)
+    ColHandle node;   // Referência à partida na coleção `partidas`
+} PartidaIndexEntry;
+
+// Capacidade inicial do índice por ID (potência de 2)
+#define PARTIDA_DB_INDEX_INITIAL_CAPACITY 16
+
+// Armazenamento colunar das partidas (ver columns.h), ligado com `make STORE=columns`
+#ifdef PARTIDA_COLUMNS
+    #define PARTIDA_DB_COLUMNS true
+#else
+    #define PARTIDA_DB_COLUMNS false
+#endif
+
+/*
+    Índice de adjacência time -> partidas em formato CSR (compressed sparse row).
+    As partidas do time `t` ficam contíguas em `slots[offsets[t] .. offsets[t+1])`, cada uma com a
+    sua posição na ordem da coleção, e são usadas direto (sem passar pelo índice por ID, o que
+    também mantém as partidas com ID repetido). Inserções feitas depois da construção vão para um
+    delta encadeado por time (`deltaHead`/`deltaNext`), e remoções marcam a entrada com `NULL`.
+    Quando o delta e as remoções crescem demais, o índice é marcado como sujo e reconstruído ao
+    fim da alteração (ver `partidaDBManutencao`).
+*/
+typedef struct {
+    Partida* partida;  // Partida (`NULL` = partida removida)
+    int ordem;         // Posição da partida na ordem da coleção (as inserções vão para o fim)
+} PartidaAdjSlot;
+
+typedef struct {
+    int teamCount;     // Quantidade de times cobertos (IDs 0 .. teamCount-1)
+    int* offsets;      // CSR: início das partidas de cada time (teamCount + 1 posições)
+    PartidaAdjSlot* slots;  // CSR: partidas de cada time, na ordem da coleção
+    int slotCount;     // Quantidade de posições em `slots`
+    int* deltaHead;    // Primeira entrada do delta de cada time (`-1` = nenhuma)
+    PartidaAdjSlot* deltaSlots;  // Partida de cada entrada do delta
+    int* deltaNext;    // Próxima entrada do delta do mesmo time (`-1` = fim)
+    int deltaCount;    // Quantidade de entradas usadas no delta
+    int deltaCapacity; // Quantidade de entradas alocadas no delta
+    int dead;          // Quantidade de entradas marcadas como removidas (CSR + delta)
+} PartidaAdjacency;
+
+// Lado da partida indexado por um `PartidaAdjacency`
+typedef enum {MANDANTE, VISITANTE} PartidaLado;
+
+// Versão da tabela viva de estatísticas (ver repo.h). Um escritor só altera uma versão que
+// nenhum leitor fixou; se algum fixou, a alteração vai para uma cópia (`statsPrepararEscrita`).
+struct PartidaDBVersao {
+    unsigned long long numero;  // Número da versão (cresce a cada alteração)
+    TimeEstatisticas* estatisticas;  // Estatísticas por ID de time
+    Time** times;          // Time de cada ID (`NULL` = ID sem time)
+    int count;             // Quantidade de posições em `estatisticas` e `times`
+    int refs;              // Referências: a do banco (enquanto é a atual) mais uma por leitor que a fixou
+};
+
+// Estrutura que representa o banco de dados de partidas.
+struct PartidaDB {
+    Collection* partidas;  // Coleção de partidas (LinkedList ou ArrayList, ver Collection.h)
+    LinkedList* partidasView;  // Cópia em lista devolvida por `partidaDBGetAllPartidas` (só com ArrayList)
+    PartidaIndexEntry* byId;  // Tabela hash (endereçamento aberto) de ID -> referência na coleção
+    int byIdCapacity;      // Quantidade de posições da tabela (sempre potência de 2)
+    int byIdSize;          // Quantidade de posições ocupadas
+    PartidaAdjacency mandante;   // Partidas de cada time como mandante
+    PartidaAdjacency visitante;  // Partidas de cada time como visitante
+    bool adjacencyDirty;   // `true` se o índice de adjacência precisa ser reconstruído
+    int adjacencyOrdem;    // Posição na ordem da coleção da próxima partida inserida (ver `PartidaAdjSlot`)
+    PartidaDBVersao* versao;  // Versão atual da tabela viva de estatísticas (atualizada por delta)
+    unsigned long long versaoNumero;  // Número da última versão criada
+    bool versaoEmEscrita;  // `true` se a alteração em andamento já numerou a versão atual
+    char* path;            // Arquivo de onde as partidas foram carregadas (destino do checkpoint)
+    bool binario;          // `true` se `path` é um snapshot binário (ver snapshot.h), `false` se é CSV
+    PartidaColumns colunas;  // Cópia colunar de todas as partidas da coleção, usada nas agregações
+    bool colunasAtivas;    // `false` se o armazenamento colunar está desligado ou foi descartado
+};
+
+// Buffer crescente de entradas do índice de adjacência usado para juntar as partidas nas buscas
+typedef struct {
+    PartidaAdjSlot* data;
+    int size;
+    int capacity;
+} AdjSlotBuffer;
+
+// Instância global do banco de dados de partidas
+static PartidaDB partidaDB;
+
+// Transação de inserção usada pelas funções sem `PartidaTransacao` (uma por thread)
+static _Thread_local PartidaTransacao partidaTransacaoThread;
+
+// Serializa os checkpoints, feitos só com a trava de leitura (ver `partidaDBCheckpoint`)
+static pthread_mutex_t partidaCheckpointMutex = PTHREAD_MUTEX_INITIALIZER;
+
+// Protege a contagem de referências das versões, alterada também pelos leitores (ver `partidaDBVersaoFixar`)
+static pthread_mutex_t partidaVersaoMutex = PTHREAD_MUTEX_INITIALIZER;
+
+// Protege a montagem de `partidasView` por leitores simultâneos (ver `partidaDBGetAllPartidas`)
+static pthread_mutex_t partidaViewMutex = PTHREAD_MUTEX_INITIALIZER;
+
+// Tamanho do log que dispara o checkpoint automático (`0` = desligado)
+static long partidaCheckpointBytes = PARTIDA_CHECKPOINT_WAL_BYTES;
+
+// Threads usadas na carga do CSV de partidas (ver `partidaDBSetLoadThreads`)
+static int partidaLoadThreads = PARTIDA_LOAD_THREADS;
+
+/**
+ * partidaIndexSlot
+ * 
+ * Calcula a posição inicial de um ID na tabela hash (hash multiplicativo de Fibonacci).
+ * 
+ * Parâmetros:
+ *  - `id`: ID da partida.
+ *  - `capacity`: Capacidade da tabela (potência de 2).
+ * 
+ * Retorna:
+ *  - A posição inicial de sondagem.
+ */
+static int partidaIndexSlot(int id, int capacity) {
+    return (int)(((unsigned int)id * 2654435769u) & (unsigned int)(capacity - 1));
+}
+
+/**
+ * partidaIndexPut
+ * 
+ * Insere uma entrada na tabela sem verificar a carga (usada também ao redimensionar).
+ * Caso o ID já exista, a entrada existente é mantida.
+ * 
+ * Parâmetros:
+ *  - `table`: Tabela onde a entrada será inserida.
+ *  - `capacity`: Capacidade da tabela.
+ *  - `id`: ID da partida.
+ *  - `linha`: Linha da partida em `colunas`, ou `-1`.
+ *  - `node`: Nó da lista que guarda a partida.
+ * 
+ * Retorna:
+ *  - `true` se a entrada foi inserida.
+ *  - `false` se o ID já estava presente.
+ */
+static bool partidaIndexPut(PartidaIndexEntry* table, int capacity, int id, int linha, ColHandle node) {
+    int i = partidaIndexSlot(id, capacity);
+
+    while(table[i].node != NULL) {
+        if(table[i].id == id)
+            return false;
+        i = (i + 1) & (capacity - 1);
+    }
+
+    table[i].id = id;
+    table[i].linha = linha;
+    table[i].node = node;
+    return true;
+}
+
+/**
+ * partidaIndexGrow
+ * 
+ * Dobra a capacidade da tabela hash, reinserindo todas as entradas.
+ * 
+ * Retorna:
+ *  - `true` se a tabela foi redimensionada.
+ *  - `false` se não houver memória suficiente.
+ */
+static bool partidaIndexGrow() {
+    PartidaIndexEntry* table;
+    int capacity;
+    int i;
+
+    capacity = partidaDB.byIdCapacity > 0 ? partidaDB.byIdCapacity * 2 : PARTIDA_DB_INDEX_INITIAL_CAPACITY;
+
+    table = (PartidaIndexEntry*)calloc(capacity, sizeof(PartidaIndexEntry));
+    if(table == NULL)
+        return false;
+
+    for(i = 0; i < partidaDB.byIdCapacity; i++)
+        if(partidaDB.byId[i].node != NULL)
+            partidaIndexPut(table, capacity, partidaDB.byId[i].id, partidaDB.byId[i].linha, partidaDB.byId[i].node);
+
+    free(partidaDB.byId);
+    partidaDB.byId = table;
+    partidaDB.byIdCapacity = capacity;
+
+    return true;
+}
+
+/**
+ * partidaIndexInsert
+ * 
+ * Registra o nó de uma partida no índice por ID, mantendo a carga da tabela em no máximo 50%.
+ * Caso já exista uma partida com o mesmo ID, a primeira é mantida (mesmo comportamento da antiga busca linear).
+ * 
+ * Parâmetros:
+ *  - `node`: Nó da lista que guarda a partida.
+ *  - `linha`: Linha da partida em `colunas`, ou `-1`.
+ * 
+ * Retorna:
+ *  - `true` se o nó foi indexado (ou o ID já estava presente).
+ *  - `false` se não houver memória suficiente.
+ */
+static bool partidaIndexInsert(ColHandle node, int linha) {
+    if((partidaDB.byIdSize + 1) * 2 > partidaDB.byIdCapacity)
+        if(!partidaIndexGrow())
+            return false;
+
+    if(partidaIndexPut(partidaDB.byId, partidaDB.byIdCapacity, partidaGetId((Partida*)colHandleGet(node)), linha, node))
+        partidaDB.byIdSize++;
+
+    return true;
+}
+
+/**
+ * partidaIndexFind
+ * 
+ * Procura a posição de um ID na tabela hash.
+ * 
+ * Parâmetros:
+ *  - `id`: ID da partida.
+ * 
+ * Retorna:
+ *  - A posição da entrada, ou `-1` caso o ID não esteja indexado.
+ */
+static int partidaIndexFind(int id) {
+    int i;
+
+    if(partidaDB.byIdCapacity == 0)
+        return -1;
+
+    for(i = partidaIndexSlot(id, partidaDB.byIdCapacity); partidaDB.byId[i].node != NULL; i = (i + 1) & (partidaDB.byIdCapacity - 1))
+        if(partidaDB.byId[i].id == id)
+            return i;
+
+    return -1;
+}
+
+/**
+ * partidaIndexRemoveAt
+ * 
+ * Remove a entrada da posição `i` usando deleção por deslocamento (backward shift),
+ * de forma que nenhuma marca de remoção precise ser mantida na tabela.
+ * 
+ * Parâmetros:
+ *  - `i`: Posição ocupada a ser liberada.
+ */
+static void partidaIndexRemoveAt(int i) {
+    int mask = partidaDB.byIdCapacity - 1;
+    int j = i;
+    int home;
+
+    while(1) {
+        j = (j + 1) & mask;
+        if(partidaDB.byId[j].node == NULL)
+            break;
+
+        // Move a entrada `j` para o buraco `i` apenas se a posição ideal dela não estiver entre (i, j]
+        home = partidaIndexSlot(partidaDB.byId[j].id, partidaDB.byIdCapacity);
+        if(((j - home) & mask) >= ((j - i) & mask)) {
+            partidaDB.byId[i] = partidaDB.byId[j];
+            i = j;
+        }
+    }
+
+    partidaDB.byId[i].node = NULL;
+    partidaDB.byIdSize--;
+}
+
+/**
+ * partidaIndexFree
+ * 
+ * Libera a tabela hash do índice por ID (sem liberar as partidas).
+ */
+static void partidaIndexFree() {
+    free(partidaDB.byId);
+    partidaDB.byId = NULL;
+    partidaDB.byIdCapacity = 0;
+    partidaDB.byIdSize = 0;
+}
+
+/**
+ * partidaColunasDesligar
+ * 
+ * Descarta o armazenamento colunar (partida que não cabe nos tipos estreitos ou falta de memória).
+ * As agregações voltam a percorrer a coleção até o banco ser reiniciado.
+ */
+static void partidaColunasDesligar() {
+    int i;
+
+    partidaColumnsFree(&partidaDB.colunas);
+    partidaDB.colunasAtivas = false;
+
+    for(i = 0; i < partidaDB.byIdCapacity; i++)
+        partidaDB.byId[i].linha = -1;
+}
+
+/**
+ * partidaColunasAdicionar
+ * 
+ * Copia uma partida recém-adicionada à coleção para o final das colunas.
+ * 
+ * Retorna:
+ *  - A linha da partida, ou `-1` se o armazenamento colunar está (ou acabou de ser) desligado.
+ */
+static int partidaColunasAdicionar(Partida* p) {
+    int linha;
+
+    if(!partidaDB.colunasAtivas)
+        return -1;
+
+    linha = partidaColumnsAppend(&partidaDB.colunas, partidaGetId(p), timeGetId(partidaGetT1(p)),
+                                 timeGetId(partidaGetT2(p)), partidaGetGolsT1(p), partidaGetGolsT2(p));
+    if(linha < 0)
+        partidaColunasDesligar();
+
+    return linha;
+}
+
+/**
+ * partidaColunasRemover
+ * 
+ * Remove a linha de uma partida das colunas. A última linha ocupa o lugar dela, e a entrada
+ * do índice por ID que apontava para a última linha é corrigida (uma partida com ID repetido
+ * não está no índice e não precisa de correção).
+ */
+static void partidaColunasRemover(int linha) {
+    int i;
+
+    if(!partidaDB.colunasAtivas || !partidaColumnsRemoveAt(&partidaDB.colunas, linha))
+        return;
+
+    i = partidaIndexFind(partidaDB.colunas.id[linha]);
+    if(i >= 0 && partidaDB.byId[i].linha == partidaDB.colunas.count)
+        partidaDB.byId[i].linha = linha;
+}
+
+/**
+ * adjSlotBufferPush
+ * 
+ * Adiciona uma entrada ao final do buffer, dobrando a capacidade quando necessário.
+ * 
+ * Retorna:
+ *  - `true` se a entrada foi adicionada.
+ *  - `false` se não houver memória suficiente.
+ */
+static bool adjSlotBufferPush(AdjSlotBuffer* b, PartidaAdjSlot v) {
+    PartidaAdjSlot* resized;
+    int capacity;
+
+    if(b->size == b->capacity) {
+        capacity = b->capacity > 0 ? b->capacity * 2 : 16;
+        resized = (PartidaAdjSlot*)realloc(b->data, sizeof(PartidaAdjSlot) * capacity);
+        if(resized == NULL)
+            return false;
+        b->data = resized;
+        b->capacity = capacity;
+    }
+
+    b->data[b->size++] = v;
+    return true;
+}
+
+/**
+ * partidaLadoTimeId
+ * 
+ * Obtém o ID do time de uma partida no lado (mandante/visitante) indicado.
+ */
+static int partidaLadoTimeId(Partida* p, PartidaLado lado) {
+    return timeGetId(lado == MANDANTE ? partidaGetT1(p) : partidaGetT2(p));
+}
+
+/**
+ * partidaAdjacencyFree
+ * 
+ * Libera todos os vetores de um índice de adjacência, deixando-o vazio.
+ */
+static void partidaAdjacencyFree(PartidaAdjacency* adj) {
+    free(adj->offsets);
+    free(adj->slots);
+    free(adj->deltaHead);
+    free(adj->deltaSlots);
+    free(adj->deltaNext);
+
+    adj->teamCount = 0;
+    adj->offsets = NULL;
+    adj->slots = NULL;
+    adj->slotCount = 0;
+    adj->deltaHead = NULL;
+    adj->deltaSlots = NULL;
+    adj->deltaNext = NULL;
+    adj->deltaCount = 0;
+    adj->deltaCapacity = 0;
+    adj->dead = 0;
+}
+
+// Contexto passado aos callbacks de `colForeachCtx` durante a reconstrução do índice de adjacência
+typedef struct {
+    int maxTeam;          // Maior ID de time encontrado
+    int* fillMandante;    // Próxima posição livre de cada time no CSR de mandantes
+    int* fillVisitante;   // Próxima posição livre de cada time no CSR de visitantes
+    int ordem;            // Posição na coleção da partida visitada
+} AdjBuildCtx;
+
+static void adjBuildFindMaxTeam(void* p, void* ctx) {
+    AdjBuildCtx* b = (AdjBuildCtx*)ctx;
+    int t1 = partidaLadoTimeId((Partida*)p, MANDANTE);
+    int t2 = partidaLadoTimeId((Partida*)p, VISITANTE);
+
+    if(t1 > b->maxTeam) b->maxTeam = t1;
+    if(t2 > b->maxTeam) b->maxTeam = t2;
+}
+
+static void adjBuildCount(void* p, void* ctx) {
+    (void)ctx;
+    partidaDB.mandante.offsets[partidaLadoTimeId((Partida*)p, MANDANTE) + 1]++;
+    partidaDB.visitante.offsets[partidaLadoTimeId((Partida*)p, VISITANTE) + 1]++;
+}
+
+static void adjBuildFill(void* p, void* ctx) {
+    AdjBuildCtx* b = (AdjBuildCtx*)ctx;
+    PartidaAdjSlot slot;
+
+    slot.partida = (Partida*)p;
+    slot.ordem = b->ordem++;
+
+    partidaDB.mandante.slots[b->fillMandante[partidaLadoTimeId((Partida*)p, MANDANTE)]++] = slot;
+    partidaDB.visitante.slots[b->fillVisitante[partidaLadoTimeId((Partida*)p, VISITANTE)]++] = slot;
+}
+
+/**
+ * partidaAdjacencyAlloc
+ * 
+ * Aloca os vetores do CSR de um lado para `teamCount` times e `slotCount` partidas.
+ * 
+ * Retorna:
+ *  - `true` se a alocação foi bem-sucedida.
+ *  - `false` caso contrário (o índice é deixado vazio).
+ */
+static bool partidaAdjacencyAlloc(PartidaAdjacency* adj, int teamCount, int slotCount) {
+    int i;
+
+    adj->teamCount = teamCount;
+    adj->slotCount = slotCount;
+    adj->offsets = (int*)calloc(teamCount + 1, sizeof(int));
+    adj->slots = (PartidaAdjSlot*)malloc(sizeof(PartidaAdjSlot) * (slotCount > 0 ? slotCount : 1));
+    adj->deltaHead = (int*)malloc(sizeof(int) * (teamCount > 0 ? teamCount : 1));
+
+    if(adj->offsets == NULL || adj->slots == NULL || adj->deltaHead == NULL) {
+        partidaAdjacencyFree(adj);
+        return false;
+    }
+
+    for(i = 0; i < teamCount; i++)
+        adj->deltaHead[i] = -1;
+
+    return true;
+}
+
+/**
+ * partidaAdjacencyRebuild
+ * 
+ * Reconstrói os índices de adjacência (mandante e visitante) a partir da lista de partidas,
+ * em O(partidas + times). O delta e as remoções pendentes são descartados.
+ * 
+ * Retorna:
+ *  - `true` se o índice foi reconstruído.
+ *  - `false` se não houver memória suficiente (o índice continua sujo).
+ */
+static bool partidaAdjacencyRebuild() {
+    AdjBuildCtx b;
+    int teamCount;
+    int slotCount;
+    int i;
+
+    partidaAdjacencyFree(&partidaDB.mandante);
+    partidaAdjacencyFree(&partidaDB.visitante);
+    partidaDB.adjacencyDirty = true;
+
+    b.maxTeam = -1;
+    colForeachCtx(partidaDB.partidas, adjBuildFindMaxTeam, &b);
+
+    teamCount = b.maxTeam + 1;
+    slotCount = colGetSize(partidaDB.partidas);
+
+    if(!partidaAdjacencyAlloc(&partidaDB.mandante, teamCount, slotCount))
+        return false;
+
+    if(!partidaAdjacencyAlloc(&partidaDB.visitante, teamCount, slotCount)) {
+        partidaAdjacencyFree(&partidaDB.mandante);
+        return false;
+    }
+
+    colForeachCtx(partidaDB.partidas, adjBuildCount, &b);
+
+    for(i = 0; i < teamCount; i++) {
+        partidaDB.mandante.offsets[i + 1] += partidaDB.mandante.offsets[i];
+        partidaDB.visitante.offsets[i + 1] += partidaDB.visitante.offsets[i];
+    }
+
+    b.fillMandante = (int*)malloc(sizeof(int) * (teamCount + 1));
+    b.fillVisitante = (int*)malloc(sizeof(int) * (teamCount + 1));
+    if(b.fillMandante == NULL || b.fillVisitante == NULL) {
+        free(b.fillMandante);
+        free(b.fillVisitante);
+        partidaAdjacencyFree(&partidaDB.mandante);
+        partidaAdjacencyFree(&partidaDB.visitante);
+        return false;
+    }
+
+    for(i = 0; i <= teamCount; i++) {
+        b.fillMandante[i] = partidaDB.mandante.offsets[i];
+        b.fillVisitante[i] = partidaDB.visitante.offsets[i];
+    }
+
+    b.ordem = 0;
+    colForeachCtx(partidaDB.partidas, adjBuildFill, &b);
+
+    free(b.fillMandante);
+    free(b.fillVisitante);
+
+    partidaDB.adjacencyOrdem = b.ordem;
+    partidaDB.adjacencyDirty = false;
+    return true;
+}
+
+/**
+ * partidaAdjacencyInsert
+ * 
+ * Registra uma partida recém-inserida (no fim da coleção) no delta de um lado, na posição `ordem`,
+ * em O(1) amortizado. Se o time não é coberto pelo CSR atual, ou o delta ficou grande demais,
+ * o índice é marcado como sujo.
+ */
+static void partidaAdjacencyInsert(PartidaAdjacency* adj, Partida* p, PartidaLado lado, int ordem) {
+    int team = partidaLadoTimeId(p, lado);
+    int capacity;
+    PartidaAdjSlot* slots;
+    int* next;
+
+    if(partidaDB.adjacencyDirty)
+        return;
+
+    if(team >= adj->teamCount || (adj->deltaCount + adj->dead) > adj->slotCount / 2 + 64) {
+        partidaDB.adjacencyDirty = true;
+        return;
+    }
+
+    if(adj->deltaCount == adj->deltaCapacity) {
+        capacity = adj->deltaCapacity > 0 ? adj->deltaCapacity * 2 : 16;
+        slots = (PartidaAdjSlot*)realloc(adj->deltaSlots, sizeof(PartidaAdjSlot) * capacity);
+        if(slots != NULL)
+            adj->deltaSlots = slots;
+        next = (int*)realloc(adj->deltaNext, sizeof(int) * capacity);
+        if(next != NULL)
+            adj->deltaNext = next;
+        if(slots == NULL || next == NULL) {
+            partidaDB.adjacencyDirty = true;
+            return;
+        }
+        adj->deltaCapacity = capacity;
+    }
+
+    adj->deltaSlots[adj->deltaCount].partida = p;
+    adj->deltaSlots[adj->deltaCount].ordem = ordem;
+    adj->deltaNext[adj->deltaCount] = adj->deltaHead[team];
+    adj->deltaHead[team] = adj->deltaCount;
+    adj->deltaCount++;
+}
+
+/**
+ * partidaAdjacencyRemove
+ * 
+ * Marca como removida a entrada de uma partida no índice de um lado, em O(partidas do time).
+ * A entrada é achada pelo ponteiro, então uma partida com ID repetido não afeta as outras.
+ */
+static void partidaAdjacencyRemove(PartidaAdjacency* adj, Partida* p, PartidaLado lado) {
+    int team = partidaLadoTimeId(p, lado);
+    int i;
+
+    if(partidaDB.adjacencyDirty || team < 0 || team >= adj->teamCount)
+        return;
+
+    for(i = adj->offsets[team]; i < adj->offsets[team + 1]; i++)
+        if(adj->slots[i].partida == p) {
+            adj->slots[i].partida = NULL;
+            adj->dead++;
+            return;
+        }
+
+    for(i = adj->deltaHead[team]; i != -1; i = adj->deltaNext[i])
+        if(adj->deltaSlots[i].partida == p) {
+            adj->deltaSlots[i].partida = NULL;
+            adj->dead++;
+            return;
+        }
+}
+
+/**
+ * partidaAdjacencyCollect
+ * 
+ * Copia para o buffer as entradas das partidas de um time em um lado (CSR + delta).
+ * 
+ * Retorna:
+ *  - `true` se todas as entradas foram copiadas.
+ *  - `false` se não houver memória suficiente.
+ */
+static bool partidaAdjacencyCollect(PartidaAdjacency* adj, int team, AdjSlotBuffer* out) {
+    int i;
+
+    if(team < 0 || team >= adj->teamCount)
+        return true;
+
+    for(i = adj->offsets[team]; i < adj->offsets[team + 1]; i++)
+        if(adj->slots[i].partida != NULL && !adjSlotBufferPush(out, adj->slots[i]))
+            return false;
+
+    for(i = adj->deltaHead[team]; i != -1; i = adj->deltaNext[i])
+        if(adj->deltaSlots[i].partida != NULL && !adjSlotBufferPush(out, adj->deltaSlots[i]))
+            return false;
+
+    return true;
+}
+
+/**
+ * statsAplicarResultado
+ * 
+ * Contabiliza (ou desfaz) o resultado de uma partida para um time.
+ * 
+ * Parâmetros:
+ *  - `e`: Estatísticas do time.
+ *  - `marcou`: Gols marcados pelo time.
+ *  - `sofreu`: Gols sofridos pelo time.
+ *  - `sinal`: `1` para somar o resultado, `-1` para desfazê-lo.
+ */
+static void statsAplicarResultado(TimeEstatisticas* e, int marcou, int sofreu, int sinal) {
+    e->gm += sinal * marcou;
+    e->gs += sinal * sofreu;
+
+    if(marcou > sofreu) e->vitorias += sinal;
+    else if(marcou == sofreu) e->empates += sinal;
+    else e->derrotas += sinal;
+}
+
+// Callback de `colForeachCtx`: `ctx` é o vetor de estatísticas sendo preenchido
+static void statsProcessPartida(void* p, void* ctx) {
+    TimeEstatisticas* stats = (TimeEstatisticas*)ctx;
+    Partida* pt = (Partida*)p;
+    int g1 = partidaGetGolsT1(pt);
+    int g2 = partidaGetGolsT2(pt);
+
+    statsAplicarResultado(&stats[timeGetId(partidaGetT1(pt))], g1, g2, 1);
+    statsAplicarResultado(&stats[timeGetId(partidaGetT2(pt))], g2, g1, 1);
+}
+
+/**
+ * partidaDBCalcularEstatisticas
+ * 
+ * Calcula vitórias, empates, derrotas e gols de todos os times em uma única passagem
+ * pelas partidas, acumulando em um vetor denso indexado pelo ID do time.
+ * Custo O(partidas + times), sem listas temporárias nem comparação de nomes. Com o
+ * armazenamento colunar ligado, a passagem é feita sobre as colunas (ver columns.h).
+ * 
+ * Parâmetros:
+ *  - `count`: Saída com o tamanho do vetor retornado.
+ * 
+ * Retorna:
+ *  - O vetor de estatísticas (liberar com `free`), ou `NULL` em caso de erro.
+ */
+TimeEstatisticas* partidaDBCalcularEstatisticas(int* count) {
+    TimeEstatisticas* stats;
+    int n;
+
+    if(count == NULL || partidaDB.partidas == NULL || !timeDBStarted())
+        return NULL;
+
+    n = timeDBGetIdBound();
+    stats = (TimeEstatisticas*)calloc(n > 0 ? n : 1, sizeof(TimeEstatisticas));
+    if(stats == NULL)
+        return NULL;
+
+    if(!partidaDB.colunasAtivas || !partidaColumnsEstatisticas(&partidaDB.colunas, stats, n))
+        colForeachCtx(partidaDB.partidas, statsProcessPartida, stats);
+
+    *count = n;
+    return stats;
+}
+
+/**
+ * versaoCriar
+ * 
+ * Cria uma versão com a tabela `estatisticas` (que passa a pertencer à versão) e os times atuais.
+ * 
+ * Retorna:
+ *  - A versão, com a referência do banco, ou `NULL` se não houver memória suficiente.
+ */
+static PartidaDBVersao* versaoCriar(TimeEstatisticas* estatisticas, int count) {
+    PartidaDBVersao* v = (PartidaDBVersao*)malloc(sizeof(PartidaDBVersao));
+    int i;
+
+    if(v == NULL)
+        return NULL;
+
+    v->times = (Time**)malloc(sizeof(Time*) * (count > 0 ? count : 1));
+    if(v->times == NULL) {
+        free(v);
+        return NULL;
+    }
+
+    for(i = 0; i < count; i++)
+        v->times[i] = timeDBGetByID(i);
+
+    v->numero = ++partidaDB.versaoNumero;
+    v->estatisticas = estatisticas;
+    v->count = count;
+    v->refs = 1;
+
+    return v;
+}
+
+/**
+ * versaoSoltar
+ * 
+ * Devolve uma referência à versão, liberando-a quando for a última.
+ */
+static void versaoSoltar(PartidaDBVersao* v) {
+    int refs;
+
+    pthread_mutex_lock(&partidaVersaoMutex);
+    refs = --v->refs;
+    pthread_mutex_unlock(&partidaVersaoMutex);
+
+    if(refs > 0)
+        return;
+
+    free(v->estatisticas);
+    free(v->times);
+    free(v);
+}
+
+/**
+ * statsRecalcular
+ * 
+ * Cria a versão atual com um recálculo completo das estatísticas, se ela não existir.
+ * Se faltar memória, o banco fica sem versão até a próxima tentativa.
+ */
+static void statsRecalcular() {
+    TimeEstatisticas* estatisticas;
+    int count;
+
+    if(partidaDB.versao != NULL)
+        return;
+
+    estatisticas = partidaDBCalcularEstatisticas(&count);
+    if(estatisticas == NULL)
+        return;
+
+    partidaDB.versao = versaoCriar(estatisticas, count);
+    if(partidaDB.versao == NULL)
+        free(estatisticas);
+}
+
+/**
+ * statsPrepararEscrita
+ * 
+ * Prepara a versão atual para ser alterada, com a trava de escrita. Se algum leitor a fixou, ela é
+ * copiada (cópia na escrita) e a cópia passa a ser a atual: os leitores continuam com a antiga, que
+ * é liberada pelo último deles. Senão, ela é alterada no lugar; nenhum leitor consegue fixá-la antes
+ * do fim da alteração, porque fixar exige a trava de leitura. A primeira chamada de cada alteração
+ * dá à versão um número novo.
+ * 
+ * Retorna:
+ *  - `true` se a versão atual pode ser alterada.
+ *  - `false` se não há versão ou não houver memória suficiente para a cópia.
+ */
+static bool statsPrepararEscrita() {
+    PartidaDBVersao* v = partidaDB.versao;
+    PartidaDBVersao* copia;
+    TimeEstatisticas* estatisticas;
+    bool fixada;
+
+    if(v == NULL)
+        return false;
+
+    // Leitores só soltam enquanto a trava de escrita está presa: a contagem pode cair, nunca subir
+    pthread_mutex_lock(&partidaVersaoMutex);
+    fixada = v->refs > 1;
+    pthread_mutex_unlock(&partidaVersaoMutex);
+
+    if(fixada) {
+        estatisticas = (TimeEstatisticas*)malloc(sizeof(TimeEstatisticas) * (v->count > 0 ? v->count : 1));
+        if(estatisticas == NULL)
+            return false;
+
+        memcpy(estatisticas, v->estatisticas, sizeof(TimeEstatisticas) * v->count);
+
+        copia = versaoCriar(estatisticas, v->count);
+        if(copia == NULL) {
+            free(estatisticas);
+            return false;
+        }
+
+        // Os times da cópia são os mesmos da versão (times nunca mudam de ID nem são removidos)
+        memcpy(copia->times, v->times, sizeof(Time*) * v->count);
+
+        partidaDB.versao = copia;
+        partidaDB.versaoEmEscrita = true;
+        versaoSoltar(v);
+        return true;
+    }
+
+    if(!partidaDB.versaoEmEscrita) {
+        v->numero = ++partidaDB.versaoNumero;
+        partidaDB.versaoEmEscrita = true;
+    }
+
+    return true;
+}
+
+/**
+ * statsReserve
+ * 
+ * Garante que a versão atual (já preparada com `statsPrepararEscrita`) tenha posições para os IDs
+ * `0 .. n-1`, preenchendo as novas posições com zero e com os times cadastrados.
+ * 
+ * Retorna:
+ *  - `true` se a tabela comporta `n` times.
+ *  - `false` se não houver memória suficiente.
+ */
+static bool statsReserve(int n) {
+    PartidaDBVersao* v = partidaDB.versao;
+    TimeEstatisticas* resized;
+    Time** times;
+    int i;
+
+    if(n <= v->count)
+        return true;
+
+    resized = (TimeEstatisticas*)realloc(v->estatisticas, sizeof(TimeEstatisticas) * n);
+    if(resized == NULL)
+        return false;
+    v->estatisticas = resized;
+
+    times = (Time**)realloc(v->times, sizeof(Time*) * n);
+    if(times == NULL)
+        return false;
+    v->times = times;
+
+    for(i = v->count; i < n; i++) {
+        resized[i].vitorias = 0;
+        resized[i].empates = 0;
+        resized[i].derrotas = 0;
+        resized[i].gm = 0;
+        resized[i].gs = 0;
+        times[i] = timeDBGetByID(i);
+    }
+
+    v->count = n;
+
+    return true;
+}
+
+/**
+ * statsDescartar
+ * 
+ * Solta a versão atual da tabela viva de estatísticas (leitores que a fixaram continuam com ela).
+ */
+static void statsDescartar() {
+    if(partidaDB.versao != NULL)
+        versaoSoltar(partidaDB.versao);
+
+    partidaDB.versao = NULL;
+}
+
+/**
+ * statsAplicarPartida
+ * 
+ * Aplica (sinal `1`) ou desfaz (sinal `-1`) o resultado de uma partida na tabela viva, em O(1)
+ * (mais a cópia da tabela, se algum leitor fixou a versão atual).
+ * Se a tabela não puder crescer, ela é descartada e será recalculada por completo ao fim da alteração.
+ */
+static void statsAplicarPartida(Partida* p, int sinal) {
+    int t1 = timeGetId(partidaGetT1(p));
+    int t2 = timeGetId(partidaGetT2(p));
+    int g1 = partidaGetGolsT1(p);
+    int g2 = partidaGetGolsT2(p);
+
+    if(partidaDB.versao == NULL)
+        return;
+
+    if(!statsPrepararEscrita() || !statsReserve((t1 > t2 ? t1 : t2) + 1)) {
+        statsDescartar();
+        return;
+    }
+
+    statsAplicarResultado(&partidaDB.versao->estatisticas[t1], g1, g2, sinal);
+    statsAplicarResultado(&partidaDB.versao->estatisticas[t2], g2, g1, sinal);
+}
+
+/**
+ * statsCheck
+ * 
+ * Em builds de depuração (`PARTIDA_DB_DEBUG`), confere a tabela viva contra um recálculo completo
+ * após cada alteração, reportando divergências em `stderr`.
+ */
+static void statsCheck(const char* operacao) {
+#ifdef PARTIDA_DB_DEBUG
+    if(!partidaDBVerificarEstatisticas())
+        fprintf(stderr, "[PARTIDA_DB_DEBUG] estatisticas divergentes apos %s\n", operacao);
+#else
+    (void)operacao;
+#endif
+}
+
+/**
+ * partidaDBRegistrar
+ * 
+ * Registra uma alteração da partida `p` no log (WAL).
+ * 
+ * Parâmetros:
+ *  - `tipo`: Tipo da alteração.
+ *  - `p`: Partida, já com os valores novos (no caso de atualização).
+ * 
+ * Retorna:
+ *  - `true` se o log aceitou o registro.
+ *  - `false` caso contrário (a alteração não deve ser aplicada).
+ */
+static bool partidaDBRegistrar(PartidaWALTipo tipo, Partida* p) {
+    PartidaWALRegistro r;
+
+    r.tipo = tipo;
+    r.id = partidaGetId(p);
+    r.t1 = timeGetId(partidaGetT1(p));
+    r.t2 = timeGetId(partidaGetT2(p));
+    r.golsT1 = partidaGetGolsT1(p);
+    r.golsT2 = partidaGetGolsT2(p);
+
+    return partidaWALAppend(&r);
+}
+
+/**
+ * partidaDBAplicarInsercao
+ * 
+ * Adiciona uma partida à coleção e aos índices (ID, adjacência e estatísticas), sem registrar no log.
+ * 
+ * Retorna:
+ *  - `true` se a partida foi adicionada.
+ *  - `false` se faltar memória (nada é alterado).
+ */
+static bool partidaDBAplicarInsercao(Partida* p) {
+    ColHandle node;
+    int linha;
+
+    node = colAddHandle(partidaDB.partidas, p);
+    if(node == NULL)
+        return false;
+
+    linha = partidaColunasAdicionar(p);
+    if(!partidaIndexInsert(node, linha)) {
+        partidaColunasRemover(linha);
+        colRemoveHandle(partidaDB.partidas, node);
+        return false;
+    }
+
+    partidaAdjacencyInsert(&partidaDB.mandante, p, MANDANTE, partidaDB.adjacencyOrdem);
+    partidaAdjacencyInsert(&partidaDB.visitante, p, VISITANTE, partidaDB.adjacencyOrdem);
+    partidaDB.adjacencyOrdem++;
+    statsAplicarPartida(p, 1);
+    colViewFree(&partidaDB.partidasView);
+
+    return true;
+}
+
+/**
+ * partidaDBAplicarRemocao
+ * 
+ * Remove e libera a partida com o ID informado, retirando-a dos índices, sem registrar no log.
+ * 
+ * Retorna:
+ *  - `true` se a partida foi removida.
+ *  - `false` se ela não existe.
+ */
+static bool partidaDBAplicarRemocao(int id) {
+    ColHandle node;
+    Partida* p;
+    int linha;
+    int i;
+
+    i = partidaIndexFind(id);
+    if(i < 0)
+        return false;
+
+    node = partidaDB.byId[i].node;
+    linha = partidaDB.byId[i].linha;
+    p = (Partida*)colHandleGet(node);
+    partidaIndexRemoveAt(i);
+    partidaColunasRemover(linha);
+
+    partidaAdjacencyRemove(&partidaDB.mandante, p, MANDANTE);
+    partidaAdjacencyRemove(&partidaDB.visitante, p, VISITANTE);
+    statsAplicarPartida(p, -1);
+
+    // Sai da coleção antes de ser liberada: com ArrayList, a remoção compara o próprio ponteiro
+    colRemoveHandle(partidaDB.partidas, node);
+    freePartida(p);
+    colViewFree(&partidaDB.partidasView);
+
+    return true;
+}
+
+/**
+ * partidaDBAplicarGols
+ * 
+ * Troca os gols de uma partida, desfazendo o resultado antigo e aplicando o novo na tabela viva,
+ * sem registrar no log.
+ */
+static void partidaDBAplicarGols(Partida* p, int golsT1, int golsT2) {
+    int i;
+
+    statsAplicarPartida(p, -1);
+    partidaSetGolsT1(p, golsT1);
+    partidaSetGolsT2(p, golsT2);
+    statsAplicarPartida(p, 1);
+
+    if(partidaDB.colunasAtivas) {
+        i = partidaIndexFind(partidaGetId(p));
+        if(i < 0 || !partidaColumnsSetGols(&partidaDB.colunas, partidaDB.byId[i].linha, golsT1, golsT2))
+            partidaColunasDesligar();
+    }
+}
+
+/**
+ * partidaDBReaplicar
+ * 
+ * Reaplica um registro do log durante a inicialização (`partidaWALApplyFunc`).
+ * Registros que não fazem sentido no estado atual (partida já existente, inexistente ou com
+ * time desconhecido) são ignorados.
+ * 
+ * Retorna:
+ *  - `true` se o registro foi aplicado, `false` se foi ignorado.
+ */
+static bool partidaDBReaplicar(const PartidaWALRegistro* r, void* ctx) {
+    Partida* p;
+    Time* t1;
+    Time* t2;
+
+    (void)ctx;
+
+    switch(r->tipo) {
+        case PARTIDA_WAL_INSERT:
+            t1 = timeDBGetByID(r->t1);
+            t2 = timeDBGetByID(r->t2);
+            if(partidaDBGetById(r->id) != NULL || t1 == NULL || t2 == NULL)
+                return false;
+
+            p = newPartida(r->id, t1, t2, r->golsT1, r->golsT2);
+            if(p == NULL)
+                return false;
+
+            if(!partidaDBAplicarInsercao(p)) {
+                freePartida(p);
+                return false;
+            }
+            return true;
+
+        case PARTIDA_WAL_UPDATE:
+            p = partidaDBGetById(r->id);
+            if(p == NULL || r->golsT1 < 0 || r->golsT2 < 0)
+                return false;
+
+            partidaDBAplicarGols(p, r->golsT1, r->golsT2);
+            return true;
+
+        case PARTIDA_WAL_DELETE:
+            return partidaDBAplicarRemocao(r->id);
+    }
+
+    return false;
+}
+
+/**
+ * partidaDBDescartar
+ * 
+ * Libera a coleção, as partidas e todos os índices, deixando o banco como não iniciado.
+ */
+static void partidaDBDescartar() {
+    colFullFree(partidaDB.partidas, freePartida);
+    partidaDB.partidas = NULL;
+    colViewFree(&partidaDB.partidasView);
+    partidaIndexFree();
+    partidaAdjacencyFree(&partidaDB.mandante);
+    partidaAdjacencyFree(&partidaDB.visitante);
+    partidaDB.adjacencyDirty = true;
+    statsDescartar();
+    partidaColumnsFree(&partidaDB.colunas);
+    partidaDB.colunasAtivas = false;
+    free(partidaDB.path);
+    partidaDB.path = NULL;
+}
+
+/**
+ * partidaDBManutencao
+ * 
+ * Refaz o que uma alteração deixou pendente: o índice de adjacência sujo, a tabela viva de
+ * estatísticas descartada por falta de memória e as posições da tabela para times novos.
+ * Encerra a alteração da versão atual: a próxima alteração a numera de novo.
+ * Chamada pelos escritores, com a trava de escrita, para que as leituras nunca alterem o banco.
+ * Se faltar memória, as buscas usam a varredura linear e a próxima alteração tenta de novo.
+ */
+static void partidaDBManutencao() {
+    if(partidaDB.adjacencyDirty)
+        partidaAdjacencyRebuild();
+
+    statsRecalcular();
+
+    if(partidaDB.versao != NULL && partidaDB.versao->count < timeDBGetIdBound() && statsPrepararEscrita())
+        statsReserve(timeDBGetIdBound());
+
+    partidaDB.versaoEmEscrita = false;
+}
+
+/**
+ * partidaDBTimesAlterados
+ * 
+ * Chamada por `addTime`, com a trava de escrita, depois de cadastrar um time: a versão atual
+ * das estatísticas ganha a posição do time novo.
+ */
+void partidaDBTimesAlterados() {
+    if(partidaDB.partidas != NULL)
+        partidaDBManutencao();
+}
+
+/**
+ * partidaDBCheckpointTravado
+ * 
+ * O checkpoint propriamente dito (ver `partidaDBCheckpoint`), para quem já garante que nenhuma
+ * alteração nem outro checkpoint acontece ao mesmo tempo.
+ */
+static bool partidaDBCheckpointTravado() {
+    if(partidaDB.partidas == NULL || !partidaWALIsOpen())
+        return false;
+
+    // Os times vêm primeiro: o snapshot de partidas só pode citar times já gravados
+    if(!timeDBCheckpoint() || !partidaDBExport(partidaDB.path, partidaDB.binario))
+        return false;
+
+    return partidaWALTruncate();
+}
+
+/**
+ * partidaDBCheckpointAutomatico
+ * 
+ * Faz um checkpoint se o log passou do limite configurado. Chamada com a trava de escrita após
+ * cada alteração já registrada e aplicada; se o checkpoint falhar, o log continua válido e crescendo.
+ */
+static void partidaDBCheckpointAutomatico() {
+    if(partidaCheckpointBytes > 0 && partidaWALGetSize() >= partidaCheckpointBytes)
+        partidaDBCheckpointTravado();
+}
+
+/**
+ * nextPartidaID
+ * 
+ * Retorna o próximo ID disponível para uma nova partida com base no ID da última partida.
+ * 
+ * Retorna:
+ *  - O próximo ID disponível para uma nova partida.
+ */
+static int nextPartidaID() {
+    Partida* last = (Partida*)colGetLast(partidaDB.partidas);
+    return partidaGetId(last) + 1;
+}
+
+/**
+ * partidaDBStartInsertTransaction
+ * 
+ * Inicia uma transação de inserção para a partida (a transação da thread).
+ * 
+ * Retorna:
+ *  - `true` se a transação de inserção já não estiver em andamento.
+ *  - `false` caso contrário (se já houver uma transação aberta).
+ */
+bool partidaDBStartInsertTransaction() {
+    if(partidaTransacaoThread.partida == NULL)
+        return true;
+    return false;
+}
+
+/**
+ * partidaDBTransacaoCommit
+ * 
+ * Commit da transação de inserção, adicionando a partida ao banco de dados de partidas.
+ * Com a trava de escrita, a partida recebe o próximo ID livre (outras transações podem ter
+ * confirmado partidas depois da prévia) e a inserção é registrada no log (WAL) antes de ser
+ * aplicada em memória.
+ * 
+ * Retorna:
+ *  - `true` se a operação foi bem-sucedida.
+ *  - `false` caso contrário (em caso de falha na adição).
+ */
+bool partidaDBTransacaoCommit(PartidaTransacao* tx, int* id) {
+    Partida* p;
+    bool ok = false;
+
+    if(tx == NULL || tx->partida == NULL)
+        return false;
+
+    p = tx->partida;
+
+    repoWriteLock();
+
+    if(partidaDB.partidas != NULL) {
+        partidaSetId(p, colIsEmpty(partidaDB.partidas) ? 0 : nextPartidaID());
+
+        // Write-ahead: a inserção só é aplicada depois de aceita pelo log
+        if(partidaDBRegistrar(PARTIDA_WAL_INSERT, p)) {
+            if(partidaDBAplicarInsercao(p)) {
+                ok = true;
+                if(id != NULL)
+                    *id = partidaGetId(p);
+
+                statsCheck("insercao");
+                partidaDBManutencao();
+                partidaDBCheckpointAutomatico();
+            } else {
+                // Compensa o registro para que a partida não apareça ao reaplicar o log
+                partidaDBRegistrar(PARTIDA_WAL_DELETE, p);
+            }
+        }
+    }
+
+    repoWriteUnlock();
+
+    if(ok)
+        tx->partida = NULL;
+
+    return ok;
+}
+
+/**
+ * partidaDBInsertCommit
+ * 
+ * Commit da transação de inserção da thread (ver `partidaDBTransacaoCommit`).
+ * 
+ * Retorna:
+ *  - `true` se a operação foi bem-sucedida.
+ *  - `false` caso contrário (em caso de falha na adição).
+ */
+bool partidaDBInsertCommit() {
+    return partidaDBTransacaoCommit(&partidaTransacaoThread, NULL);
+}
+
+/**
+ * partidaDBTransacaoRollBack
+ * 
+ * Cancela a transação de inserção, liberando a memória alocada para a partida em transação.
+ */
+void partidaDBTransacaoRollBack(PartidaTransacao* tx) {
+    if(tx != NULL && tx->partida != NULL) {
+        freePartida(tx->partida);
+        tx->partida = NULL;
+    }
+}
+
+/**
+ * partidaDBInsertRollBack
+ * 
+ * Cancela a transação de inserção da thread.
+ */
+void partidaDBInsertRollBack() {
+    partidaDBTransacaoRollBack(&partidaTransacaoThread);
+}
+
+/**
+ * partidaDBTransacaoAdicionar
+ * 
+ * Cria a partida da transação `tx`, validando os times com a trava de leitura.
+ * 
+ * Parâmetros:
+ *  - `tx`: A transação.
+ *  - `t1ID`: ID do time 1.
+ *  - `t2ID`: ID do time 2.
+ *  - `gT1`: Gols do time 1.
+ *  - `gT2`: Gols do time 2.
+ * 
+ * Retorna:
+ *  - `SUCCESS` se a partida foi criada com sucesso.
+ *  - Outros valores para indicar erros específicos (ex: time com IDs iguais, memória insuficiente, time inexistente).
+ */
+AddPartidaReponse partidaDBTransacaoAdicionar(PartidaTransacao* tx, int t1ID, int t2ID, int gT1, int gT2) {
+    AddPartidaReponse resp = SUCCESS;
+    Time* t1;
+    Time* t2;
+
+    if(tx == NULL || tx->partida != NULL)
+        return ANOTHER_TRANSACTION_NOT_CLOSE;
+
+    if(t1ID == t2ID)
+        return TIME_1_EQUALS_TIME_2;
+
+    repoReadLock();
+
+    if(partidaDB.partidas == NULL) {
+        resp = PARTIDA_DATABASE_NOT_STARTED_YET;
+    } else if((t1 = timeDBGetByID(t1ID)) == NULL) {
+        resp = TIME_1_DOES_NOT_EXISTS;
+    } else if((t2 = timeDBGetByID(t2ID)) == NULL) {
+        resp = TIME_2_DOES_NOT_EXISTS;
+    } else {
+        // Os times nunca são removidos: os ponteiros continuam válidos depois de soltar a trava
+        tx->partida = newPartida(colIsEmpty(partidaDB.partidas) ? 0 : nextPartidaID(), t1, t2, gT1, gT2);
+        if(tx->partida == NULL)
+            resp = MEMORY_NOT_ENOUGH_EXCEPTION;
+    }
+
+    repoReadUnlock();
+
+    return resp;
+}
+
+/**
+ * addPartida
+ * 
+ * Adiciona uma nova partida à transação de inserção da thread (ver `partidaDBTransacaoAdicionar`).
+ * 
+ * Parâmetros:
+ *  - `t1ID`: ID do time 1.
+ *  - `t2ID`: ID do time 2.
+ *  - `gT1`: Gols do time 1.
+ *  - `gT2`: Gols do time 2.
+ * 
+ * Retorna:
+ *  - `SUCCESS` se a partida foi adicionada com sucesso.
+ *  - Outros valores para indicar erros específicos (ex: time com IDs iguais, memória insuficiente, time inexistente).
+ */
+AddPartidaReponse addPartida(int t1ID, int t2ID, int gT1, int gT2) {
+    return partidaDBTransacaoAdicionar(&partidaTransacaoThread, t1ID, t2ID, gT1, gT2);
+}
+
+/**
+ * partidaDBGetPartidaEmTransacao
+ * 
+ * Retorna a partida da transação de inserção da thread, ou `NULL`.
+ */
+Partida* partidaDBGetPartidaEmTransacao() {
+    return partidaTransacaoThread.partida;
+}
+
+/**
+ * partidaFromCSV
+ * 
+ * Cria uma partida a partir da linha atual do leitor de CSV (ID, times e gols). Não escreve
+ * em `stderr`, para poder ser usada pelas threads da carga paralela.
+ * 
+ * Parâmetros:
+ *  - `csv`: Leitor posicionado na linha da partida.
+ *  - `semTime`: Saída, `true` se a linha cita um time não cadastrado (não é alterada nos demais casos).
+ *  - `timeInexistente`: Saída com o ID desse time.
+ * 
+ * Retorna:
+ *  - Um ponteiro para a nova partida criada.
+ *  - `NULL` se a linha é inválida (ver `csvGetError`), cita um time inexistente ou faltou memória.
+ */
+static Partida* partidaFromCSV(CsvReader* csv, bool* semTime, int* timeInexistente) {
+    int id;
+    int t1ID;
+    int t2ID;
+    int gT1;
+    int gT2;
+
+    Time* t1;
+    Time* t2;
+
+    if(!csvGetInt(csv, 0, &id) || !csvGetInt(csv, 1, &t1ID) || !csvGetInt(csv, 2, &t2ID) ||
+       !csvGetInt(csv, 3, &gT1) || !csvGetInt(csv, 4, &gT2))
+        return NULL;
+
+    t1 = timeDBGetByID(t1ID);
+    t2 = timeDBGetByID(t2ID);
+    if(t1 == NULL || t2 == NULL) {
+        *semTime = true;
+        *timeInexistente = t1 == NULL ? t1ID : t2ID;
+        return NULL;
+    }
+
+    return newPartida(id, t1, t2, gT1, gT2);
+}
+
+/**
+ * partidaCSVLerLsn
+ * 
+ * Lê do cabeçalho (linha atual do leitor) o `lsn` de um snapshot feito por checkpoint, gravado
+ * como último campo (`PARTIDA_CSV_LSN_FIELD`). Sem o campo, `baseLsn` não é alterado.
+ */
+static void partidaCSVLerLsn(CsvReader* csv, unsigned long long* baseLsn) {
+    char campo[32];
+    const char* marca;
+    int len;
+
+    marca = csvGetField(csv, csvGetFieldCount(csv) - 1, &len);
+    if(len > (int)strlen(PARTIDA_CSV_LSN_FIELD) && len < (int)sizeof(campo) &&
+       memcmp(marca, PARTIDA_CSV_LSN_FIELD, strlen(PARTIDA_CSV_LSN_FIELD)) == 0) {
+        memcpy(campo, marca, len);
+        campo[len] = '\0';
+        sscanf(campo, PARTIDA_CSV_LSN_FIELD "%llu", baseLsn);
+    }
+}
+
+/**
+ * partidaCSVReportar
+ * 
+ * Informa em `stderr` por que a linha atual do leitor não gerou uma partida. Uma falta de
+ * memória não é informada (como no restante do banco).
+ */
+static void partidaCSVReportar(CsvReader* csv, const char* path, bool semTime, int timeInexistente) {
+    if(csvGetError(csv) != NULL)
+        fprintf(stderr, "%s: %s\n", path, csvGetError(csv));
+    else if(semTime)
+        fprintf(stderr, "%s: linha %ld: time %d inexistente\n", path, csvGetRow(csv), timeInexistente);
+}
+
+/**
+ * partidaDBAdicionarCarregada
+ * 
+ * Adiciona à coleção, às colunas e ao índice por ID uma partida lida do arquivo base (os demais
+ * índices são montados depois, de uma vez).
+ * 
+ * Retorna:
+ *  - `true` se a partida foi adicionada.
+ *  - `false` se `p` é `NULL` (time inexistente ou falta de memória) ou faltou memória (`p` é liberada).
+ */
+static bool partidaDBAdicionarCarregada(Partida* p) {
+    ColHandle node;
+
+    node = colAddHandle(partidaDB.partidas, p);
+    if(node == NULL) {
+        freePartida(p);
+        return false;
+    }
+
+    return partidaIndexInsert(node, partidaColunasAdicionar(p));
+}
+
+/**
+ * partidaDBLoadCSV
+ * 
+ * Lê as partidas de um arquivo CSV com o leitor de csv.h. O cabeçalho pode trazer, como campo
+ * extra, o `lsn` de um checkpoint (`PARTIDA_CSV_LSN_FIELD`). Uma linha malformada interrompe
+ * a carga, com a linha e a coluna informadas em `stderr`.
+ * 
+ * Parâmetros:
+ *  - `path`: Caminho do CSV.
+ *  - `baseLsn`: Saída com o `lsn` gravado no cabeçalho (`0` se não houver).
+ * 
+ * Retorna:
+ *  - `true` se todas as partidas foram carregadas.
+ *  - `false` se o arquivo não pôde ser aberto, tem uma linha inválida ou faltou memória
+ *    (o chamador descarta o banco).
+ */
+static bool partidaDBLoadCSV(const char* path, unsigned long long* baseLsn) {
+    int timeInexistente = 0;
+    bool semTime = false;
+    CsvReader* csv;
+    Partida* p;
+    bool ok = true;
+
+    csv = csvOpen(path, CSV_SEPARATOR);
+    if(csv == NULL)
+        return false;
+
+    // Cabeçalho: guarda o `lsn` de um snapshot feito por checkpoint, se houver
+    if(csvNextRow(csv))
+        partidaCSVLerLsn(csv, baseLsn);
+
+    while(ok && csvNextRow(csv)) {
+        p = partidaFromCSV(csv, &semTime, &timeInexistente);
+        if(p == NULL && semTime)
+            partidaCSVReportar(csv, path, semTime, timeInexistente);
+
+        ok = partidaDBAdicionarCarregada(p);
+    }
+
+    if(csvGetError(csv) != NULL) {
+        fprintf(stderr, "%s: %s\n", path, csvGetError(csv));
+        ok = false;
+    }
+    csvClose(csv);
+
+    return ok;
+}
+
+// Partida lida por uma thread da carga paralela, com a chave de ordenação à mão
+typedef struct {
+    int id;          // ID da partida
+    int linha;       // Linha dentro do trecho (desempata IDs repetidos na ordem do arquivo)
+    Partida* partida;
+} PartidaCarregada;
+
+// Trecho do CSV lido por uma thread da carga paralela
+typedef struct {
+    const char* inicio;   // Primeiro byte do trecho (sempre o início de uma linha)
+    size_t tamanho;       // Tamanho do trecho em bytes
+    CsvReader* csv;       // Leitor do trecho, mantido aberto até o relatório de erros
+    PartidaCarregada* partidas;  // Partidas lidas, em ordem de ID ao final
+    int count;            // Quantidade de partidas em `partidas`
+    int capacity;         // Capacidade de `partidas`
+    int proxima;          // Próxima partida a ser juntada ao banco
+    bool ok;              // `false` se o trecho tem uma linha inválida ou faltou memória
+    bool semTime;         // `true` se o erro foi um time inexistente
+    int timeInexistente;  // ID do time inexistente
+} PartidaLoadChunk;
+
+static int partidaCarregadaCompare(const void* a, const void* b) {
+    const PartidaCarregada* x = (const PartidaCarregada*)a;
+    const PartidaCarregada* y = (const PartidaCarregada*)b;
+
+    if(x->id != y->id)
+        return (x->id > y->id) - (x->id < y->id);
+
+    return (x->linha > y->linha) - (x->linha < y->linha);
+}
+
+/**
+ * partidaLoadWorker
+ * 
+ * Corpo de uma thread da carga paralela: lê as partidas do seu trecho para um buffer próprio,
+ * consultando apenas o índice de times (somente leitura durante a carga), e as ordena por ID
+ * se o trecho não estiver em ordem. Não toca no banco de partidas nem escreve em `stderr`.
+ * 
+ * Parâmetros:
+ *  - `arg`: O `PartidaLoadChunk` da thread.
+ */
+static void* partidaLoadWorker(void* arg) {
+    PartidaLoadChunk* c = (PartidaLoadChunk*)arg;
+    PartidaCarregada* partidas;
+    bool ordenado = true;
+    Partida* p;
+    int capacity;
+
+    c->csv = csvOpenMemory(c->inicio, c->tamanho, CSV_SEPARATOR);
+    c->ok = c->csv != NULL;
+
+    while(c->ok && csvNextRow(c->csv)) {
+        p = partidaFromCSV(c->csv, &c->semTime, &c->timeInexistente);
+        if(p == NULL) {
+            c->ok = false;
+            break;
+        }
+
+        if(c->count == c->capacity) {
+            capacity = c->capacity > 0 ? c->capacity * 2 : 1024;
+            partidas = (PartidaCarregada*)realloc(c->partidas, sizeof(PartidaCarregada) * capacity);
+            if(partidas == NULL) {
+                freePartida(p);
+                c->ok = false;
+                break;
+            }
+            c->partidas = partidas;
+            c->capacity = capacity;
+        }
+
+        c->partidas[c->count].id = partidaGetId(p);
+        c->partidas[c->count].linha = (int)csvGetRow(c->csv);
+        c->partidas[c->count].partida = p;
+        if(c->count > 0 && c->partidas[c->count - 1].id > c->partidas[c->count].id)
+            ordenado = false;
+        c->count++;
+    }
+
+    if(c->csv != NULL && csvGetError(c->csv) != NULL)
+        c->ok = false;
+
+    // Os arquivos gravados pelo banco já estão em ordem de ID: a ordenação é a exceção
+    if(c->ok && !ordenado)
+        qsort(c->partidas, c->count, sizeof(PartidaCarregada), partidaCarregadaCompare);
+
+    return NULL;
+}
+
+/**
+ * partidaLoadContarLinhas
+ * 
+ * Conta as quebras de linha em `[inicio, fim)`. Usada só para numerar a linha de um erro.
+ */
+static long partidaLoadContarLinhas(const char* inicio, const char* fim) {
+    const char* q;
+    long linhas = 0;
+
+    while(inicio < fim && (q = (const char*)memchr(inicio, '\n', fim - inicio)) != NULL) {
+        linhas++;
+        inicio = q + 1;
+    }
+
+    return linhas;
+}
+
+/**
+ * partidaLoadJuntar
+ * 
+ * Junta ao banco, em ordem de ID (empates na ordem dos trechos), as partidas já ordenadas
+ * de cada trecho. Com os trechos de um arquivo em ordem, equivale a concatená-los.
+ * 
+ * Retorna:
+ *  - `true` se todas as partidas foram adicionadas.
+ *  - `false` se faltou memória (as partidas ainda não juntadas continuam nos trechos).
+ */
+static bool partidaLoadJuntar(PartidaLoadChunk* chunks, int n) {
+    PartidaLoadChunk* menor;
+    int i;
+
+    for(;;) {
+        menor = NULL;
+        for(i = 0; i < n; i++)
+            if(chunks[i].proxima < chunks[i].count &&
+               (menor == NULL || chunks[i].partidas[chunks[i].proxima].id < menor->partidas[menor->proxima].id))
+                menor = &chunks[i];
+
+        if(menor == NULL)
+            return true;
+
+        // Em falta de memória a partida é liberada por `partidaDBAdicionarCarregada`
+        if(!partidaDBAdicionarCarregada(menor->partidas[menor->proxima++].partida))
+            return false;
+    }
+}
+
+/**
+ * partidaDBLoadCSVParalelo
+ * 
+ * Lê as partidas de um arquivo CSV com várias threads: o arquivo é mapeado em memória, o
+ * cabeçalho é lido aqui (com o `lsn`) e o restante é dividido em trechos alinhados em quebras
+ * de linha, um por thread (a thread atual lê o primeiro). Cada thread gera as partidas do seu
+ * trecho; depois elas são juntadas ao banco em ordem de ID, sem disputa por travas.
+ * Uma linha inválida é informada em `stderr` com a numeração do arquivo inteiro.
+ * 
+ * Parâmetros:
+ *  - `path`: Caminho do CSV.
+ *  - `baseLsn`: Saída com o `lsn` gravado no cabeçalho (`0` se não houver).
+ *  - `threads`: Quantidade máxima de threads.
+ * 
+ * Retorna:
+ *  - `true` se todas as partidas foram carregadas.
+ *  - `false` se o arquivo não pôde ser lido, tem uma linha inválida ou faltou memória
+ *    (o chamador descarta o banco). Um arquivo vazio ou que não pôde ser mapeado é lido por
+ *    `partidaDBLoadCSV`.
+ */
+static bool partidaDBLoadCSVParalelo(const char* path, unsigned long long* baseLsn, int threads) {
+    pthread_t tids[PARTIDA_LOAD_MAX_THREADS];
+    bool criada[PARTIDA_LOAD_MAX_THREADS];
+    PartidaLoadChunk chunks[PARTIDA_LOAD_MAX_THREADS];
+    const char* base;
+    const char* corpo;
+    const char* fim;
+    const char* corte;
+    CsvReader* csv;
+    size_t size;
+    bool ok = true;
+    int n;
+    int i;
+    int j;
+
+    // Um arquivo vazio não pode ser mapeado: a leitura sequencial o aceita como banco vazio
+    // (e informa os erros de abertura do mesmo jeito)
+    base = (const char*)snapshotMapFile(path, &size);
+    if(base == NULL)
+        return partidaDBLoadCSV(path, baseLsn);
+    fim = base + size;
+
+    // Cabeçalho: até a primeira quebra de linha
+    corpo = (const char*)memchr(base, '\n', size);
+    corpo = corpo != NULL ? corpo + 1 : fim;
+
+    csv = csvOpenMemory(base, corpo - base, CSV_SEPARATOR);
+    if(csv == NULL) {
+        snapshotUnmapFile(base, size);
+        return false;
+    }
+    if(csvNextRow(csv))
+        partidaCSVLerLsn(csv, baseLsn);
+    csvClose(csv);
+
+    // Trechos de pelo menos `PARTIDA_LOAD_MIN_CHUNK` bytes, cada um terminando após um `\n`
+    n = (int)((fim - corpo) / PARTIDA_LOAD_MIN_CHUNK);
+    if(n > threads) n = threads;
+    if(n < 1) n = 1;
+
+    memset(chunks, 0, sizeof(chunks));
+    corte = corpo;
+    for(i = 0; i < n; i++) {
+        chunks[i].inicio = corte;
+        if(i == n - 1) {
+            corte = fim;
+        } else {
+            corte = corpo + (size_t)(fim - corpo) / n * (i + 1);
+            if(corte < chunks[i].inicio)
+                corte = chunks[i].inicio;
+            corte = (const char*)memchr(corte, '\n', fim - corte);
+            corte = corte != NULL ? corte + 1 : fim;
+        }
+        chunks[i].tamanho = corte - chunks[i].inicio;
+    }
+
+    for(i = 1; i < n; i++)
+        criada[i] = pthread_create(&tids[i], NULL, partidaLoadWorker, &chunks[i]) == 0;
+
+    partidaLoadWorker(&chunks[0]);
+
+    // Sem recursos para uma thread, o trecho é lido aqui mesmo
+    for(i = 1; i < n; i++) {
+        if(criada[i])
+            pthread_join(tids[i], NULL);
+        else
+            partidaLoadWorker(&chunks[i]);
+    }
+
+    // Informa o primeiro erro do arquivo, agora com o número da linha no arquivo inteiro
+    for(i = 0; i < n && ok; i++) {
+        if(!chunks[i].ok) {
+            ok = false;
+            if(chunks[i].csv != NULL) {
+                csvSetRowBase(chunks[i].csv, partidaLoadContarLinhas(base, chunks[i].inicio));
+                partidaCSVReportar(chunks[i].csv, path, chunks[i].semTime, chunks[i].timeInexistente);
+            }
+        }
+    }
+
+    if(ok)
+        ok = partidaLoadJuntar(chunks, n);
+
+    for(i = 0; i < n; i++) {
+        for(j = chunks[i].proxima; j < chunks[i].count; j++)
+            freePartida(chunks[i].partidas[j].partida);
+        free(chunks[i].partidas);
+        if(chunks[i].csv != NULL)
+            csvClose(chunks[i].csv);
+    }
+    snapshotUnmapFile(base, size);
+
+    return ok;
+}
+
+/**
+ * partidaDBLoadBinary
+ * 
+ * Lê as partidas de um snapshot binário mapeado em memória, sem análise de texto, copiando cada
+ * registro para uma nova partida (o mapeamento é desfeito no fim).
+ * 
+ * Parâmetros:
+ *  - `path`: Caminho do snapshot.
+ *  - `baseLsn`: Saída com o `lsn` gravado no cabeçalho.
+ * 
+ * Retorna:
+ *  - `true` se todas as partidas foram carregadas.
+ *  - `false` se o snapshot é inválido, cita um time inexistente ou faltou memória.
+ */
+static bool partidaDBLoadBinary(const char* path, unsigned long long* baseLsn) {
+    const SnapshotPartida* r;
+    SnapshotMap map;
+    unsigned int i;
+    Time* t1;
+    Time* t2;
+
+    if(!snapshotMapOpen(path, SNAPSHOT_MAGIC_PARTIDAS, sizeof(SnapshotPartida), &map))
+        return false;
+
+    *baseLsn = map.header->lsn;
+
+    r = (const SnapshotPartida*)map.records;
+    for(i = 0; i < map.header->count; i++, r++) {
+        t1 = timeDBGetByID(r->t1);
+        t2 = timeDBGetByID(r->t2);
+
+        if(t1 == NULL || t2 == NULL ||
+           !partidaDBAdicionarCarregada(newPartida(r->id, t1, t2, r->golsT1, r->golsT2))) {
+            snapshotMapClose(&map);
+            return false;
+        }
+    }
+
+    snapshotMapClose(&map);
+
+    return true;
+}
+
+/**
+ * startPartidaDBFromFile
+ * 
+ * Inicializa o banco de dados de partidas, lendo as partidas de um arquivo CSV ou de um
+ * snapshot binário (reconhecido pelo número mágico, ver `snapshot.h`), e reaplica o log.
+ * 
+ * Parâmetros:
+ *  - `path`: Caminho do arquivo de partidas.
+ * 
+ * Retorna:
+ *  - `true` se o banco de dados foi inicializado corretamente.
+ *  - `false` em caso de falha (como falha ao abrir o arquivo ou alocar memória).
+ */
+bool startPartidaDBFromFile(const char* path) {
+    unsigned long long baseLsn = 0;
+    char* walPath;
+    bool ok;
+
+    if(partidaDB.partidas == NULL) {
+        partidaDB.partidas = newCollection();
+
+        if(partidaDB.partidas == NULL)
+            return false;
+
+        partidaDB.colunasAtivas = PARTIDA_DB_COLUMNS;
+        
+        partidaDB.path = (char*)malloc(strlen(path) + 1);
+        if(partidaDB.path != NULL) {
+            strcpy(partidaDB.path, path);
+            partidaDB.binario = snapshotIsBinary(path, SNAPSHOT_MAGIC_PARTIDAS);
+            if(partidaDB.binario)
+                ok = partidaDBLoadBinary(path, &baseLsn);
+            else if(partidaLoadThreads > 1)
+                ok = partidaDBLoadCSVParalelo(path, &baseLsn, partidaLoadThreads);
+            else
+                ok = partidaDBLoadCSV(path, &baseLsn);
+        } else {
+            ok = false;
+        }
+
+        if(!ok) {
+            partidaDBDescartar();
+            return false;
+        }
+
+        // Se faltar memória aqui, o índice fica sujo e é reconstruído na próxima alteração
+        partidaAdjacencyRebuild();
+
+        // Idem para a tabela viva de estatísticas
+        statsRecalcular();
+
+        // Reaplica as alterações registradas no log (`<path>.wal`) posteriores ao snapshot
+        walPath = (char*)malloc(strlen(path) + strlen(PARTIDA_WAL_EXTENSION) + 1);
+        if(walPath == NULL) {
+            partidaDBDescartar();
+            return false;
+        }
+        strcpy(walPath, path);
+        strcat(walPath, PARTIDA_WAL_EXTENSION);
+
+        ok = partidaWALOpen(walPath, baseLsn, partidaDBReaplicar, NULL, NULL);
+        free(walPath);
+
+        if(!ok) {
+            partidaDBDescartar();
+            return false;
+        }
+        statsCheck("reaplicacao do log");
+
+        // O que a reaplicação deixou pendente é refeito aqui, antes das primeiras leituras
+        partidaDBManutencao();
+    }
+
+    return true;
+}
+
+/**
+ * startPartidaDB
+ * 
+ * Inicializa o banco de dados de partidas a partir do arquivo CSV padrão (`PARTIDA_CSV`).
+ * 
+ * Retorna:
+ *  - `true` se o banco de dados foi inicializado corretamente.
+ *  - `false` em caso de falha (como falha ao abrir o arquivo ou alocar memória).
+ */
+bool startPartidaDB() {
+    return startPartidaDBFromFile(PARTIDA_CSV);
+}
+
+/**
+ * stopPartidaDB
+ * 
+ * Encerra o banco de partidas: grava no disco (com `fsync`) os registros do log que ainda
+ * estavam no buffer do commit em grupo, fecha o log e libera as partidas e os índices.
+ */
+void stopPartidaDB() {
+    partidaWALClose();
+    partidaDBInsertRollBack();
+
+    if(partidaDB.partidas != NULL)
+        partidaDBDescartar();
+}
+
+// Contexto da gravação de um snapshot de partidas
+typedef struct {
+    FILE* f;             // Arquivo temporário do snapshot
+    bool binario;        // `true` para o formato binário, `false` para CSV
+    bool ok;             // `false` após o primeiro erro de escrita
+    unsigned int crc;    // CRC-32 dos registros gravados (binário)
+    unsigned int count;  // Quantidade de registros gravados
+} PartidaSnapshotCtx;
+
+/**
+ * partidaSnapshotWrite
+ * 
+ * Grava uma partida como linha do CSV ou registro binário (`foreachCtxFunc`, contexto `PartidaSnapshotCtx`).
+ */
+static void partidaSnapshotWrite(void* partida, void* ctx) {
+    PartidaSnapshotCtx* snap = (PartidaSnapshotCtx*)ctx;
+    Partida* p = (Partida*)partida;
+    SnapshotPartida r;
+
+    if(!snap->ok)
+        return;
+
+    r.id = partidaGetId(p);
+    r.t1 = timeGetId(partidaGetT1(p));
+    r.t2 = timeGetId(partidaGetT2(p));
+    r.golsT1 = partidaGetGolsT1(p);
+    r.golsT2 = partidaGetGolsT2(p);
+
+    if(snap->binario) {
+        snap->crc = snapshotCrc32(snap->crc, &r, sizeof(r));
+        snap->ok = fwrite(&r, sizeof(r), 1, snap->f) == 1;
+    } else {
+        snap->ok = fprintf(snap->f, PARTIDA_CSV_PATTERN "\n", r.id, r.t1, r.t2, r.golsT1, r.golsT2) >= 0;
+    }
+    snap->count++;
+}
+
+/**
+ * partidaDBExport
+ * 
+ * Grava as partidas em `path`, de forma atômica, no formato pedido. O arquivo leva o `lsn` do
+ * último registro do log já aplicado (no cabeçalho do CSV ou do binário).
+ * 
+ * Retorna:
+ *  - `true` se o arquivo foi gravado.
+ *  - `false` se o banco não foi iniciado ou a gravação falhou.
+ */
+bool partidaDBExport(const char* path, bool binario) {
+    PartidaSnapshotCtx snap;
+    unsigned long long lsn;
+    char* tmpPath;
+
+    if(partidaDB.partidas == NULL)
+        return false;
+
+    snap.f = snapshotBegin(path, binario ? "wb" : "w", &tmpPath);
+    if(snap.f == NULL)
+        return false;
+
+    lsn = partidaWALGetLastLsn();
+    snap.binario = binario;
+    snap.crc = 0;
+    snap.count = 0;
+
+    // No binário o cabeçalho é regravado no fim, já com a quantidade e o CRC
+    if(binario)
+        snap.ok = snapshotWriteHeader(snap.f, SNAPSHOT_MAGIC_PARTIDAS, sizeof(SnapshotPartida), 0, lsn, 0);
+    else
+        snap.ok = fprintf(snap.f, PARTIDA_CSV_HEADER PARTIDA_CSV_LSN_PATTERN "\n", lsn) >= 0;
+
+    colForeachCtx(partidaDB.partidas, partidaSnapshotWrite, &snap);
+
+    if(snap.ok && binario)
+        snap.ok = snapshotWriteHeader(snap.f, SNAPSHOT_MAGIC_PARTIDAS, sizeof(SnapshotPartida), snap.count, lsn, snap.crc);
+
+    if(!snap.ok) {
+        snapshotAbort(snap.f, tmpPath);
+        return false;
+    }
+
+    return snapshotCommit(snap.f, tmpPath, path);
+}
+
+/**
+ * partidaDBCheckpoint
+ * 
+ * Grava os snapshots de times e de partidas (no formato em que cada um foi lido) e trunca o log.
+ * O snapshot de partidas leva o `lsn` do último registro já aplicado: se houver uma queda antes
+ * do truncamento, a próxima inicialização ignora esses registros em vez de reaplicá-los.
+ * 
+ * Retorna:
+ *  - `true` se o checkpoint foi concluído.
+ *  - `false` se o banco não foi iniciado ou alguma etapa falhou.
+ */
+bool partidaDBCheckpoint() {
+    bool ok;
+
+    // A trava de leitura basta para que nenhuma alteração chegue ao log durante a gravação:
+    // as buscas continuam, e o mutex impede dois checkpoints (mesmos arquivos temporários) ao mesmo tempo
+    repoReadLock();
+    pthread_mutex_lock(&partidaCheckpointMutex);
+
+    ok = partidaDBCheckpointTravado();
+
+    pthread_mutex_unlock(&partidaCheckpointMutex);
+    repoReadUnlock();
+
+    return ok;
+}
+
+/**
+ * partidaDBSetCheckpointThreshold
+ * 
+ * Define o tamanho do log que dispara o checkpoint automático (`0` desliga).
+ */
+void partidaDBSetCheckpointThreshold(long bytes) {
+    partidaCheckpointBytes = bytes > 0 ? bytes : 0;
+}
+
+/**
+ * partidaDBSetLoadThreads
+ * 
+ * Define quantas threads leem o CSV de partidas nas próximas cargas.
+ */
+void partidaDBSetLoadThreads(int threads) {
+    if(threads < 1) threads = 1;
+    if(threads > PARTIDA_LOAD_MAX_THREADS) threads = PARTIDA_LOAD_MAX_THREADS;
+
+    partidaLoadThreads = threads;
+}
+
+// Contexto de uma busca pelo índice de adjacência (um por chamada, na pilha de quem busca)
+typedef struct {
+    AdjSlotBuffer slots;  // Partidas encontradas
+    bool mandante;    // Incluir partidas como mandante
+    bool visitante;   // Incluir partidas como visitante
+    bool ok;          // `false` se faltou memória
+} AdjQueryCtx;
+
+static void adjQueryCollectTime(void* t, void* ctx) {
+    AdjQueryCtx* q = (AdjQueryCtx*)ctx;
+    int team = timeGetId((Time*)t);
+
+    if(!q->ok)
+        return;
+
+    if(q->mandante && !partidaAdjacencyCollect(&partidaDB.mandante, team, &q->slots))
+        q->ok = false;
+
+    if(q->visitante && !partidaAdjacencyCollect(&partidaDB.visitante, team, &q->slots))
+        q->ok = false;
+}
+
+static int compareAdjSlotOrdem(const void* a, const void* b) {
+    int x = ((const PartidaAdjSlot*)a)->ordem;
+    int y = ((const PartidaAdjSlot*)b)->ordem;
+
+    return (x > y) - (x < y);
+}
+
+/**
+ * partidaDBSearchIndexed
+ * 
+ * Busca partidas pelo índice de adjacência: resolve o prefixo para o conjunto de times pelo índice
+ * de prefixo dos times (`timeDBForeachPrefix`, no modo `tipo`) e lê apenas as listas de partidas desses times.
+ * O custo é proporcional à quantidade de times e de partidas encontradas, e não ao tamanho do banco.
+ * O resultado vem na ordem da coleção, sem repetições, como na busca linear.
+ * 
+ * Parâmetros:
+ *  - `timeName`: Prefixo do nome do time.
+ *  - `tipo`: `BUSCA_EXATA` ou `BUSCA_NORMALIZADA`.
+ *  - `mandante`: Incluir partidas em que o time é mandante.
+ *  - `visitante`: Incluir partidas em que o time é visitante.
+ * 
+ * Retorna:
+ *  - Uma nova lista com as partidas encontradas.
+ *  - `NULL` se o índice não puder ser usado (falta de memória); o chamador deve usar a busca linear.
+ */
+static LinkedList* partidaDBSearchIndexed(char timeName[TIME_MAX_NAME_SIZE], TipoBusca tipo, bool mandante, bool visitante) {
+    AdjQueryCtx q;
+    LinkedList* result;
+    int i;
+
+    // As leituras não reconstroem o índice (ver `partidaDBManutencao`)
+    if(partidaDB.adjacencyDirty)
+        return NULL;
+
+    result = newLinkedList();
+    if(result == NULL)
+        return NULL;
+
+    q.slots.data = NULL;
+    q.slots.size = 0;
+    q.slots.capacity = 0;
+    q.mandante = mandante;
+    q.visitante = visitante;
+    q.ok = true;
+
+    // Os times vêm direto do índice de prefixo do banco de times, sem lista intermediária
+    if(!timeDBForeachPrefix(timeName, tipo, adjQueryCollectTime, &q))
+        q.ok = false;
+
+    if(!q.ok) {
+        free(q.slots.data);
+        llFullFree(result, NULL);
+        return NULL;
+    }
+
+    // Uma partida aparece duas vezes quando os dois times casam com o prefixo
+    if(q.slots.size > 1)
+        qsort(q.slots.data, q.slots.size, sizeof(PartidaAdjSlot), compareAdjSlotOrdem);
+
+    for(i = 0; i < q.slots.size; i++) {
+        if(i > 0 && q.slots.data[i].ordem == q.slots.data[i - 1].ordem)
+            continue;
+
+        if(!llAdd(result, q.slots.data[i].partida)) {
+            free(q.slots.data);
+            llFullFree(result, NULL);
+            return NULL;
+        }
+    }
+
+    free(q.slots.data);
+    return result;
+}
+
+// Contexto da busca linear (sem o índice de adjacência) por partidas
+typedef struct {
+    searchCtxFunc check;  // `checkPrefix` ou `checkNormalizedPrefix`
+    char prefix[TIME_MAX_NAME_SIZE];  // Prefixo buscado (normalizado na busca normalizada)
+    bool mandante;        // Verificar o time mandante
+    bool visitante;       // Verificar o time visitante
+} PartidaPrefixCtx;
+
+static bool partidaDBPrefixCtxCheck(void* partida, void* ctx) {
+    PartidaPrefixCtx* c = (PartidaPrefixCtx*)ctx;
+
+    if(partida == NULL)
+        return false;
+
+    return (c->mandante && c->check(partidaGetT1((Partida*)partida), c->prefix)) ||
+           (c->visitante && c->check(partidaGetT2((Partida*)partida), c->prefix));
+}
+
+/**
+ * partidaDBSearch
+ * 
+ * Busca comum às três pesquisas por prefixo: pelo índice de adjacência e, se ele não puder ser
+ * usado, percorrendo todas as partidas. Na busca normalizada o prefixo é normalizado uma única vez,
+ * e cada time é comparado pela sua chave já normalizada.
+ * 
+ * Retorna:
+ *  - Uma lista de partidas que correspondem à pesquisa, ou `NULL` se o banco não foi iniciado.
+ */
+static LinkedList* partidaDBSearch(char timeName[TIME_MAX_NAME_SIZE], TipoBusca tipo, bool mandante, bool visitante) {
+    PartidaPrefixCtx ctx;
+    LinkedList* result;
+
+    if(!timeDBStarted() || partidaDB.partidas == NULL)
+        return NULL;
+
+    result = partidaDBSearchIndexed(timeName, tipo, mandante, visitante);
+    if(result != NULL)
+        return result;
+
+    if(tipo == BUSCA_NORMALIZADA) {
+        ctx.check = checkNormalizedPrefix;
+        timeNormalizeName(timeName, ctx.prefix);
+    } else {
+        ctx.check = checkPrefix;
+        strncpy(ctx.prefix, timeName, TIME_MAX_NAME_SIZE - 1);
+        ctx.prefix[TIME_MAX_NAME_SIZE - 1] = '\0';
+    }
+    ctx.mandante = mandante;
+    ctx.visitante = visitante;
+
+    return colSearchAllCtx(partidaDB.partidas, partidaDBPrefixCtxCheck, &ctx);
+}
+
+/**
+ * partidaDBMandantePrefixCheck
+ * 
+ * Verifica se a partida tem o time mandante com o prefixo especificado.
+ * 
+ * Parâmetros:
+ *  - `partida`: Ponteiro para a partida a ser verificada.
+ *  - `prefix`: Prefixo buscado (`const char*`).
+ * 
+ * Retorna:
+ *  - `true` se o time mandante tiver o prefixo especificado.
+ *  - `false` caso contrário.
+ */
+bool partidaDBMandantePrefixCheck(void* partida, void* prefix) {
+    if(partida == NULL)
+        return false;
+
+    return checkPrefix(partidaGetT1((Partida*)partida), prefix);
+}
+
+/**
+ * partidaDBSearchMandante
+ * 
+ * Pesquisa todas as partidas em que o time mandante tenha o prefixo especificado.
+ * 
+ * Parâmetros:
+ *  - `timeName`: Nome do time (prefixo) a ser buscado.
+ *  - `tipo`: `BUSCA_EXATA` ou `BUSCA_NORMALIZADA`.
+ * 
+ * Retorna:
+ *  - Uma lista de partidas que correspondem à pesquisa, ou `NULL` se não houver partidas.
+ */
+LinkedList* partidaDBSearchMandante(char timeName[TIME_MAX_NAME_SIZE], TipoBusca tipo) {
+    return partidaDBSearch(timeName, tipo, true, false);
+}
+
+/**
+ * partidaDBVisitantePrefixCheck
+ * 
+ * Verifica se a partida tem o time visitante com o prefixo especificado.
+ * 
+ * Parâmetros:
+ *  - `partida`: Ponteiro para a partida a ser verificada.
+ *  - `prefix`: Prefixo buscado (`const char*`).
+ * 
+ * Retorna:
+ *  - `true` se o time visitante tiver o prefixo especificado.
+ *  - `false` caso contrário.
+ */
+bool partidaDBVisitantePrefixCheck(void* partida, void* prefix) {
+    if(partida == NULL)
+        return false;
+
+    return checkPrefix(partidaGetT2((Partida*)partida), prefix);
+}
+
+/**
+ * partidaDBSearchVisitante
+ * 
+ * Pesquisa todas as partidas em que o time visitante tenha o prefixo especificado.
+ * 
+ * Parâmetros:
+ *  - `timeName`: Nome do time (prefixo) a ser buscado.
+ *  - `tipo`: `BUSCA_EXATA` ou `BUSCA_NORMALIZADA`.
+ * 
+ * Retorna:
+ *  - Uma lista de partidas que correspondem à pesquisa, ou `NULL` se não houver partidas.
+ */
+LinkedList* partidaDBSearchVisitante(char timeName[TIME_MAX_NAME_SIZE], TipoBusca tipo) {
+    return partidaDBSearch(timeName, tipo, false, true);
+}
+
+/**
+ * partidaDBMandanteOrVisitantePrefixCheck
+ * 
+ * Verifica se a partida tem o time mandante ou visitante com o prefixo especificado.
+ * 
+ * Parâmetros:
+ *  - `partida`: Ponteiro para a partida a ser verificada.
+ *  - `prefix`: Prefixo buscado (`const char*`).
+ * 
+ * Retorna:
+ *  - `true` se algum dos times (mandante ou visitante) tiver o prefixo especificado.
+ *  - `false` caso contrário.
+ */
+bool partidaDBMandanteOrVisitantePrefixCheck(void* partida, void* prefix) {
+    if(partida == NULL)
+        return false;
+
+    return checkPrefix(partidaGetT1((Partida*)partida), prefix) || checkPrefix(partidaGetT2((Partida*)partida), prefix);
+}
+
+/**
+ * partidaDBSearchMandanteOrVisitante
+ * 
+ * Pesquisa todas as partidas em que o time mandante ou visitante tenha o prefixo especificado.
+ * 
+ * Parâmetros:
+ *  - `timeName`: Nome do time (prefixo) a ser buscado.
+ *  - `tipo`: `BUSCA_EXATA` ou `BUSCA_NORMALIZADA`.
+ * 
+ * Retorna:
+ *  - Uma lista de partidas que correspondem à pesquisa, ou `NULL` se não houver partidas.
+ */
+LinkedList* partidaDBSearchMandanteOrVisitante(char timeName[TIME_MAX_NAME_SIZE], TipoBusca tipo) {
+    return partidaDBSearch(timeName, tipo, true, true);
+}
+
+/**
+ * partidaDBGetById
+ * 
+ * Pesquisa uma partida pelo seu ID através do índice hash, em tempo O(1) médio.
+ * 
+ * Parâmetros:
+ *  - `id`: ID da partida a ser pesquisada.
+ * 
+ * Retorna:
+ *  - A partida correspondente ao ID, ou `NULL` se não encontrar.
+ */
+Partida* partidaDBGetById(int id) {
+    int i;
+
+    if(partidaDB.partidas == NULL)
+        return NULL;
+
+    i = partidaIndexFind(id);
+    if(i < 0)
+        return NULL;
+
+    return (Partida*)colHandleGet(partidaDB.byId[i].node);
+}
+
+/**
+ * partidaDBRemove
+ * 
+ * Remove uma partida pelo seu ID, retirando-a do índice e da lista e liberando sua memória.
+ * Tanto a busca quanto a remoção são O(1) médio. A remoção é registrada no log (WAL) antes.
+ * 
+ * Parâmetros:
+ *  - `id`: ID da partida a ser removida.
+ * 
+ * Retorna:
+ *  - `true` se a partida foi removida.
+ *  - `false` se o banco não foi iniciado, a partida não existe ou o log recusou o registro.
+ */
+bool partidaDBRemove(int id) {
+    Partida* p;
+    bool ok = false;
+
+    repoWriteLock();
+
+    p = partidaDBGetById(id);
+    if(p != NULL && partidaDBRegistrar(PARTIDA_WAL_DELETE, p)) {
+        partidaDBAplicarRemocao(id);
+        statsCheck("remocao");
+        partidaDBManutencao();
+        partidaDBCheckpointAutomatico();
+        ok = true;
+    }
+
+    repoWriteUnlock();
+
+    return ok;
+}
+
+/**
+ * partidaDBAtualizarGols
+ * 
+ * Atualiza os gols de uma partida, mantendo a tabela viva de estatísticas por delta:
+ * o resultado antigo é desfeito e o novo aplicado, em O(1). A atualização é registrada no log (WAL) antes.
+ * 
+ * Parâmetros:
+ *  - `id`: ID da partida.
+ *  - `golsT1`: Novos gols do time 1 (mandante).
+ *  - `golsT2`: Novos gols do time 2 (visitante).
+ * 
+ * Retorna:
+ *  - `true` se a partida foi atualizada.
+ *  - `false` se a partida não existe, algum valor de gols é negativo ou o log recusou o registro.
+ */
+bool partidaDBAtualizarGols(int id, int golsT1, int golsT2) {
+    PartidaWALRegistro r;
+    Partida* p;
+    bool ok = false;
+
+    if(golsT1 < 0 || golsT2 < 0)
+        return false;
+
+    repoWriteLock();
+
+    p = partidaDBGetById(id);
+    if(p != NULL) {
+        r.tipo = PARTIDA_WAL_UPDATE;
+        r.id = id;
+        r.t1 = timeGetId(partidaGetT1(p));
+        r.t2 = timeGetId(partidaGetT2(p));
+        r.golsT1 = golsT1;
+        r.golsT2 = golsT2;
+
+        if(partidaWALAppend(&r)) {
+            partidaDBAplicarGols(p, golsT1, golsT2);
+            statsCheck("atualizacao");
+            partidaDBManutencao();
+            partidaDBCheckpointAutomatico();
+            ok = true;
+        }
+    }
+
+    repoWriteUnlock();
+
+    return ok;
+}
+
+/**
+ * partidaDBGetEstatisticas
+ * 
+ * Retorna a tabela viva de estatísticas, mantida por delta a cada inserção, atualização e remoção.
+ * Caso ela tenha sido descartada (falta de memória), é recalculada pela próxima alteração: a leitura
+ * não altera o banco.
+ * 
+ * Parâmetros:
+ *  - `count`: Saída com a quantidade de posições da tabela.
+ * 
+ * Retorna:
+ *  - A tabela indexada pelo ID do time (pertence ao banco; não deve ser liberada nem alterada),
+ *    ou `NULL` em caso de erro.
+ */
+const TimeEstatisticas* partidaDBGetEstatisticas(int* count) {
+    if(count == NULL || partidaDB.partidas == NULL || partidaDB.versao == NULL)
+        return NULL;
+
+    *count = partidaDB.versao->count;
+    return partidaDB.versao->estatisticas;
+}
+
+/**
+ * partidaDBVersaoFixar
+ * 
+ * Fixa a versão atual da tabela viva de estatísticas para leitura sem trava (ver repo.h).
+ * Pega a trava de leitura só pelo tempo de contar a referência.
+ * 
+ * Retorna:
+ *  - A versão fixada, a ser solta com `partidaDBVersaoSoltar`, ou `NULL` se não houver.
+ */
+PartidaDBVersao* partidaDBVersaoFixar() {
+    PartidaDBVersao* v;
+
+    repoReadLock();
+
+    v = partidaDB.partidas != NULL ? partidaDB.versao : NULL;
+    if(v != NULL) {
+        pthread_mutex_lock(&partidaVersaoMutex);
+        v->refs++;
+        pthread_mutex_unlock(&partidaVersaoMutex);
+    }
+
+    repoReadUnlock();
+
+    return v;
+}
+
+/**
+ * partidaDBVersaoEstatisticas
+ * 
+ * Retorna a tabela de estatísticas de uma versão fixada e, em `count`, a quantidade de posições.
+ */
+const TimeEstatisticas* partidaDBVersaoEstatisticas(const PartidaDBVersao* v, int* count) {
+    if(v == NULL || count == NULL)
+        return NULL;
+
+    *count = v->count;
+    return v->estatisticas;
+}
+
+/**
+ * partidaDBVersaoTime
+ * 
+ * Retorna o time de ID `id` na versão fixada, ou `NULL` se o ID não tinha time nela.
+ */
+Time* partidaDBVersaoTime(const PartidaDBVersao* v, int id) {
+    if(v == NULL || id < 0 || id >= v->count)
+        return NULL;
+
+    return v->times[id];
+}
+
+/**
+ * partidaDBVersaoNumero
+ * 
+ * Retorna o número de uma versão fixada (`0` se `v` é `NULL`).
+ */
+unsigned long long partidaDBVersaoNumero(const PartidaDBVersao* v) {
+    return v != NULL ? v->numero : 0;
+}
+
+/**
+ * partidaDBVersaoSoltar
+ * 
+ * Solta uma versão fixada com `partidaDBVersaoFixar` (aceita `NULL`).
+ */
+void partidaDBVersaoSoltar(PartidaDBVersao* v) {
+    if(v != NULL)
+        versaoSoltar(v);
+}
+
+/**
+ * partidaDBVerificarEstatisticas
+ * 
+ * Autoverificação: compara a tabela viva com um recálculo completo das estatísticas.
+ * 
+ * Retorna:
+ *  - `true` se as duas coincidem (ou a tabela viva ainda não existe).
+ *  - `false` se houver divergência ou não for possível recalcular.
+ */
+bool partidaDBVerificarEstatisticas() {
+    PartidaDBVersao* v = partidaDB.versao;
+    TimeEstatisticas* full;
+    int n;
+    int i;
+    bool ok = true;
+
+    if(v == NULL)
+        return true;
+
+    full = partidaDBCalcularEstatisticas(&n);
+    if(full == NULL)
+        return false;
+
+    for(i = 0; i < v->count || i < n; i++) {
+        TimeEstatisticas zero = {0, 0, 0, 0, 0};
+        TimeEstatisticas* a = i < v->count ? &v->estatisticas[i] : &zero;
+        TimeEstatisticas* b = i < n ? &full[i] : &zero;
+
+        if(a->vitorias != b->vitorias || a->empates != b->empates || a->derrotas != b->derrotas ||
+           a->gm != b->gm || a->gs != b->gs) {
+            ok = false;
+            break;
+        }
+    }
+
+    free(full);
+    return ok;
+}
+
+/**
+ * printPartida
+ * 
+ * Imprime os detalhes de uma partida.
+ * 
+ * Parâmetros:
+ *  - `p`: Ponteiro para a partida a ser impressa.
+ */
+void printPartida(Partida* p) {
+    if(p == NULL)
+        printf("Partida Indefinida\n");
+    else
+        printf("ID: %d, Time 1: %s, Time 2: %s, Gols Time 1: %d, Gols Time 2: %d\n", partidaGetId(p), timeGetName(partidaGetT1(p)), timeGetName(partidaGetT2(p)), partidaGetGolsT1(p), partidaGetGolsT2(p));
+}
+
+/**
+ * partidaDBGetAllPartidas
+ * 
+ * Retorna todas as partidas armazenadas no banco de dados de partidas.
+ * 
+ * Retorna:
+ *  - Lista com todas as partidas (pertence ao banco; não deve ser liberada e só vale até a próxima alteração).
+ */
+LinkedList* partidaDBGetAllPartidas() {
+    LinkedList* view;
+
+    // Com ArrayList, a cópia em lista é montada uma vez e descartada pelas alterações que mudam as partidas
+    pthread_mutex_lock(&partidaViewMutex);
+    view = colView(partidaDB.partidas, &partidaDB.partidasView);
+    pthread_mutex_unlock(&partidaViewMutex);
+
+    return view;
+}
+
+#endif
@@ -0,0 +1,485 @@
+#ifndef PARTIDA_WAL_C
+#define PARTIDA_WAL_C 0
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+
+#if defined(_WIN32) || defined(_WIN64)
+    #include <io.h>
+    #define fsync _commit
+    #define ftruncate _chsize
+#else
+    #include <unistd.h>
+#endif
+
+#include "./../../inc/service/wal.h"
+#include "./../../inc/service/snapshot.h"
+
+// Quantidade de registros que cabem no buffer do commit em grupo
+#define PARTIDA_WAL_BUFFER_RECORDS 256
+
+// Estado do log aberto
+typedef struct {
+    FILE* f;                      // Arquivo do log (`NULL` = fechado)
+    unsigned char* buffer;        // Registros codificados aguardando gravação
+    int buffered;                 // Quantidade de registros no buffer
+    int unsynced;                 // Registros gravados ou no buffer desde o último `fsync`
+    long size;                    // Tamanho do arquivo em bytes (sem o buffer)
+    unsigned long long nextLsn;   // Próximo número de sequência
+    int syncEvery;                // Política: `fsync` a cada N registros
+    int syncInterval;             // Política: `fsync` a cada N segundos (0 = desligado)
+    time_t lastSync;              // Momento do último `fsync`
+    long syncCount;               // Quantidade de `fsync` feitos
+} PartidaWAL;
+
+static PartidaWAL wal = {NULL, NULL, 0, 0, 0, 1, PARTIDA_WAL_SYNC_EVERY, PARTIDA_WAL_SYNC_INTERVAL, 0, 0};
+
+/**
+ * walEncode
+ * 
+ * Codifica um registro nos `PARTIDA_WAL_RECORD_SIZE` bytes de `out`, com o CRC no final.
+ */
+static void walEncode(const PartidaWALRegistro* r, unsigned char* out) {
+    unsigned int tipo = (unsigned int)r->tipo;
+    int campos[5];
+    unsigned int crc;
+
+    campos[0] = r->id;
+    campos[1] = r->t1;
+    campos[2] = r->t2;
+    campos[3] = r->golsT1;
+    campos[4] = r->golsT2;
+
+    memcpy(out, &tipo, 4);
+    memcpy(out + 4, campos, 20);
+    memcpy(out + 24, &r->lsn, 8);
+
+    crc = snapshotCrc32(0, out, PARTIDA_WAL_RECORD_SIZE - 4);
+    memcpy(out + PARTIDA_WAL_RECORD_SIZE - 4, &crc, 4);
+}
+
+/**
+ * walDecode
+ * 
+ * Decodifica um registro de `in`, conferindo o CRC e o tipo.
+ * 
+ * Retorna:
+ *  - `true` se o registro é válido.
+ */
+static bool walDecode(const unsigned char* in, PartidaWALRegistro* r) {
+    unsigned int tipo;
+    unsigned int crc;
+    int campos[5];
+
+    memcpy(&crc, in + PARTIDA_WAL_RECORD_SIZE - 4, 4);
+    if(crc != snapshotCrc32(0, in, PARTIDA_WAL_RECORD_SIZE - 4))
+        return false;
+
+    memcpy(&tipo, in, 4);
+    if(tipo < PARTIDA_WAL_INSERT || tipo > PARTIDA_WAL_DELETE)
+        return false;
+
+    memcpy(campos, in + 4, 20);
+    r->tipo = (PartidaWALTipo)tipo;
+    r->id = campos[0];
+    r->t1 = campos[1];
+    r->t2 = campos[2];
+    r->golsT1 = campos[3];
+    r->golsT2 = campos[4];
+    memcpy(&r->lsn, in + 24, 8);
+
+    return true;
+}
+
+/**
+ * walWriteHeader
+ * 
+ * Grava o cabeçalho em um log vazio.
+ */
+static bool walWriteHeader(FILE* f) {
+    unsigned int version = PARTIDA_WAL_VERSION;
+
+    return fwrite(PARTIDA_WAL_MAGIC, 1, 4, f) == 4 && fwrite(&version, 4, 1, f) == 1 && fflush(f) == 0;
+}
+
+/**
+ * walReplay
+ * 
+ * Lê o log do início, aplicando cada registro válido com `lsn` maior que `baseLsn` (os demais já
+ * estão no snapshot). Para no primeiro registro incompleto, corrompido ou fora de sequência.
+ * Os registros são lidos em blocos de `PARTIDA_WAL_BUFFER_RECORDS` no buffer do log (o arquivo
+ * não tem buffer próprio, ver `partidaWALOpen`). Registros que `apply` recusa são reportados em `stderr`.
+ * 
+ * Retorna:
+ *  - O deslocamento (em bytes) do fim da parte válida, ou `-1` se o cabeçalho for inválido.
+ */
+static long walReplay(FILE* f, unsigned long long baseLsn, partidaWALApplyFunc apply, void* ctx, int* aplicados) {
+    unsigned char header[PARTIDA_WAL_HEADER_SIZE];
+    PartidaWALRegistro r;
+    unsigned int version;
+    long valid = PARTIDA_WAL_HEADER_SIZE;
+    size_t lidos;
+    size_t i;
+
+    if(fread(header, 1, PARTIDA_WAL_HEADER_SIZE, f) != PARTIDA_WAL_HEADER_SIZE)
+        return -1;
+
+    memcpy(&version, header + 4, 4);
+    if(memcmp(header, PARTIDA_WAL_MAGIC, 4) != 0 || version != PARTIDA_WAL_VERSION)
+        return -1;
+
+    // Um bloco incompleto só pode ser o fim do arquivo: o registro cortado no meio é descartado
+    do {
+        lidos = fread(wal.buffer, PARTIDA_WAL_RECORD_SIZE, PARTIDA_WAL_BUFFER_RECORDS, f);
+
+        for(i = 0; i < lidos; i++) {
+            if(!walDecode(wal.buffer + i * PARTIDA_WAL_RECORD_SIZE, &r) || r.lsn < wal.nextLsn)
+                return valid;
+
+            if(r.lsn > baseLsn && apply != NULL) {
+                if(apply(&r, ctx)) {
+                    if(aplicados != NULL)
+                        (*aplicados)++;
+                } else {
+                    fprintf(stderr, "Registro %llu do log de partidas nao aplicado (tipo %d, partida %d)\n",
+                            r.lsn, (int)r.tipo, r.id);
+                }
+            }
+
+            wal.nextLsn = r.lsn + 1;
+            valid += PARTIDA_WAL_RECORD_SIZE;
+        }
+    } while(lidos == PARTIDA_WAL_BUFFER_RECORDS);
+
+    return valid;
+}
+
+/**
+ * partidaWALOpen
+ * 
+ * Abre o log, reaplicando os registros existentes, ou cria um log vazio se o arquivo não existir.
+ * 
+ * Parâmetros:
+ *  - `path`: Caminho do arquivo de log.
+ *  - `baseLsn`: `lsn` do último registro já contido no snapshot carregado (`0` se nenhum).
+ *  - `apply`: Função chamada para cada registro válido posterior a `baseLsn` (pode ser `NULL`).
+ *  - `ctx`: Contexto repassado a `apply`.
+ *  - `aplicados`: Saída opcional com a quantidade de registros aplicados.
+ * 
+ * Retorna:
+ *  - `true` se o log foi aberto e está pronto para novos registros.
+ *  - `false` em caso de erro (arquivo inacessível, cabeçalho inválido ou falta de memória).
+ */
+bool partidaWALOpen(const char* path, unsigned long long baseLsn, partidaWALApplyFunc apply, void* ctx, int* aplicados) {
+    FILE* f;
+    long valid;
+
+    if(aplicados != NULL)
+        *aplicados = 0;
+
+    if(wal.f != NULL)
+        partidaWALClose();
+
+    wal.buffer = (unsigned char*)malloc(PARTIDA_WAL_BUFFER_RECORDS * PARTIDA_WAL_RECORD_SIZE);
+    if(wal.buffer == NULL)
+        return false;
+
+    wal.nextLsn = 1;
+    wal.buffered = 0;
+    wal.unsynced = 0;
+    wal.syncCount = 0;
+
+    // "r+b" não cria o arquivo; na primeira execução ele é criado com o cabeçalho.
+    // Sem buffer no `FILE`: o log já grava em lotes, e uma gravação que falha pode ser
+    // desfeita sem deixar bytes pendentes no `FILE` (ver `walCortar`)
+    f = fopen(path, "r+b");
+    if(f != NULL)
+        setvbuf(f, NULL, _IONBF, 0);
+    if(f == NULL) {
+        f = fopen(path, "w+b");
+        if(f != NULL)
+            setvbuf(f, NULL, _IONBF, 0);
+        if(f == NULL || !walWriteHeader(f)) {
+            perror("fopen");
+            if(f != NULL)
+                fclose(f);
+            free(wal.buffer);
+            wal.buffer = NULL;
+            return false;
+        }
+        valid = PARTIDA_WAL_HEADER_SIZE;
+    } else {
+        valid = walReplay(f, baseLsn, apply, ctx, aplicados);
+        if(valid < 0) {
+            fprintf(stderr, "Log de partidas invalido: %s\n", path);
+            fclose(f);
+            free(wal.buffer);
+            wal.buffer = NULL;
+            return false;
+        }
+
+        // Descarta um final incompleto/corrompido, para que os próximos registros fiquem legíveis
+        fflush(f);
+        if(ftruncate(fileno(f), valid) != 0) {
+            perror("ftruncate");
+            fclose(f);
+            free(wal.buffer);
+            wal.buffer = NULL;
+            return false;
+        }
+    }
+
+    // Os números de sequência nunca recuam, mesmo que o log tenha sido truncado por um checkpoint
+    if(wal.nextLsn <= baseLsn)
+        wal.nextLsn = baseLsn + 1;
+
+    fseek(f, valid, SEEK_SET);
+    wal.f = f;
+    wal.size = valid;
+    wal.lastSync = time(NULL);
+
+    return true;
+}
+
+/**
+ * partidaWALIsOpen
+ * 
+ * Verifica se há um log aberto.
+ */
+bool partidaWALIsOpen() {
+    return wal.f != NULL;
+}
+
+/**
+ * walCortar
+ * 
+ * Volta o arquivo para `wal.size` bytes, descartando o que uma gravação que falhou deixou nele.
+ */
+static void walCortar() {
+    clearerr(wal.f);
+
+    if(ftruncate(fileno(wal.f), wal.size) != 0)
+        perror("ftruncate");
+
+    fseek(wal.f, wal.size, SEEK_SET);
+}
+
+/**
+ * walDesfazerUltimo
+ * 
+ * Desfaz o último registro aceito por `partidaWALAppend` cuja gravação falhou: ele sai do buffer
+ * (ou do fim do arquivo, se a gravação passou e só o `fsync` falhou) e o seu `lsn` volta a ser o próximo.
+ */
+static void walDesfazerUltimo() {
+    if(wal.buffered > 0) {
+        wal.buffered--;
+    } else {
+        wal.size -= PARTIDA_WAL_RECORD_SIZE;
+        walCortar();
+    }
+
+    wal.unsynced--;
+    wal.nextLsn--;
+}
+
+/**
+ * partidaWALFlush
+ * 
+ * Grava o buffer no arquivo e, se pedido, sincroniza com o disco. Se a gravação falhar, o arquivo
+ * volta ao tamanho anterior e os registros continuam no buffer; se o `fsync` falhar, eles continuam
+ * no arquivo, ainda não sincronizados.
+ * 
+ * Parâmetros:
+ *  - `sync`: `true` para chamar `fsync` se houver registros ainda não sincronizados.
+ * 
+ * Retorna:
+ *  - `true` se a operação foi bem-sucedida.
+ *  - `false` se a gravação ou o `fsync` falharam.
+ */
+bool partidaWALFlush(bool sync) {
+    int n = wal.buffered;
+
+    if(wal.f == NULL)
+        return true;
+
+    if(n > 0) {
+        if(fwrite(wal.buffer, PARTIDA_WAL_RECORD_SIZE, n, wal.f) != (size_t)n || fflush(wal.f) != 0) {
+            perror("fwrite");
+            walCortar();
+            return false;
+        }
+        wal.size += (long)n * PARTIDA_WAL_RECORD_SIZE;
+        wal.buffered = 0;
+    }
+
+    if(sync && wal.unsynced > 0) {
+        if(fsync(fileno(wal.f)) != 0) {
+            perror("fsync");
+            return false;
+        }
+        wal.unsynced = 0;
+        wal.lastSync = time(NULL);
+        wal.syncCount++;
+    }
+
+    return true;
+}
+
+/**
+ * partidaWALAppend
+ * 
+ * Atribui o próximo `lsn` ao registro e o coloca no buffer; o lote é gravado e sincronizado
+ * quando atinge `syncEvery` registros ou quando o intervalo de `fsync` venceu. Se essa gravação
+ * falhar, o registro é desfeito (sai do buffer e do arquivo, e o `lsn` é devolvido): uma alteração
+ * recusada nunca reaparece ao reaplicar o log.
+ * 
+ * Parâmetros:
+ *  - `r`: Registro a ser acrescentado (recebe o `lsn`).
+ * 
+ * Retorna:
+ *  - `true` se o registro foi aceito.
+ *  - `false` se o log não está aberto ou a gravação falhou.
+ */
+bool partidaWALAppend(PartidaWALRegistro* r) {
+    if(wal.f == NULL || r == NULL)
+        return false;
+
+    if(wal.buffered == PARTIDA_WAL_BUFFER_RECORDS && !partidaWALFlush(false))
+        return false;
+
+    r->lsn = wal.nextLsn++;
+    walEncode(r, wal.buffer + wal.buffered * PARTIDA_WAL_RECORD_SIZE);
+    wal.buffered++;
+    wal.unsynced++;
+
+    // Commit em grupo: grava e sincroniza o lote quando a política manda
+    if(wal.unsynced >= wal.syncEvery ||
+       (wal.syncInterval > 0 && difftime(time(NULL), wal.lastSync) >= wal.syncInterval)) {
+        if(!partidaWALFlush(true)) {
+            walDesfazerUltimo();
+            return false;
+        }
+    }
+
+    return true;
+}
+
+/**
+ * partidaWALTruncate
+ * 
+ * Esvazia o log depois de um checkpoint: descarta o buffer, corta o arquivo no cabeçalho e
+ * sincroniza. O próximo `lsn` continua de onde estava.
+ * 
+ * Retorna:
+ *  - `true` se o log foi truncado.
+ *  - `false` se o log não está aberto ou o `ftruncate`/`fsync` falharam.
+ */
+bool partidaWALTruncate() {
+    if(wal.f == NULL)
+        return false;
+
+    wal.buffered = 0;
+
+    if(fflush(wal.f) != 0 || ftruncate(fileno(wal.f), PARTIDA_WAL_HEADER_SIZE) != 0) {
+        perror("ftruncate");
+        return false;
+    }
+    fseek(wal.f, PARTIDA_WAL_HEADER_SIZE, SEEK_SET);
+    wal.size = PARTIDA_WAL_HEADER_SIZE;
+
+    if(fsync(fileno(wal.f)) != 0) {
+        perror("fsync");
+        return false;
+    }
+    wal.unsynced = 0;
+    wal.lastSync = time(NULL);
+    wal.syncCount++;
+
+    return true;
+}
+
+/**
+ * partidaWALClose
+ * 
+ * Sincroniza os registros pendentes e fecha o log.
+ */
+void partidaWALClose() {
+    if(wal.f != NULL) {
+        partidaWALFlush(true);
+        fclose(wal.f);
+        wal.f = NULL;
+    }
+
+    free(wal.buffer);
+    wal.buffer = NULL;
+    wal.buffered = 0;
+    wal.unsynced = 0;
+    wal.size = 0;
+}
+
+/**
+ * partidaWALSetSync
+ * 
+ * Configura a política de commit em grupo.
+ * 
+ * Parâmetros:
+ *  - `everyRecords`: `fsync` a cada N registros (mínimo 1).
+ *  - `intervalSeconds`: `fsync` quando passar esse tempo desde o último (`0` desliga).
+ */
+void partidaWALSetSync(int everyRecords, int intervalSeconds) {
+    wal.syncEvery = everyRecords > 0 ? everyRecords : 1;
+    wal.syncInterval = intervalSeconds > 0 ? intervalSeconds : 0;
+}
+
+/**
+ * partidaWALSyncPrazoMs
+ * 
+ * Retorna quantos milissegundos faltam para vencer o intervalo de `fsync` dos registros ainda não
+ * sincronizados: `-1` se não há nenhum (ou o intervalo está desligado), `0` se já venceu.
+ */
+long partidaWALSyncPrazoMs() {
+    double passados;
+
+    if(wal.f == NULL || wal.unsynced == 0 || wal.syncInterval == 0)
+        return -1;
+
+    passados = difftime(time(NULL), wal.lastSync);
+    if(passados >= wal.syncInterval)
+        return 0;
+
+    return (long)((wal.syncInterval - passados) * 1000);
+}
+
+/**
+ * partidaWALGetSize
+ * 
+ * Retorna o tamanho do log em bytes, contando os registros ainda no buffer.
+ */
+long partidaWALGetSize() {
+    if(wal.f == NULL)
+        return 0;
+
+    return wal.size + (long)wal.buffered * PARTIDA_WAL_RECORD_SIZE;
+}
+
+/**
+ * partidaWALGetLastLsn
+ * 
+ * Retorna o `lsn` do último registro aceito (`0` se nenhum).
+ */
+unsigned long long partidaWALGetLastLsn() {
+    return wal.nextLsn - 1;
+}
+
+/**
+ * partidaWALGetSyncCount
+ * 
+ * Retorna a quantidade de `fsync` feitos desde a abertura do log.
+ */
+long partidaWALGetSyncCount() {
+    return wal.syncCount;
+}
+
+#endif
@@ -0,0 +1,63 @@
+#ifndef REPO_LOCK_C
+#define REPO_LOCK_C 0
+
+// `PTHREAD_RWLOCK_WRITER_NONRECURSIVE_INITIALIZER_NP` (glibc) só é declarado com `_GNU_SOURCE`
+#ifndef _GNU_SOURCE
+    #define _GNU_SOURCE
+#endif
+
+#include <pthread.h>
+
+#include "./../../inc/service/repo.h"
+
+/*
+    Trava de leitores/escritor dos bancos de times e de partidas.
+
+    A preferência padrão do glibc é pelos leitores: com buscas chegando sem parar, um escritor
+    poderia esperar para sempre. Onde existe, a trava prefere os escritores (um escritor esperando
+    segura os leitores novos), o que também impede que um leitor pegue a trava de novo enquanto já
+    a segura (ver repo.h).
+*/
+#ifdef PTHREAD_RWLOCK_WRITER_NONRECURSIVE_INITIALIZER_NP
+static pthread_rwlock_t repoLock = PTHREAD_RWLOCK_WRITER_NONRECURSIVE_INITIALIZER_NP;
+#else
+static pthread_rwlock_t repoLock = PTHREAD_RWLOCK_INITIALIZER;
+#endif
+
+/**
+ * repoReadLock
+ * 
+ * Pega a trava de leitura (compartilhada com outros leitores).
+ */
+void repoReadLock() {
+    pthread_rwlock_rdlock(&repoLock);
+}
+
+/**
+ * repoReadUnlock
+ * 
+ * Solta a trava de leitura.
+ */
+void repoReadUnlock() {
+    pthread_rwlock_unlock(&repoLock);
+}
+
+/**
+ * repoWriteLock
+ * 
+ * Pega a trava de escrita (exclusiva): espera os leitores em andamento terminarem.
+ */
+void repoWriteLock() {
+    pthread_rwlock_wrlock(&repoLock);
+}
+
+/**
+ * repoWriteUnlock
+ * 
+ * Solta a trava de escrita.
+ */
+void repoWriteUnlock() {
+    pthread_rwlock_unlock(&repoLock);
+}
+
+#endif
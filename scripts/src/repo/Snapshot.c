@@ -0,0 +1,327 @@
+#ifndef SNAPSHOT_C
+#define SNAPSHOT_C 0
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#if defined(_WIN32) || defined(_WIN64)
+    #include <io.h>
+    #include <windows.h>
+    #define fsync _commit
+#else
+    #include <fcntl.h>
+    #include <unistd.h>
+    #include <sys/mman.h>
+    #include <sys/stat.h>
+#endif
+
+#include "./../../inc/service/snapshot.h"
+
+/**
+ * snapshotReplace
+ * 
+ * Substitui `path` por `tmpPath`. No POSIX, `rename` é atômico e o diretório é sincronizado
+ * em seguida para que a troca sobreviva a uma queda; no Windows usa `MoveFileEx`.
+ * 
+ * Retorna:
+ *  - `true` se a troca foi feita.
+ */
+static bool snapshotReplace(const char* tmpPath, const char* path) {
+#if defined(_WIN32) || defined(_WIN64)
+    return MoveFileExA(tmpPath, path, MOVEFILE_REPLACE_EXISTING | MOVEFILE_WRITE_THROUGH) ? true : false;
+#else
+    const char* barra;
+    char* dir;
+    int fd;
+
+    if(rename(tmpPath, path) != 0)
+        return false;
+
+    // Sincroniza o diretório (a nova entrada); uma falha aqui não desfaz a troca
+    barra = strrchr(path, '/');
+    if(barra == NULL) {
+        fd = open(".", O_RDONLY);
+    } else {
+        dir = (char*)malloc(barra - path + 2);
+        if(dir == NULL)
+            return true;
+        memcpy(dir, path, barra - path + 1);
+        dir[barra - path + 1] = '\0';
+        fd = open(dir, O_RDONLY);
+        free(dir);
+    }
+
+    if(fd >= 0) {
+        fsync(fd);
+        close(fd);
+    }
+
+    return true;
+#endif
+}
+
+/**
+ * snapshotBegin
+ * 
+ * Abre `<path>.tmp` para a gravação de um novo snapshot.
+ * 
+ * Parâmetros:
+ *  - `path`: Caminho final do snapshot.
+ *  - `mode`: Modo de abertura do temporário.
+ *  - `tmpPath`: Saída com o caminho do temporário (alocado).
+ * 
+ * Retorna:
+ *  - O arquivo aberto, ou `NULL` se faltar memória ou o arquivo não puder ser criado.
+ */
+FILE* snapshotBegin(const char* path, const char* mode, char** tmpPath) {
+    FILE* f;
+
+    *tmpPath = (char*)malloc(strlen(path) + strlen(SNAPSHOT_TMP_EXTENSION) + 1);
+    if(*tmpPath == NULL)
+        return NULL;
+
+    strcpy(*tmpPath, path);
+    strcat(*tmpPath, SNAPSHOT_TMP_EXTENSION);
+
+    f = fopen(*tmpPath, mode);
+    if(f == NULL) {
+        perror("fopen");
+        free(*tmpPath);
+        *tmpPath = NULL;
+    }
+
+    return f;
+}
+
+/**
+ * snapshotCommit
+ * 
+ * Descarrega, sincroniza e fecha o temporário e o coloca no lugar de `path`.
+ * 
+ * Retorna:
+ *  - `true` se o snapshot foi trocado.
+ *  - `false` se alguma etapa falhou (o temporário é removido).
+ */
+bool snapshotCommit(FILE* f, char* tmpPath, const char* path) {
+    bool ok;
+
+    ok = fflush(f) == 0 && fsync(fileno(f)) == 0;
+    ok = fclose(f) == 0 && ok;
+    ok = ok && snapshotReplace(tmpPath, path);
+
+    if(!ok) {
+        perror("snapshot");
+        remove(tmpPath);
+    }
+    free(tmpPath);
+
+    return ok;
+}
+
+/**
+ * snapshotAbort
+ * 
+ * Fecha e apaga o temporário de um snapshot que não será usado.
+ */
+void snapshotAbort(FILE* f, char* tmpPath) {
+    fclose(f);
+    remove(tmpPath);
+    free(tmpPath);
+}
+
+/**
+ * snapshotCrc32
+ * 
+ * Continua o CRC-32 `crc` sobre `n` bytes de `data`. A tabela é montada na primeira chamada.
+ */
+unsigned int snapshotCrc32(unsigned int crc, const void* data, size_t n) {
+    static unsigned int table[256];
+    static bool tableReady = false;
+    const unsigned char* bytes = (const unsigned char*)data;
+    unsigned int c;
+    size_t i;
+    int k;
+
+    if(!tableReady) {
+        for(i = 0; i < 256; i++) {
+            c = (unsigned int)i;
+            for(k = 0; k < 8; k++)
+                c = c & 1 ? 0xEDB88320u ^ (c >> 1) : c >> 1;
+            table[i] = c;
+        }
+        tableReady = true;
+    }
+
+    c = crc ^ 0xFFFFFFFFu;
+    for(i = 0; i < n; i++)
+        c = table[(c ^ bytes[i]) & 0xFF] ^ (c >> 8);
+
+    return c ^ 0xFFFFFFFFu;
+}
+
+/**
+ * snapshotIsBinary
+ * 
+ * Lê os 4 primeiros bytes de `path` e os compara com `magic`.
+ */
+bool snapshotIsBinary(const char* path, const char* magic) {
+    char lido[4];
+    FILE* f;
+    bool ok;
+
+    f = fopen(path, "rb");
+    if(f == NULL)
+        return false;
+
+    ok = fread(lido, 1, 4, f) == 4 && memcmp(lido, magic, 4) == 0;
+    fclose(f);
+
+    return ok;
+}
+
+/**
+ * snapshotMapFile
+ * 
+ * Mapeia o arquivo inteiro em memória, somente leitura.
+ * 
+ * Retorna:
+ *  - O início do mapeamento (com o tamanho em `size`), ou `NULL` em caso de erro ou arquivo vazio.
+ */
+const void* snapshotMapFile(const char* path, size_t* size) {
+#if defined(_WIN32) || defined(_WIN64)
+    HANDLE file, mapping;
+    LARGE_INTEGER tamanho;
+    const void* base = NULL;
+
+    file = CreateFileA(path, GENERIC_READ, FILE_SHARE_READ, NULL, OPEN_EXISTING, FILE_ATTRIBUTE_NORMAL, NULL);
+    if(file == INVALID_HANDLE_VALUE)
+        return NULL;
+
+    if(GetFileSizeEx(file, &tamanho) && tamanho.QuadPart > 0) {
+        mapping = CreateFileMappingA(file, NULL, PAGE_READONLY, 0, 0, NULL);
+        if(mapping != NULL) {
+            base = MapViewOfFile(mapping, FILE_MAP_READ, 0, 0, 0);
+            CloseHandle(mapping);
+        }
+        *size = (size_t)tamanho.QuadPart;
+    }
+    CloseHandle(file);
+
+    return base;
+#else
+    struct stat st;
+    void* base;
+    int fd;
+
+    fd = open(path, O_RDONLY);
+    if(fd < 0)
+        return NULL;
+
+    if(fstat(fd, &st) != 0 || st.st_size <= 0) {
+        close(fd);
+        return NULL;
+    }
+
+    // O mapeamento continua válido depois de fechar o descritor
+    base = mmap(NULL, (size_t)st.st_size, PROT_READ, MAP_PRIVATE, fd, 0);
+    close(fd);
+    if(base == MAP_FAILED)
+        return NULL;
+
+    // Os registros são lidos do início ao fim: o kernel pode adiantar a leitura das próximas páginas
+    madvise(base, (size_t)st.st_size, MADV_SEQUENTIAL);
+    *size = (size_t)st.st_size;
+
+    return base;
+#endif
+}
+
+/**
+ * snapshotUnmapFile
+ * 
+ * Desfaz um mapeamento feito por `snapshotMapFile`.
+ */
+void snapshotUnmapFile(const void* base, size_t size) {
+#if defined(_WIN32) || defined(_WIN64)
+    (void)size;
+    UnmapViewOfFile(base);
+#else
+    munmap((void*)base, size);
+#endif
+}
+
+/**
+ * snapshotMapOpen
+ * 
+ * Mapeia o snapshot binário e valida cabeçalho, tamanho e CRC-32 dos registros.
+ * 
+ * Retorna:
+ *  - `true` se o snapshot é válido e está mapeado em `map`.
+ *  - `false` caso contrário.
+ */
+bool snapshotMapOpen(const char* path, const char* magic, unsigned int recordSize, SnapshotMap* map) {
+    const SnapshotHeader* h;
+
+    map->base = snapshotMapFile(path, &map->size);
+    if(map->base == NULL) {
+        perror("mmap");
+        return false;
+    }
+
+    h = (const SnapshotHeader*)map->base;
+
+    if(map->size < sizeof(SnapshotHeader) || memcmp(h->magic, magic, 4) != 0 ||
+       h->version != SNAPSHOT_VERSION || h->recordSize != recordSize ||
+       map->size != sizeof(SnapshotHeader) + (size_t)h->count * recordSize ||
+       h->checksum != snapshotCrc32(0, (const char*)map->base + sizeof(SnapshotHeader), map->size - sizeof(SnapshotHeader))) {
+        fprintf(stderr, "Snapshot invalido: %s\n", path);
+        snapshotUnmapFile(map->base, map->size);
+        map->base = NULL;
+        return false;
+    }
+
+    map->header = h;
+    map->records = (const char*)map->base + sizeof(SnapshotHeader);
+
+    return true;
+}
+
+/**
+ * snapshotMapClose
+ * 
+ * Desfaz o mapeamento do snapshot.
+ */
+void snapshotMapClose(SnapshotMap* map) {
+    if(map->base != NULL)
+        snapshotUnmapFile(map->base, map->size);
+
+    map->base = NULL;
+    map->header = NULL;
+    map->records = NULL;
+}
+
+/**
+ * snapshotWriteHeader
+ * 
+ * Posiciona `f` no início e grava o cabeçalho; o arquivo fica posicionado logo após ele.
+ * 
+ * Retorna:
+ *  - `true` se o cabeçalho foi gravado.
+ */
+bool snapshotWriteHeader(FILE* f, const char* magic, unsigned int recordSize, unsigned int count,
+                         unsigned long long lsn, unsigned int checksum) {
+    SnapshotHeader h;
+
+    memset(&h, 0, sizeof(h));
+    memcpy(h.magic, magic, 4);
+    h.version = SNAPSHOT_VERSION;
+    h.recordSize = recordSize;
+    h.count = count;
+    h.lsn = lsn;
+    h.checksum = checksum;
+
+    return fseek(f, 0, SEEK_SET) == 0 && fwrite(&h, sizeof(h), 1, f) == 1;
+}
+
+#endif
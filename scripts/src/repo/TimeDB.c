@@ -1,282 +1,1356 @@
-#ifndef TIME_DB_C
-#define TIME_DB_C 0
-
-#include <stdio.h>
-
-#include "./../../inc/service/repo.h"
-#include "./../../inc/collections/LinkedList.h"
-
-// Estrutura que representa o banco de dados de times
-struct TimeDB {
-    LinkedList* times;  // Lista de times
-};
-
-// Instância global do banco de dados de times
-static TimeDB timeDB;
-static char prefixSearch[TIME_MAX_NAME_SIZE];  // Prefixo de pesquisa para busca de times
-static int timeIDSearch;  // ID do time sendo pesquisado
-
-/**
- * timeDBStarted
- * 
- * Verifica se o banco de dados de times foi iniciado.
- * 
- * Retorna:
- *  - `true` se o banco de dados de times foi iniciado.
- *  - `false` caso contrário.
- */
-bool timeDBStarted() {
-    return timeDB.times != NULL;
-}
-
-/**
- * addFirstTime
- * 
- * Adiciona o primeiro time ao banco de dados (quando a lista está vazia).
- * 
- * Parâmetros:
- *  - `time_name`: Nome do time a ser adicionado.
- * 
- * Retorna:
- *  - `true` se a operação foi bem-sucedida.
- *  - `false` em caso de erro (falha na alocação de memória ou inserção).
- */
-static bool addFirstTime(const char time_name[TIME_MAX_NAME_SIZE]) {
-    Time* t = newTime(0, time_name);
-    bool ok;
-
-    if(t == NULL)
-        return false;
-
-    ok = sllAdd(timeDB.times, t);
-    if(!ok) {
-        freeTime(t);
-        return false;
-    }
-
-    return true;
-}
-
-/**
- * addNewTime
- * 
- * Adiciona um novo time ao banco de dados com um novo ID sequencial.
- * 
- * Parâmetros:
- *  - `time_name`: Nome do time a ser adicionado.
- * 
- * Retorna:
- *  - `true` se a operação foi bem-sucedida.
- *  - `false` em caso de erro (falha na alocação de memória ou inserção).
- */
-static bool addNewTime(const char time_name[TIME_MAX_NAME_SIZE]) {
-    Time* last;
-    Time* new;
-    bool ok;
-
-    last = llGetLast(timeDB.times);
-    new = newTime(timeGetId(last) + 1, time_name);
-    
-    if(new == NULL)
-        return false;
-
-    ok = sllAdd(timeDB.times, new);
-    if(!ok) {
-        freeTime(new);
-        return false;
-    }
-
-    return true;
-}
-
-/**
- * addTime
- * 
- * Adiciona um time ao banco de dados de times. Se o banco de dados estiver vazio, o primeiro time será adicionado.
- * Caso contrário, um novo time com ID sequencial será adicionado.
- * 
- * Parâmetros:
- *  - `time_name`: Nome do time a ser adicionado.
- * 
- * Retorna:
- *  - `true` se a operação foi bem-sucedida.
- *  - `false` se o banco de dados não foi inicializado ou ocorreu algum erro na inserção.
- */
-bool addTime(const char time_name[TIME_MAX_NAME_SIZE]) {
-    if(timeDB.times == NULL)
-        return false;
-
-    if(llIsEmpty(timeDB.times))
-        return addFirstTime(time_name);
-    else
-        return addNewTime(time_name);
-}
-
-/**
- * checkPrefix
- * 
- * Verifica se o nome do time começa com o prefixo armazenado em `prefixSearch`.
- * 
- * Parâmetros:
- *  - `time`: Ponteiro para o time a ser verificado.
- * 
- * Retorna:
- *  - `true` se o nome do time começar com o prefixo especificado.
- *  - `false` caso contrário.
- */
-bool checkPrefix(void* time) {
-    char* timeName = timeGetName((Time*)time);
-    int i;
-
-    for(i = 0; i < TIME_MAX_NAME_SIZE; i++) {
-        if(prefixSearch[i] == '\0')
-            return true; // Stop early if prefix is exhausted
-        if(timeName[i] != prefixSearch[i])
-            return false;
-    }
-
-    return true;
-}
-
-/**
- * setPrefix
- * 
- * Define o prefixo de pesquisa para os nomes dos times.
- * 
- * Parâmetros:
- *  - `prefix`: O prefixo de nome a ser usado nas buscas.
- */
-void setPrefix(const char prefix[TIME_MAX_NAME_SIZE]) {
-    int i;
-
-    for(i = 0; i < TIME_MAX_NAME_SIZE; i++)
-        prefixSearch[i] = prefix[i];
-
-    prefixSearch[TIME_MAX_NAME_SIZE] = '\0';  // Garante que o prefixo tenha um fim de string válido
-}
-
-/**
- * searchByPrefix
- * 
- * Pesquisa todos os times cujo nome começa com o prefixo especificado.
- * 
- * Parâmetros:
- *  - `prefix`: O prefixo a ser utilizado na busca.
- * 
- * Retorna:
- *  - Uma lista de times cujo nome começa com o prefixo, ou `NULL` se não encontrar nenhum.
- */
-LinkedList* searchByPrefix(const char prefix[TIME_MAX_NAME_SIZE]) {
-    setPrefix(prefix);
-
-    return llSearchAll(timeDB.times, checkPrefix);
-}
-
-/**
- * timeFromFile
- * 
- * Cria uma estrutura `Time` a partir de uma linha de um arquivo CSV.
- * 
- * Parâmetros:
- *  - `buff`: Linha do arquivo CSV contendo os dados do time.
- * 
- * Retorna:
- *  - Um ponteiro para a estrutura `Time` criada a partir dos dados da linha, ou `NULL` em caso de erro.
- */
-static Time* timeFromFile(const char* buff) {
-    char timeName[TIME_MAX_NAME_SIZE];
-    int timeID;
-
-    sscanf(buff, TIME_CSV_PATTERN, &timeID, timeName);
-    return newTime(timeID, timeName);
-}
-
-/**
- * startTimeDB
- * 
- * Inicializa o banco de dados de times, lendo os dados a partir de um arquivo CSV.
- * 
- * Retorna:
- *  - `true` se o banco de dados foi inicializado com sucesso.
- *  - `false` em caso de erro (falha ao alocar memória ou ao ler o arquivo).
- */
-bool startTimeDB() {
-    char buffer[100];
-    Time* t;
-    FILE* f;
-
-    if(timeDB.times == NULL) {
-        timeDB.times = newLinkedList();
-
-        if(timeDB.times == NULL)
-            return false;
-        
-        f = fopen(TIME_CSV, "r");
-
-        if(f == NULL) {
-            perror("fopen");
-            return false;
-        }
-
-        // Limpa o cabeçalho do CSV
-        fgets(buffer, 100, f);
-
-        while(fgets(buffer, 100, f))
-        {
-            t = timeFromFile(buffer);
-            if(t == NULL) {
-                llFullFree(timeDB.times, freeTime);
-                return false;
-            }
-            llAdd(timeDB.times, t);
-        }
-    }
-
-    return true;
-}
-
-/**
- * timeGetById
- * 
- * Função auxiliar para encontrar um time pelo ID.
- * 
- * Parâmetros:
- *  - `time`: Ponteiro para o time a ser verificado.
- * 
- * Retorna:
- *  - `true` se o ID do time corresponder ao ID de pesquisa.
- *  - `false` caso contrário.
- */
-static bool timeGetById(void* time) {
-    return timeGetId((Time*)time) == timeIDSearch;
-}
-
-/**
- * timeDBGetByID
- * 
- * Pesquisa um time pelo seu ID.
- * 
- * Parâmetros:
- *  - `id`: ID do time a ser pesquisado.
- * 
- * Retorna:
- *  - O time correspondente ao ID, ou `NULL` se não encontrar.
- */
-Time* timeDBGetByID(int id) {
-    timeIDSearch = id;
-    return llFindFirst(timeDB.times, timeGetById);
-}
-
-/**
- * timeDBGetAllTimes
- * 
- * Retorna todos os times armazenados no banco de dados de times.
- * 
- * Retorna:
- *  - A lista de todos os times.
- */
-LinkedList* timeDBGetAllTimes() {
-    return timeDB.times;
-}
-
-#endif
+#ifndef TIME_DB_C
+#define TIME_DB_C 0
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <stdint.h>
+#include <pthread.h>
+
+#ifdef __SSE2__
+    #include <emmintrin.h>
+#endif
+
+#include "./../../inc/service/repo.h"
+#include "./../../inc/service/snapshot.h"
+#include "./../../inc/service/csv.h"
+#include "./../../inc/service/trigram.h"
+#include "./../../inc/collections/Collection.h"
+
+// Tamanho do slot de nome na tabela compacta (um registrador SSE2)
+#define TIME_NAME_SLOT_SIZE 16
+
+// Nome de um time na tabela compacta: o nome seguido de zeros até completar os 16 bytes
+typedef struct {
+    char name[TIME_NAME_SLOT_SIZE];
+} TimeNameSlot;
+
+// Quantidade de modos de busca (`TipoBusca`): cada um tem a sua chave por time e o seu índice de prefixo
+#define TIME_DB_TIPOS_BUSCA 2
+
+// Chaves de busca de todos os times (nomes exatos ou normalizados) e o índice de prefixo sobre elas
+typedef struct {
+    TimeNameSlot* slots;  // Chaves contíguas, na ordem da coleção
+    int* ordem;           // Índice de prefixo: posições dos slots em ordem de chave (empates pela posição)
+} TimeNameIndex;
+
+// Estrutura que representa o banco de dados de times
+struct TimeDB {
+    Collection* times;  // Coleção de times (LinkedList ou ArrayList, ver Collection.h)
+    LinkedList* timesView;  // Cópia em lista devolvida por `timeDBGetAllTimes` (só com ArrayList)
+    Time** byId;        // Índice direto por ID (byId[id] == time com aquele ID, ou NULL)
+    size_t byIdCapacity;  // Quantidade de posições alocadas em `byId`
+    int idBound;        // Maior ID indexado + 1
+    char* path;         // Arquivo de onde os times foram carregados (destino do checkpoint)
+    bool binario;       // `true` se `path` é um snapshot binário (ver snapshot.h), `false` se é CSV
+    TimeNameIndex chaves[TIME_DB_TIPOS_BUSCA];  // Tabela compacta e índice de prefixo de cada `TipoBusca`
+    Time** slotTimes;   // Time de cada slot (vetor paralelo aos `slots` das chaves)
+    unsigned int* assinaturas;  // Caracteres presentes em cada chave normalizada (ver `timeDBAssinatura`)
+    int slotCount;      // Quantidade de slots ocupados
+    int slotCapacity;   // Quantidade de slots alocados
+    bool ordemValida;   // `false` durante a carga ou se faltou memória para montar as `ordem`
+    TrigramIndex trigramas;  // Índice de trigramas das chaves normalizadas (busca por substring e aproximada)
+    bool trigramasValidos;   // `false` se faltou memória para o índice de trigramas
+};
+
+// Par nome/posição usado para montar o índice de prefixo de uma vez (ver `timeDBOrdemRebuild`)
+typedef struct {
+    TimeNameSlot chave;
+    int pos;
+} TimeOrdemEntry;
+
+// Capacidade inicial do índice por ID e da tabela compacta de nomes
+#define TIME_DB_INDEX_INITIAL_CAPACITY 16
+
+// `searchByPrefix` varre a tabela de nomes quando o prefixo casa com mais de 1/N dos times
+#define TIME_DB_PREFIX_SCAN_RATIO 64
+
+// Trigramas de uma chave que um único erro de digitação pode desfazer (a troca de duas letras vizinhas desfaz 4)
+#define TIME_DB_TRIGRAMAS_POR_ERRO 4
+
+// Instância global do banco de dados de times
+static TimeDB timeDB;
+
+// Protege a montagem de `timesView` por leitores simultâneos (ver `timeDBGetAllTimes`)
+static pthread_mutex_t timeViewMutex = PTHREAD_MUTEX_INITIALIZER;
+
+/**
+ * timeDBStarted
+ * 
+ * Verifica se o banco de dados de times foi iniciado.
+ * 
+ * Retorna:
+ *  - `true` se o banco de dados de times foi iniciado.
+ *  - `false` caso contrário.
+ */
+bool timeDBStarted() {
+    return timeDB.times != NULL;
+}
+
+/**
+ * timeDBIndexReserve
+ * 
+ * Garante que o índice por ID tenha espaço para a posição `id`, dobrando a capacidade quando necessário.
+ * As novas posições são preenchidas com `NULL`.
+ * 
+ * Parâmetros:
+ *  - `id`: Maior ID que o índice deve comportar.
+ * 
+ * Retorna:
+ *  - `true` se o índice comporta o ID.
+ *  - `false` se o ID estiver fora de `0..TIME_MAX_ID` ou não houver memória suficiente.
+ */
+static bool timeDBIndexReserve(int id) {
+    Time** resized;
+    size_t capacity;
+    size_t i;
+
+    if(id < 0 || id > TIME_MAX_ID)
+        return false;
+
+    if((size_t)id < timeDB.byIdCapacity)
+        return true;
+
+    capacity = timeDB.byIdCapacity > 0 ? timeDB.byIdCapacity : TIME_DB_INDEX_INITIAL_CAPACITY;
+    while(capacity <= (size_t)id) {
+        if(capacity > SIZE_MAX / 2 / sizeof(Time*))
+            return false;
+        capacity *= 2;
+    }
+
+    resized = (Time**)realloc(timeDB.byId, sizeof(Time*) * capacity);
+    if(resized == NULL)
+        return false;
+
+    for(i = timeDB.byIdCapacity; i < capacity; i++)
+        resized[i] = NULL;
+
+    timeDB.byId = resized;
+    timeDB.byIdCapacity = capacity;
+
+    return true;
+}
+
+/**
+ * timeDBIndexTime
+ * 
+ * Registra um time no índice por ID. Caso já exista um time com o mesmo ID, o primeiro é mantido,
+ * preservando o comportamento da antiga busca linear (que retornava o primeiro encontrado).
+ * 
+ * Parâmetros:
+ *  - `t`: Ponteiro para o time a ser indexado.
+ * 
+ * Retorna:
+ *  - `true` se o time foi indexado (ou já havia um time com o mesmo ID).
+ *  - `false` se o ID for inválido ou não houver memória suficiente.
+ */
+static bool timeDBIndexTime(Time* t) {
+    int id = timeGetId(t);
+
+    if(!timeDBIndexReserve(id))
+        return false;
+
+    if(timeDB.byId[id] == NULL)
+        timeDB.byId[id] = t;
+
+    if(id >= timeDB.idBound)
+        timeDB.idBound = id + 1;
+
+    return true;
+}
+
+/**
+ * timeDBIndexFree
+ * 
+ * Libera o índice por ID (sem liberar os times).
+ */
+static void timeDBIndexFree() {
+    free(timeDB.byId);
+    timeDB.byId = NULL;
+    timeDB.byIdCapacity = 0;
+    timeDB.idBound = 0;
+}
+
+static int compareInt(const void* a, const void* b) {
+    int x = *(const int*)a;
+    int y = *(const int*)b;
+
+    return (x > y) - (x < y);
+}
+
+/**
+ * timeDBChave
+ * 
+ * Obtém a chave de um time no modo de busca `tipo` (o nome ou o nome normalizado, já calculado).
+ */
+static const char* timeDBChave(Time* t, TipoBusca tipo) {
+    return tipo == BUSCA_NORMALIZADA ? timeGetNormalizedName(t) : timeGetName(t);
+}
+
+/**
+ * timeDBOrdemBound
+ * 
+ * Busca binária no índice de prefixo, comparando os `len` primeiros bytes de cada chave com `chave`.
+ * 
+ * Parâmetros:
+ *  - `indice`: Chaves e índice de prefixo de um modo de busca.
+ *  - `chave`: Bytes buscados (chave ou prefixo completado com zeros).
+ *  - `len`: Quantidade de bytes comparados.
+ *  - `depois`: `false` para o primeiro nome `>= chave` (limite inferior), `true` para o primeiro `> chave`.
+ * 
+ * Retorna:
+ *  - A posição em `ordem` (entre `0` e `slotCount`).
+ */
+static int timeDBOrdemBound(const TimeNameIndex* indice, const char* chave, int len, bool depois) {
+    int inicio = 0;
+    int fim = timeDB.slotCount;
+    int meio;
+    int cmp;
+
+    while(inicio < fim) {
+        meio = inicio + (fim - inicio) / 2;
+        cmp = memcmp(indice->slots[indice->ordem[meio]].name, chave, len);
+
+        if(cmp < 0 || (depois && cmp == 0))
+            inicio = meio + 1;
+        else
+            fim = meio;
+    }
+
+    return inicio;
+}
+
+static int timeOrdemEntryCompare(const void* a, const void* b) {
+    const TimeOrdemEntry* x = (const TimeOrdemEntry*)a;
+    const TimeOrdemEntry* y = (const TimeOrdemEntry*)b;
+    int cmp = memcmp(x->chave.name, y->chave.name, TIME_NAME_SLOT_SIZE);
+
+    if(cmp != 0)
+        return cmp;
+
+    return (x->pos > y->pos) - (x->pos < y->pos);
+}
+
+/**
+ * timeDBOrdemRebuild
+ * 
+ * Monta os índices de prefixo de uma vez, ordenando todos os slots (usada ao fim da carga).
+ * Sem memória, os índices ficam inválidos e as buscas voltam a varrer as tabelas de chaves.
+ */
+static void timeDBOrdemRebuild() {
+    TimeOrdemEntry* entries;
+    TimeNameIndex* indice;
+    int tipo;
+    int i;
+
+    timeDB.ordemValida = false;
+
+    entries = (TimeOrdemEntry*)malloc(sizeof(TimeOrdemEntry) * (timeDB.slotCount > 0 ? timeDB.slotCount : 1));
+    if(entries == NULL)
+        return;
+
+    for(tipo = 0; tipo < TIME_DB_TIPOS_BUSCA; tipo++) {
+        indice = &timeDB.chaves[tipo];
+
+        for(i = 0; i < timeDB.slotCount; i++) {
+            entries[i].chave = indice->slots[i];
+            entries[i].pos = i;
+        }
+
+        if(timeDB.slotCount > 1)
+            qsort(entries, timeDB.slotCount, sizeof(TimeOrdemEntry), timeOrdemEntryCompare);
+
+        for(i = 0; i < timeDB.slotCount; i++)
+            indice->ordem[i] = entries[i].pos;
+    }
+
+    free(entries);
+    timeDB.ordemValida = true;
+}
+
+/**
+ * timeDBSlotsReserve
+ * 
+ * Garante espaço nas tabelas compactas de chaves para mais um time, dobrando a capacidade quando
+ * necessário. Chamada antes de adicionar o time à coleção, para que `timeDBSlotsAdd` não falhe.
+ * 
+ * Retorna:
+ *  - `true` se há espaço para mais um time.
+ *  - `false` se não houver memória suficiente.
+ */
+static bool timeDBSlotsReserve() {
+    TimeNameSlot* slots;
+    Time** slotTimes;
+    unsigned int* assinaturas;
+    int* ordem;
+    int capacity;
+    int tipo;
+
+    if(timeDB.slotCount < timeDB.slotCapacity)
+        return true;
+
+    capacity = timeDB.slotCapacity > 0 ? timeDB.slotCapacity * 2 : TIME_DB_INDEX_INITIAL_CAPACITY;
+
+    for(tipo = 0; tipo < TIME_DB_TIPOS_BUSCA; tipo++) {
+        // O `malloc` das plataformas de 64 bits devolve blocos alinhados em 16 bytes: cada slot ocupa uma linha de cache inteira ou metade
+        slots = (TimeNameSlot*)realloc(timeDB.chaves[tipo].slots, sizeof(TimeNameSlot) * capacity);
+        if(slots == NULL)
+            return false;
+        timeDB.chaves[tipo].slots = slots;
+
+        ordem = (int*)realloc(timeDB.chaves[tipo].ordem, sizeof(int) * capacity);
+        if(ordem == NULL)
+            return false;
+        timeDB.chaves[tipo].ordem = ordem;
+    }
+
+    slotTimes = (Time**)realloc(timeDB.slotTimes, sizeof(Time*) * capacity);
+    if(slotTimes == NULL)
+        return false;
+    timeDB.slotTimes = slotTimes;
+
+    assinaturas = (unsigned int*)realloc(timeDB.assinaturas, sizeof(unsigned int) * capacity);
+    if(assinaturas == NULL)
+        return false;
+    timeDB.assinaturas = assinaturas;
+
+    timeDB.slotCapacity = capacity;
+    return true;
+}
+
+/**
+ * timeDBAssinatura
+ * 
+ * Resume os caracteres presentes em uma chave em 32 bits (bit `c & 31` de cada byte `c`). Um erro de
+ * digitação muda no máximo 2 bits (tira um caractere e põe outro; a troca de vizinhos não muda nada),
+ * então chaves a até `k` erros diferem em no máximo `2k` bits.
+ */
+static unsigned int timeDBAssinatura(const char* chave) {
+    unsigned int bits = 0;
+
+    for(; *chave != '\0'; chave++)
+        bits |= 1u << ((unsigned char)*chave & 31);
+
+    return bits;
+}
+
+/**
+ * timeDBBitsLigados
+ * 
+ * Conta os bits ligados de `x` (soma em paralelo dos bits vizinhos).
+ */
+static int timeDBBitsLigados(unsigned int x) {
+    x = x - ((x >> 1) & 0x55555555u);
+    x = (x & 0x33333333u) + ((x >> 2) & 0x33333333u);
+    x = (x + (x >> 4)) & 0x0F0F0F0Fu;
+
+    return (int)((x * 0x01010101u) >> 24);
+}
+
+/**
+ * timeDBSlotsAdd
+ * 
+ * Copia as chaves (nome e nome normalizado) de um time recém-adicionado à coleção para o próximo
+ * slot (com espaço já reservado) e, fora da carga, insere o slot nos índices de prefixo (busca
+ * binária + deslocamento, O(times)).
+ */
+static void timeDBSlotsAdd(Time* t) {
+    TimeNameIndex* indice;
+    TimeNameSlot* slot;
+    int tipo;
+    int i;
+
+    for(tipo = 0; tipo < TIME_DB_TIPOS_BUSCA; tipo++) {
+        indice = &timeDB.chaves[tipo];
+        slot = &indice->slots[timeDB.slotCount];
+
+        memset(slot, 0, sizeof(TimeNameSlot));
+        strncpy(slot->name, timeDBChave(t, (TipoBusca)tipo), TIME_MAX_NAME_SIZE - 1);
+
+        if(timeDB.ordemValida) {
+            // Depois das chaves iguais: a posição nova é a maior, o que mantém o desempate pela posição
+            i = timeDBOrdemBound(indice, slot->name, TIME_NAME_SLOT_SIZE, true);
+            memmove(&indice->ordem[i + 1], &indice->ordem[i], sizeof(int) * (timeDB.slotCount - i));
+            indice->ordem[i] = timeDB.slotCount;
+        }
+    }
+
+    timeDB.slotTimes[timeDB.slotCount] = t;
+    timeDB.assinaturas[timeDB.slotCount] = timeDBAssinatura(timeGetNormalizedName(t));
+
+    // Sem memória para o índice de trigramas, as buscas por substring voltam a varrer a tabela de chaves
+    if(timeDB.trigramasValidos && !trigramIndexAdd(&timeDB.trigramas, timeDB.slotCount, timeGetNormalizedName(t))) {
+        trigramIndexFree(&timeDB.trigramas);
+        timeDB.trigramasValidos = false;
+    }
+
+    timeDB.slotCount++;
+}
+
+/**
+ * timeDBSlotsFree
+ * 
+ * Libera as tabelas compactas de chaves, os índices de prefixo e o de trigramas (sem liberar os times).
+ */
+static void timeDBSlotsFree() {
+    int tipo;
+
+    for(tipo = 0; tipo < TIME_DB_TIPOS_BUSCA; tipo++) {
+        free(timeDB.chaves[tipo].slots);
+        free(timeDB.chaves[tipo].ordem);
+        timeDB.chaves[tipo].slots = NULL;
+        timeDB.chaves[tipo].ordem = NULL;
+    }
+
+    free(timeDB.slotTimes);
+    free(timeDB.assinaturas);
+    timeDB.slotTimes = NULL;
+    timeDB.assinaturas = NULL;
+    trigramIndexFree(&timeDB.trigramas);
+    timeDB.trigramasValidos = false;
+    timeDB.ordemValida = false;
+    timeDB.slotCount = 0;
+    timeDB.slotCapacity = 0;
+}
+
+/**
+ * addFirstTime
+ * 
+ * Adiciona o primeiro time ao banco de dados (quando a lista está vazia).
+ * 
+ * Parâmetros:
+ *  - `time_name`: Nome do time a ser adicionado.
+ * 
+ * Retorna:
+ *  - `true` se a operação foi bem-sucedida.
+ *  - `false` em caso de erro (falha na alocação de memória ou inserção).
+ */
+static bool addFirstTime(const char time_name[TIME_MAX_NAME_SIZE]) {
+    Time* t = newTime(0, time_name);
+    bool ok;
+
+    if(t == NULL)
+        return false;
+
+    if(!timeDBIndexReserve(0) || !timeDBSlotsReserve()) {
+        freeTime(t);
+        return false;
+    }
+
+    ok = scolAdd(timeDB.times, t);
+    if(!ok) {
+        freeTime(t);
+        return false;
+    }
+
+    timeDBIndexTime(t);
+    timeDBSlotsAdd(t);
+
+    return true;
+}
+
+/**
+ * addNewTime
+ * 
+ * Adiciona um novo time ao banco de dados com um novo ID sequencial.
+ * 
+ * Parâmetros:
+ *  - `time_name`: Nome do time a ser adicionado.
+ * 
+ * Retorna:
+ *  - `true` se a operação foi bem-sucedida.
+ *  - `false` em caso de erro (falha na alocação de memória ou inserção).
+ */
+static bool addNewTime(const char time_name[TIME_MAX_NAME_SIZE]) {
+    Time* last;
+    Time* new;
+    bool ok;
+
+    last = colGetLast(timeDB.times);
+    new = newTime(timeGetId(last) + 1, time_name);
+    
+    if(new == NULL)
+        return false;
+
+    if(!timeDBIndexReserve(timeGetId(new)) || !timeDBSlotsReserve()) {
+        freeTime(new);
+        return false;
+    }
+
+    ok = scolAdd(timeDB.times, new);
+    if(!ok) {
+        freeTime(new);
+        return false;
+    }
+
+    timeDBIndexTime(new);
+    timeDBSlotsAdd(new);
+
+    return true;
+}
+
+/**
+ * addTime
+ * 
+ * Adiciona um time ao banco de dados de times. Se o banco de dados estiver vazio, o primeiro time será adicionado.
+ * Caso contrário, um novo time com ID sequencial será adicionado. Pega a trava de escrita dos bancos.
+ * 
+ * Parâmetros:
+ *  - `time_name`: Nome do time a ser adicionado.
+ * 
+ * Retorna:
+ *  - `true` se a operação foi bem-sucedida.
+ *  - `false` se o banco de dados não foi inicializado ou ocorreu algum erro na inserção.
+ */
+bool addTime(const char time_name[TIME_MAX_NAME_SIZE]) {
+    bool ok;
+
+    repoWriteLock();
+
+    if(timeDB.times == NULL)
+        ok = false;
+    else if(colIsEmpty(timeDB.times))
+        ok = addFirstTime(time_name);
+    else
+        ok = addNewTime(time_name);
+
+    if(ok) {
+        colViewFree(&timeDB.timesView);
+        partidaDBTimesAlterados();
+    }
+
+    repoWriteUnlock();
+
+    return ok;
+}
+
+/**
+ * timeNameHasPrefix
+ * 
+ * Verifica se `timeName` começa com `prefixSearch` (no máximo `TIME_MAX_NAME_SIZE` caracteres são comparados).
+ */
+static bool timeNameHasPrefix(const char* timeName, const char* prefixSearch) {
+    int i;
+
+    for(i = 0; i < TIME_MAX_NAME_SIZE; i++) {
+        if(prefixSearch[i] == '\0')
+            return true; // Stop early if prefix is exhausted
+        if(timeName[i] != prefixSearch[i])
+            return false;
+    }
+
+    return true;
+}
+
+/**
+ * checkPrefix
+ * 
+ * Verifica se o nome do time começa com o prefixo informado. O prefixo vem pelo contexto,
+ * sem estado global, então buscas diferentes podem usar a função ao mesmo tempo.
+ * 
+ * Parâmetros:
+ *  - `time`: Ponteiro para o time a ser verificado.
+ *  - `prefix`: Prefixo buscado (`const char*`, no máximo `TIME_MAX_NAME_SIZE` caracteres são comparados).
+ * 
+ * Retorna:
+ *  - `true` se o nome do time começar com o prefixo especificado.
+ *  - `false` caso contrário.
+ */
+bool checkPrefix(void* time, void* prefix) {
+    return timeNameHasPrefix(timeGetName((Time*)time), (const char*)prefix);
+}
+
+/**
+ * checkNormalizedPrefix
+ * 
+ * Verifica se o nome normalizado do time começa com o prefixo (já normalizado pelo chamador, uma
+ * vez por busca). Como em `checkPrefix`, o prefixo vem pelo contexto.
+ * 
+ * Parâmetros:
+ *  - `time`: Ponteiro para o time a ser verificado.
+ *  - `prefix`: Prefixo normalizado (`const char*`).
+ * 
+ * Retorna:
+ *  - `true` se o nome normalizado do time começar com o prefixo especificado.
+ *  - `false` caso contrário.
+ */
+bool checkNormalizedPrefix(void* time, void* prefix) {
+    return timeNameHasPrefix(timeGetNormalizedName((Time*)time), (const char*)prefix);
+}
+
+/**
+ * timeDBPrefixKey
+ * 
+ * Prepara a chave de uma busca: o prefixo (no máximo `TIME_MAX_NAME_SIZE` caracteres) completado
+ * com zeros, como os slots. Na busca normalizada, o prefixo é normalizado aqui, uma única vez.
+ * 
+ * Retorna:
+ *  - O tamanho do prefixo.
+ */
+static int timeDBPrefixKey(const char* prefix, TipoBusca tipo, TimeNameSlot* chave) {
+    char normalizado[TIME_MAX_NAME_SIZE];
+    int len;
+
+    if(tipo == BUSCA_NORMALIZADA) {
+        timeNormalizeName(prefix, normalizado);
+        prefix = normalizado;
+    }
+
+    memset(chave, 0, sizeof(TimeNameSlot));
+    for(len = 0; len < TIME_MAX_NAME_SIZE && prefix[len] != '\0'; len++)
+        chave->name[len] = prefix[len];
+
+    return len;
+}
+
+/**
+ * timeDBPrefixRange
+ * 
+ * Localiza no índice de prefixo, com duas buscas binárias (O(log times)), o intervalo
+ * `ordem[*inicio .. *fim)` dos times cuja chave (do modo `tipo`) começa com o prefixo.
+ * 
+ * Retorna:
+ *  - `true` se o intervalo foi calculado.
+ *  - `false` se o índice não está disponível (o chamador varre a tabela de nomes).
+ */
+static bool timeDBPrefixRange(const char* prefix, TipoBusca tipo, int* inicio, int* fim) {
+    TimeNameSlot chave;
+    int len;
+
+    if(!timeDB.ordemValida)
+        return false;
+
+    len = timeDBPrefixKey(prefix, tipo, &chave);
+    *inicio = timeDBOrdemBound(&timeDB.chaves[tipo], chave.name, len, false);
+    *fim = timeDBOrdemBound(&timeDB.chaves[tipo], chave.name, len, true);
+
+    return true;
+}
+
+// Visita de um time encontrado pela varredura; retornar `false` interrompe a busca
+typedef bool (*TimePrefixVisit)(Time* t, void* ctx);
+
+/**
+ * timeDBScanPrefix
+ * 
+ * Varre a tabela compacta de chaves do modo `tipo` inteira, na ordem da coleção, chamando
+ * `f(time, ctx)` para cada time cuja chave começa com o prefixo. Com SSE2, cada slot é comparado com o prefixo em uma
+ * instrução (16 bytes) e o resultado é reduzido a uma máscara de bits, que só precisa ter os bits
+ * do tamanho do prefixo ligados; sem SSE2, usa `memcmp`.
+ * 
+ * Retorna:
+ *  - `false` se `f` interrompeu a busca.
+ */
+static bool timeDBScanPrefix(const char* prefix, TipoBusca tipo, TimePrefixVisit f, void* ctx) {
+    const TimeNameSlot* slots = timeDB.chaves[tipo].slots;
+    TimeNameSlot chave;
+    bool casa;
+    int len;
+    int i;
+#ifdef __SSE2__
+    __m128i alvo;
+    int mascara;
+#endif
+
+    len = timeDBPrefixKey(prefix, tipo, &chave);
+
+#ifdef __SSE2__
+    alvo = _mm_loadu_si128((const __m128i*)chave.name);
+    mascara = (1 << len) - 1;
+#endif
+
+    for(i = 0; i < timeDB.slotCount; i++) {
+#ifdef __SSE2__
+        casa = (_mm_movemask_epi8(_mm_cmpeq_epi8(_mm_loadu_si128((const __m128i*)slots[i].name), alvo)) & mascara) == mascara;
+#else
+        casa = memcmp(slots[i].name, chave.name, len) == 0;
+#endif
+        if(casa && !f(timeDB.slotTimes[i], ctx))
+            return false;
+    }
+
+    return true;
+}
+
+// Contexto de `timeDBForeachPrefix` na varredura
+typedef struct {
+    foreachCtxFunc f;
+    void* ctx;
+} TimeForeachCtx;
+
+static bool timeForeachVisit(Time* t, void* ctx) {
+    TimeForeachCtx* c = (TimeForeachCtx*)ctx;
+
+    c->f(t, c->ctx);
+    return true;
+}
+
+/**
+ * timeDBForeachPrefix
+ * 
+ * Chama `f(time, ctx)` para cada time cujo nome (exato ou normalizado, conforme `tipo`) começa com
+ * o prefixo, em O(log times + k) pelo índice de prefixo do modo (em ordem de chave), sem montar lista.
+ * 
+ * Retorna:
+ *  - `true` se a busca foi feita, `false` se o banco não foi iniciado.
+ */
+bool timeDBForeachPrefix(const char prefix[TIME_MAX_NAME_SIZE], TipoBusca tipo, foreachCtxFunc f, void* ctx) {
+    TimeForeachCtx c;
+    int inicio;
+    int fim;
+    int i;
+
+    if(timeDB.times == NULL || f == NULL)
+        return false;
+
+    if(!timeDBPrefixRange(prefix, tipo, &inicio, &fim)) {
+        c.f = f;
+        c.ctx = ctx;
+        timeDBScanPrefix(prefix, tipo, timeForeachVisit, &c);
+        return true;
+    }
+
+    for(i = inicio; i < fim; i++)
+        f(timeDB.slotTimes[timeDB.chaves[tipo].ordem[i]], ctx);
+
+    return true;
+}
+
+static bool timeListVisit(Time* t, void* ctx) {
+    return llAdd((LinkedList*)ctx, t);
+}
+
+/**
+ * searchByPrefix
+ * 
+ * Pesquisa todos os times cujo nome começa com o prefixo especificado, na ordem da coleção (mesmo
+ * resultado de `checkPrefix`). O índice de prefixo dá o intervalo dos `k` times em O(log times),
+ * e as posições são reordenadas para a ordem da coleção (O(k log k)). Quando o prefixo casa com
+ * muitos times (mais de `1 / TIME_DB_PREFIX_SCAN_RATIO` deles), varrer a tabela de nomes, que já
+ * está na ordem da coleção, sai mais barato. A busca normalizada usa as chaves normalizadas de cada
+ * time (calculadas quando o time é criado ou carregado), com o mesmo custo da exata.
+ * 
+ * Parâmetros:
+ *  - `prefix`: O prefixo a ser utilizado na busca.
+ *  - `tipo`: `BUSCA_EXATA` ou `BUSCA_NORMALIZADA`.
+ * 
+ * Retorna:
+ *  - Uma lista de times cujo nome começa com o prefixo, ou `NULL` se o banco não foi iniciado
+ *    ou faltou memória.
+ */
+LinkedList* searchByPrefix(const char prefix[TIME_MAX_NAME_SIZE], TipoBusca tipo) {
+    LinkedList* result;
+    int* posicoes;
+    int inicio;
+    int fim;
+    int i;
+
+    if(timeDB.times == NULL)
+        return NULL;
+
+    result = newLinkedList();
+    if(result == NULL)
+        return NULL;
+
+    if(!timeDBPrefixRange(prefix, tipo, &inicio, &fim) || (fim - inicio) * TIME_DB_PREFIX_SCAN_RATIO > timeDB.slotCount) {
+        if(!timeDBScanPrefix(prefix, tipo, timeListVisit, result)) {
+            llFullFree(result, NULL);
+            return NULL;
+        }
+        return result;
+    }
+
+    if(fim - inicio == 0)
+        return result;
+
+    posicoes = (int*)malloc(sizeof(int) * (fim - inicio));
+    if(posicoes == NULL) {
+        llFullFree(result, NULL);
+        return NULL;
+    }
+
+    memcpy(posicoes, &timeDB.chaves[tipo].ordem[inicio], sizeof(int) * (fim - inicio));
+    if(fim - inicio > 1)
+        qsort(posicoes, fim - inicio, sizeof(int), compareInt);
+
+    for(i = 0; i < fim - inicio; i++)
+        if(!llAdd(result, timeDB.slotTimes[posicoes[i]])) {
+            free(posicoes);
+            llFullFree(result, NULL);
+            return NULL;
+        }
+
+    free(posicoes);
+    return result;
+}
+
+/**
+ * timeDBConsultaAscii
+ * 
+ * Verifica se a consulta só tem caracteres ASCII. Os caracteres ASCII são normalizados sempre do mesmo
+ * jeito, então uma substring exata em ASCII também é substring da chave normalizada (e o índice de
+ * trigramas, montado sobre as chaves normalizadas, serve à busca exata).
+ */
+static bool timeDBConsultaAscii(const char* consulta) {
+    for(; *consulta != '\0'; consulta++)
+        if((unsigned char)*consulta >= 0x80)
+            return false;
+
+    return true;
+}
+
+/**
+ * searchBySubstring
+ * 
+ * Pesquisa todos os times cujo nome contém a substring, na ordem da coleção. Com 3 bytes ou mais, a
+ * consulta é resolvida pelo índice de trigramas (intersecção das listas de cada trigrama) e só os
+ * candidatos são confirmados; consultas mais curtas, ou sem o índice, varrem a tabela de chaves.
+ * 
+ * Parâmetros:
+ *  - `sub`: A substring buscada.
+ *  - `tipo`: `BUSCA_EXATA` ou `BUSCA_NORMALIZADA`.
+ * 
+ * Retorna:
+ *  - Uma lista de times cujo nome contém a substring, ou `NULL` se o banco não foi iniciado
+ *    ou faltou memória.
+ */
+LinkedList* searchBySubstring(const char sub[TIME_MAX_NAME_SIZE], TipoBusca tipo) {
+    char consulta[TIME_MAX_NAME_SIZE];
+    char normalizada[TIME_MAX_NAME_SIZE];
+    const TimeNameSlot* slots;
+    LinkedList* result;
+    int* posicoes;
+    int count;
+    int i;
+
+    if(timeDB.times == NULL)
+        return NULL;
+
+    result = newLinkedList();
+    if(result == NULL)
+        return NULL;
+
+    timeNormalizeName(sub, normalizada);
+    if(tipo == BUSCA_NORMALIZADA) {
+        strcpy(consulta, normalizada);
+    } else {
+        strncpy(consulta, sub, TIME_MAX_NAME_SIZE - 1);
+        consulta[TIME_MAX_NAME_SIZE - 1] = '\0';
+    }
+
+    slots = timeDB.chaves[tipo].slots;
+
+    if(timeDB.trigramasValidos && (tipo == BUSCA_NORMALIZADA || timeDBConsultaAscii(consulta)) &&
+       trigramIndexSearch(&timeDB.trigramas, normalizada, &posicoes, &count)) {
+        for(i = 0; i < count; i++)
+            if(strstr(slots[posicoes[i]].name, consulta) != NULL && !llAdd(result, timeDB.slotTimes[posicoes[i]])) {
+                free(posicoes);
+                llFullFree(result, NULL);
+                return NULL;
+            }
+
+        free(posicoes);
+        return result;
+    }
+
+    for(i = 0; i < timeDB.slotCount; i++)
+        if(strstr(slots[i].name, consulta) != NULL && !llAdd(result, timeDB.slotTimes[i])) {
+            llFullFree(result, NULL);
+            return NULL;
+        }
+
+    return result;
+}
+
+// Candidato de `searchBySimilarName`: quanto menores os campos, melhor a sugestão
+typedef struct {
+    int distancia;  // Distância de edição até a consulta
+    int diferenca;  // Diferença de tamanho entre a chave e a consulta (desempate)
+    int pos;        // Posição do time na tabela (último desempate: ordem da coleção)
+} TimeSugestao;
+
+static int timeSugestaoCompare(const TimeSugestao* a, const TimeSugestao* b) {
+    if(a->distancia != b->distancia)
+        return a->distancia - b->distancia;
+    if(a->diferenca != b->diferenca)
+        return a->diferenca - b->diferenca;
+
+    return a->pos - b->pos;
+}
+
+/**
+ * timeDBDistancia
+ * 
+ * Distância de edição entre `a` e `b` (inserções, remoções, substituições e trocas de dois caracteres
+ * vizinhos custam 1), calculada linha a linha e interrompida assim que passa de `limite`.
+ * 
+ * Retorna:
+ *  - A distância, ou `limite + 1` se ela for maior que `limite`.
+ */
+static int timeDBDistancia(const char* a, int la, const char* b, int lb, int limite) {
+    int linhas[3][TIME_MAX_NAME_SIZE + 1];
+    int* anterior2 = linhas[0];
+    int* anterior = linhas[1];
+    int* atual = linhas[2];
+    int* aux;
+    int menor;
+    int v;
+    int i;
+    int j;
+
+    if(la - lb > limite || lb - la > limite)
+        return limite + 1;
+
+    for(j = 0; j <= lb; j++)
+        anterior[j] = j;
+
+    for(i = 1; i <= la; i++) {
+        atual[0] = i;
+        menor = i;
+
+        for(j = 1; j <= lb; j++) {
+            v = anterior[j - 1] + (a[i - 1] != b[j - 1]);
+            if(anterior[j] + 1 < v) v = anterior[j] + 1;
+            if(atual[j - 1] + 1 < v) v = atual[j - 1] + 1;
+            if(i > 1 && j > 1 && a[i - 1] == b[j - 2] && a[i - 2] == b[j - 1] && anterior2[j - 2] + 1 < v)
+                v = anterior2[j - 2] + 1;
+
+            atual[j] = v;
+            if(v < menor)
+                menor = v;
+        }
+
+        if(menor > limite)
+            return limite + 1;
+
+        aux = anterior2;
+        anterior2 = anterior;
+        anterior = atual;
+        atual = aux;
+    }
+
+    return anterior[lb] <= limite ? anterior[lb] : limite + 1;
+}
+
+/**
+ * timeDBSugestaoAvaliar
+ * 
+ * Calcula a distância da chave normalizada da posição `pos` até a consulta e, se ela estiver entre
+ * as `max` melhores até agora, a insere em `melhores` (mantido em ordem). As chaves cujos caracteres
+ * diferem demais dos da consulta (`assinatura`) são descartadas sem calcular a distância. Com a lista
+ * cheia, o limite da distância cai para a da pior sugestão, o que encurta os cálculos seguintes.
+ */
+static void timeDBSugestaoAvaliar(const char* consulta, int len, unsigned int assinatura, int pos, int* limite, TimeSugestao* melhores, int* n, int max) {
+    const char* chave = timeDB.chaves[BUSCA_NORMALIZADA].slots[pos].name;
+    TimeSugestao s;
+    int lenChave;
+    int i;
+
+    if(timeDBBitsLigados(timeDB.assinaturas[pos] ^ assinatura) > 2 * *limite)
+        return;
+
+    lenChave = (int)strlen(chave);
+    s.distancia = timeDBDistancia(chave, lenChave, consulta, len, *limite);
+    if(s.distancia > *limite)
+        return;
+
+    s.diferenca = lenChave > len ? lenChave - len : len - lenChave;
+    s.pos = pos;
+
+    if(*n == max && timeSugestaoCompare(&s, &melhores[max - 1]) >= 0)
+        return;
+
+    if(*n < max)
+        (*n)++;
+
+    for(i = *n - 1; i > 0 && timeSugestaoCompare(&s, &melhores[i - 1]) < 0; i--)
+        melhores[i] = melhores[i - 1];
+    melhores[i] = s;
+
+    if(*n == max)
+        *limite = melhores[max - 1].distancia;
+}
+
+/**
+ * searchBySimilarName
+ * 
+ * Busca aproximada ("você quis dizer"): os times cujo nome normalizado está a no máximo `maxDistancia`
+ * erros do nome normalizado buscado, do mais parecido para o menos parecido. Quando o nome é longo o
+ * bastante, só os times com trigramas suficientes em comum são avaliados (cada erro desfaz no máximo
+ * `TIME_DB_TRIGRAMAS_POR_ERRO` trigramas); senão, todas as chaves são avaliadas, descartando de
+ * imediato as de tamanho ou de caracteres muito diferentes (ver `timeDBAssinatura`).
+ * 
+ * Parâmetros:
+ *  - `nome`: Nome buscado.
+ *  - `maxDistancia`: Quantidade máxima de erros (distância de edição).
+ *  - `maxResultados`: Quantidade máxima de sugestões.
+ * 
+ * Retorna:
+ *  - Uma lista de times ordenada pela distância (desempate pela diferença de tamanho e pela ordem da
+ *    coleção), ou `NULL` se o banco não foi iniciado ou faltou memória.
+ */
+LinkedList* searchBySimilarName(const char nome[TIME_MAX_NAME_SIZE], int maxDistancia, int maxResultados) {
+    char consulta[TIME_MAX_NAME_SIZE];
+    TimeSugestao* melhores;
+    LinkedList* result;
+    unsigned int assinatura;
+    int* posicoes;
+    int count;
+    int limite;
+    int minimo;
+    int len;
+    int n = 0;
+    int i;
+
+    if(timeDB.times == NULL)
+        return NULL;
+
+    result = newLinkedList();
+    if(result == NULL)
+        return NULL;
+
+    if(maxResultados > timeDB.slotCount)
+        maxResultados = timeDB.slotCount;
+    if(maxResultados < 1 || maxDistancia < 0)
+        return result;
+
+    melhores = (TimeSugestao*)malloc(sizeof(TimeSugestao) * maxResultados);
+    if(melhores == NULL) {
+        llFullFree(result, NULL);
+        return NULL;
+    }
+
+    timeNormalizeName(nome, consulta);
+    len = (int)strlen(consulta);
+    assinatura = timeDBAssinatura(consulta);
+    limite = maxDistancia < TIME_MAX_NAME_SIZE ? maxDistancia : TIME_MAX_NAME_SIZE;
+    minimo = trigramIndexDistinct(consulta) - TIME_DB_TRIGRAMAS_POR_ERRO * limite;
+
+    if(timeDB.trigramasValidos && minimo >= 1 && trigramIndexCandidates(&timeDB.trigramas, consulta, minimo, &posicoes, &count)) {
+        for(i = 0; i < count; i++)
+            timeDBSugestaoAvaliar(consulta, len, assinatura, posicoes[i], &limite, melhores, &n, maxResultados);
+        free(posicoes);
+    } else {
+        for(i = 0; i < timeDB.slotCount; i++)
+            timeDBSugestaoAvaliar(consulta, len, assinatura, i, &limite, melhores, &n, maxResultados);
+    }
+
+    for(i = 0; i < n; i++)
+        if(!llAdd(result, timeDB.slotTimes[melhores[i].pos])) {
+            free(melhores);
+            llFullFree(result, NULL);
+            return NULL;
+        }
+
+    free(melhores);
+    return result;
+}
+
+/**
+ * timeDBLoadCSV
+ * 
+ * Lê os times de um arquivo CSV (ID e nome, com uma linha de cabeçalho) com o leitor de csv.h.
+ * Uma linha malformada interrompe a carga, com a linha e a coluna informadas em `stderr`.
+ * 
+ * Retorna:
+ *  - `true` se todos os times foram carregados.
+ *  - `false` se o arquivo não pôde ser aberto, tem uma linha inválida ou faltou memória
+ *    (o chamador descarta o banco).
+ */
+static bool timeDBLoadCSV(const char* path) {
+    char timeName[TIME_MAX_NAME_SIZE];
+    CsvReader* csv;
+    bool ok = true;
+    int timeID;
+    Time* t;
+
+    csv = csvOpen(path, CSV_SEPARATOR);
+    if(csv == NULL)
+        return false;
+
+    // Pula o cabeçalho do CSV
+    csvNextRow(csv);
+
+    while(ok && csvNextRow(csv))
+    {
+        if(!csvGetInt(csv, 0, &timeID) || !csvGetString(csv, 1, timeName, TIME_MAX_NAME_SIZE)) {
+            ok = false;
+            break;
+        }
+
+        if(timeID < 0 || timeID > TIME_MAX_ID) {
+            fprintf(stderr, "%s: linha %ld: ID de time %d fora do intervalo 0..%d\n", path, csvGetRow(csv), timeID, TIME_MAX_ID);
+            ok = false;
+            break;
+        }
+
+        t = newTime(timeID, timeName);
+        if(t == NULL || !timeDBIndexTime(t) || !timeDBSlotsReserve() || !colAdd(timeDB.times, t)) {
+            freeTime(t);
+            ok = false;
+        } else {
+            timeDBSlotsAdd(t);
+        }
+    }
+
+    if(csvGetError(csv) != NULL) {
+        fprintf(stderr, "%s: %s\n", path, csvGetError(csv));
+        ok = false;
+    }
+    csvClose(csv);
+
+    return ok;
+}
+
+/**
+ * timeDBLoadBinary
+ * 
+ * Lê os times de um snapshot binário mapeado em memória, sem análise de texto, copiando cada
+ * registro para um novo time (o mapeamento é desfeito no fim).
+ * 
+ * Retorna:
+ *  - `true` se todos os times foram carregados.
+ *  - `false` se o snapshot é inválido ou faltou memória (o chamador descarta o banco).
+ */
+static bool timeDBLoadBinary(const char* path) {
+    const SnapshotTime* registros;
+    char name[SNAPSHOT_TIME_NAME_SIZE];
+    SnapshotMap map;
+    unsigned int i;
+    Time* t;
+
+    if(!snapshotMapOpen(path, SNAPSHOT_MAGIC_TIMES, sizeof(SnapshotTime), &map))
+        return false;
+
+    registros = (const SnapshotTime*)map.records;
+    for(i = 0; i < map.header->count; i++) {
+        memcpy(name, registros[i].name, SNAPSHOT_TIME_NAME_SIZE);
+        name[TIME_MAX_NAME_SIZE - 1] = '\0';
+
+        if(registros[i].id < 0 || registros[i].id > TIME_MAX_ID) {
+            fprintf(stderr, "%s: registro %u: ID de time %d fora do intervalo 0..%d\n", path, i + 1, registros[i].id, TIME_MAX_ID);
+            snapshotMapClose(&map);
+            return false;
+        }
+
+        t = newTime(registros[i].id, name);
+        if(t == NULL || !timeDBIndexTime(t) || !timeDBSlotsReserve() || !colAdd(timeDB.times, t)) {
+            freeTime(t);
+            snapshotMapClose(&map);
+            return false;
+        }
+        timeDBSlotsAdd(t);
+    }
+
+    snapshotMapClose(&map);
+
+    return true;
+}
+
+/**
+ * startTimeDBFromFile
+ * 
+ * Inicializa o banco de dados de times, lendo os dados a partir de um arquivo CSV ou de um
+ * snapshot binário (reconhecido pelo número mágico, ver `snapshot.h`).
+ * 
+ * Parâmetros:
+ *  - `path`: Caminho do arquivo de times.
+ * 
+ * Retorna:
+ *  - `true` se o banco de dados foi inicializado com sucesso.
+ *  - `false` em caso de erro (falha ao alocar memória ou ao ler o arquivo).
+ */
+bool startTimeDBFromFile(const char* path) {
+    bool ok;
+
+    if(timeDB.times == NULL) {
+        timeDB.times = newCollection();
+
+        if(timeDB.times == NULL)
+            return false;
+
+        timeDB.trigramasValidos = true;
+        
+        timeDB.path = (char*)malloc(strlen(path) + 1);
+        if(timeDB.path != NULL) {
+            strcpy(timeDB.path, path);
+            timeDB.binario = snapshotIsBinary(path, SNAPSHOT_MAGIC_TIMES);
+            ok = timeDB.binario ? timeDBLoadBinary(path) : timeDBLoadCSV(path);
+        } else {
+            ok = false;
+        }
+
+        // O índice de prefixo é montado uma vez, ao fim da carga, e mantido por `addTime` depois
+        if(ok)
+            timeDBOrdemRebuild();
+
+        if(!ok) {
+            colFullFree(timeDB.times, freeTime);
+            timeDB.times = NULL;
+            timeDBIndexFree();
+            timeDBSlotsFree();
+            free(timeDB.path);
+            timeDB.path = NULL;
+            return false;
+        }
+    }
+
+    return true;
+}
+
+// Contexto da gravação de um snapshot de times
+typedef struct {
+    FILE* f;             // Arquivo temporário do snapshot
+    bool binario;        // `true` para o formato binário, `false` para CSV
+    bool ok;             // `false` após o primeiro erro de escrita
+    unsigned int crc;    // CRC-32 dos registros gravados (binário)
+    unsigned int count;  // Quantidade de registros gravados
+} TimeSnapshotCtx;
+
+/**
+ * timeSnapshotWrite
+ * 
+ * Grava um time como linha do CSV ou registro binário (`foreachCtxFunc`, contexto `TimeSnapshotCtx`).
+ */
+static void timeSnapshotWrite(void* time, void* ctx) {
+    TimeSnapshotCtx* snap = (TimeSnapshotCtx*)ctx;
+    SnapshotTime r;
+
+    if(!snap->ok)
+        return;
+
+    if(snap->binario) {
+        memset(&r, 0, sizeof(r));
+        r.id = timeGetId(time);
+        strncpy(r.name, timeGetName(time), TIME_MAX_NAME_SIZE - 1);
+        snap->crc = snapshotCrc32(snap->crc, &r, sizeof(r));
+        snap->ok = fwrite(&r, sizeof(r), 1, snap->f) == 1;
+    } else {
+        snap->ok = fprintf(snap->f, TIME_CSV_PATTERN "\n", timeGetId(time), timeGetName(time)) >= 0;
+    }
+    snap->count++;
+}
+
+/**
+ * timeDBExport
+ * 
+ * Grava os times em `path`, de forma atômica, no formato pedido.
+ * 
+ * Retorna:
+ *  - `true` se o arquivo foi gravado.
+ *  - `false` se o banco não foi iniciado ou a gravação falhou.
+ */
+bool timeDBExport(const char* path, bool binario) {
+    TimeSnapshotCtx snap;
+    char* tmpPath;
+
+    if(timeDB.times == NULL)
+        return false;
+
+    snap.f = snapshotBegin(path, binario ? "wb" : "w", &tmpPath);
+    if(snap.f == NULL)
+        return false;
+
+    snap.binario = binario;
+    snap.crc = 0;
+    snap.count = 0;
+
+    // No binário o cabeçalho é regravado no fim, já com a quantidade e o CRC
+    if(binario)
+        snap.ok = snapshotWriteHeader(snap.f, SNAPSHOT_MAGIC_TIMES, sizeof(SnapshotTime), 0, 0, 0);
+    else
+        snap.ok = fprintf(snap.f, TIME_CSV_HEADER "\n") >= 0;
+
+    colForeachCtx(timeDB.times, timeSnapshotWrite, &snap);
+
+    if(snap.ok && binario)
+        snap.ok = snapshotWriteHeader(snap.f, SNAPSHOT_MAGIC_TIMES, sizeof(SnapshotTime), snap.count, 0, snap.crc);
+
+    if(!snap.ok) {
+        snapshotAbort(snap.f, tmpPath);
+        return false;
+    }
+
+    return snapshotCommit(snap.f, tmpPath, path);
+}
+
+/**
+ * timeDBCheckpoint
+ * 
+ * Regrava o arquivo de times (`timeDB.path`) com o estado atual, no mesmo formato em que foi lido.
+ * 
+ * Retorna:
+ *  - `true` se o snapshot foi gravado.
+ *  - `false` se o banco não foi iniciado ou a gravação falhou.
+ */
+bool timeDBCheckpoint() {
+    if(timeDB.times == NULL)
+        return false;
+
+    return timeDBExport(timeDB.path, timeDB.binario);
+}
+
+/**
+ * startTimeDB
+ * 
+ * Inicializa o banco de dados de times a partir do arquivo CSV padrão (`TIME_CSV`).
+ * 
+ * Retorna:
+ *  - `true` se o banco de dados foi inicializado com sucesso.
+ *  - `false` em caso de erro (falha ao alocar memória ou ao ler o arquivo).
+ */
+bool startTimeDB() {
+    return startTimeDBFromFile(TIME_CSV);
+}
+
+/**
+ * timeDBGetByID
+ * 
+ * Pesquisa um time pelo seu ID através do índice direto, em tempo constante.
+ * 
+ * Parâmetros:
+ *  - `id`: ID do time a ser pesquisado.
+ * 
+ * Retorna:
+ *  - O time correspondente ao ID, ou `NULL` se não encontrar.
+ */
+Time* timeDBGetByID(int id) {
+    if(id < 0 || (size_t)id >= timeDB.byIdCapacity)
+        return NULL;
+
+    return timeDB.byId[id];
+}
+
+/**
+ * timeDBGetIdBound
+ * 
+ * Retorna o limite superior (exclusivo) dos IDs de times cadastrados, útil para dimensionar
+ * vetores indexados por ID de time.
+ * 
+ * Retorna:
+ *  - O maior ID cadastrado + 1, ou `0` se não houver times.
+ */
+int timeDBGetIdBound() {
+    return timeDB.idBound;
+}
+
+/**
+ * timeDBGetAllTimes
+ * 
+ * Retorna todos os times armazenados no banco de dados de times.
+ * 
+ * Retorna:
+ *  - A lista de todos os times (pertence ao banco; não deve ser liberada e só vale até o próximo `addTime`).
+ */
+LinkedList* timeDBGetAllTimes() {
+    LinkedList* view;
+
+    // Com ArrayList, a cópia em lista é montada uma vez e descartada por `addTime`
+    pthread_mutex_lock(&timeViewMutex);
+    view = colView(timeDB.times, &timeDB.timesView);
+    pthread_mutex_unlock(&timeViewMutex);
+
+    return view;
+}
+
+#endif
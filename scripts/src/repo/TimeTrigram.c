@@ -0,0 +1,361 @@
+#ifndef TIME_TRIGRAM_C
+#define TIME_TRIGRAM_C 0
+
+#include <stdlib.h>
+#include <string.h>
+
+#include "./../../inc/service/trigram.h"
+#include "./../../inc/service/model.h"
+
+// Maior quantidade de trigramas de um nome (os nomes têm no máximo `TIME_MAX_NAME_SIZE - 1` bytes)
+#define TRIGRAM_MAX_POR_NOME (TIME_MAX_NAME_SIZE - 3)
+
+// Capacidade inicial da lista de posições de um trigrama
+#define TRIGRAM_POSTINGS_INITIAL_CAPACITY 4
+
+static int compareInt(const void* a, const void* b) {
+    int x = *(const int*)a;
+    int y = *(const int*)b;
+
+    return (x > y) - (x < y);
+}
+
+/**
+ * trigramDistintos
+ * 
+ * Extrai os trigramas distintos de um nome (no máximo `TIME_MAX_NAME_SIZE - 1` bytes são lidos),
+ * cada um com os seus 3 bytes em um inteiro.
+ * 
+ * Retorna:
+ *  - A quantidade de trigramas gravados em `trigramas`.
+ */
+static int trigramDistintos(const char* nome, int trigramas[TRIGRAM_MAX_POR_NOME]) {
+    const unsigned char* s = (const unsigned char*)nome;
+    int len;
+    int n = 0;
+    int t;
+    int i;
+    int j;
+
+    for(len = 0; len < TIME_MAX_NAME_SIZE - 1 && s[len] != '\0'; len++);
+
+    for(i = 0; i + 3 <= len; i++) {
+        t = (s[i] << 16) | (s[i + 1] << 8) | s[i + 2];
+
+        for(j = 0; j < n && trigramas[j] != t; j++);
+        if(j == n)
+            trigramas[n++] = t;
+    }
+
+    return n;
+}
+
+/**
+ * trigramSlot
+ * 
+ * Calcula a posição inicial de um trigrama na tabela hash (hash multiplicativo de Fibonacci).
+ */
+static int trigramSlot(int trigrama, int capacity) {
+    return (int)(((unsigned int)trigrama * 2654435769u) & (unsigned int)(capacity - 1));
+}
+
+/**
+ * trigramFind
+ * 
+ * Procura a lista de posições de um trigrama.
+ * 
+ * Retorna:
+ *  - A entrada do trigrama, ou `NULL` se nenhum nome o contém.
+ */
+static const TrigramPostings* trigramFind(const TrigramIndex* idx, int trigrama) {
+    int i;
+
+    if(idx->capacity == 0)
+        return NULL;
+
+    for(i = trigramSlot(trigrama, idx->capacity); idx->tabela[i].posicoes != NULL; i = (i + 1) & (idx->capacity - 1))
+        if(idx->tabela[i].trigrama == trigrama)
+            return &idx->tabela[i];
+
+    return NULL;
+}
+
+/**
+ * trigramGrow
+ * 
+ * Dobra a capacidade da tabela, reinserindo as entradas (as listas de posições são apenas movidas).
+ * 
+ * Retorna:
+ *  - `true` se a tabela foi redimensionada, `false` se faltou memória.
+ */
+static bool trigramGrow(TrigramIndex* idx) {
+    TrigramPostings* tabela;
+    int capacity;
+    int i;
+    int j;
+
+    capacity = idx->capacity > 0 ? idx->capacity * 2 : TRIGRAM_INDEX_INITIAL_CAPACITY;
+
+    tabela = (TrigramPostings*)calloc(capacity, sizeof(TrigramPostings));
+    if(tabela == NULL)
+        return false;
+
+    for(i = 0; i < idx->capacity; i++) {
+        if(idx->tabela[i].posicoes == NULL)
+            continue;
+
+        for(j = trigramSlot(idx->tabela[i].trigrama, capacity); tabela[j].posicoes != NULL; j = (j + 1) & (capacity - 1));
+        tabela[j] = idx->tabela[i];
+    }
+
+    free(idx->tabela);
+    idx->tabela = tabela;
+    idx->capacity = capacity;
+
+    return true;
+}
+
+/**
+ * trigramEntry
+ * 
+ * Procura a entrada de um trigrama, criando-a (com a lista vazia) se ainda não existe. A carga da
+ * tabela é mantida em no máximo 50%.
+ * 
+ * Retorna:
+ *  - A entrada do trigrama, ou `NULL` se faltou memória.
+ */
+static TrigramPostings* trigramEntry(TrigramIndex* idx, int trigrama) {
+    TrigramPostings* p;
+    int i;
+
+    if((idx->size + 1) * 2 > idx->capacity && !trigramGrow(idx))
+        return NULL;
+
+    for(i = trigramSlot(trigrama, idx->capacity); idx->tabela[i].posicoes != NULL; i = (i + 1) & (idx->capacity - 1))
+        if(idx->tabela[i].trigrama == trigrama)
+            return &idx->tabela[i];
+
+    p = &idx->tabela[i];
+    p->posicoes = (int*)malloc(sizeof(int) * TRIGRAM_POSTINGS_INITIAL_CAPACITY);
+    if(p->posicoes == NULL)
+        return NULL;
+
+    p->trigrama = trigrama;
+    p->count = 0;
+    p->capacity = TRIGRAM_POSTINGS_INITIAL_CAPACITY;
+    idx->size++;
+
+    return p;
+}
+
+/**
+ * trigramIndexAdd
+ * 
+ * Acrescenta `pos` à lista de cada trigrama distinto do nome.
+ * 
+ * Retorna:
+ *  - `true` se o nome foi indexado, `false` se faltou memória.
+ */
+bool trigramIndexAdd(TrigramIndex* idx, int pos, const char* nome) {
+    int trigramas[TRIGRAM_MAX_POR_NOME];
+    TrigramPostings* p;
+    int* resized;
+    int n;
+    int i;
+
+    n = trigramDistintos(nome, trigramas);
+
+    for(i = 0; i < n; i++) {
+        p = trigramEntry(idx, trigramas[i]);
+        if(p == NULL)
+            return false;
+
+        if(p->count == p->capacity) {
+            resized = (int*)realloc(p->posicoes, sizeof(int) * p->capacity * 2);
+            if(resized == NULL)
+                return false;
+            p->posicoes = resized;
+            p->capacity *= 2;
+        }
+
+        p->posicoes[p->count++] = pos;
+    }
+
+    return true;
+}
+
+/**
+ * trigramLowerBound
+ * 
+ * Busca binária da primeira posição `>= valor` em `v[inicio .. fim)`.
+ */
+static int trigramLowerBound(const int* v, int inicio, int fim, int valor) {
+    int meio;
+
+    while(inicio < fim) {
+        meio = inicio + (fim - inicio) / 2;
+        if(v[meio] < valor)
+            inicio = meio + 1;
+        else
+            fim = meio;
+    }
+
+    return inicio;
+}
+
+/**
+ * trigramIndexSearch
+ * 
+ * Intersecta as listas dos trigramas da consulta. As listas são ordenadas pelo tamanho e a menor
+ * vira o resultado inicial; cada lista seguinte só filtra esse resultado, por busca binária a
+ * partir da última posição encontrada, então o custo é O(k log n) com `k` o tamanho da menor lista.
+ * 
+ * Retorna:
+ *  - `true` se a busca foi feita, `false` se a consulta é curta demais ou faltou memória.
+ */
+bool trigramIndexSearch(const TrigramIndex* idx, const char* consulta, int** posicoes, int* count) {
+    int trigramas[TRIGRAM_MAX_POR_NOME];
+    const TrigramPostings* listas[TRIGRAM_MAX_POR_NOME];
+    const TrigramPostings* aux;
+    int* resultado;
+    int n;
+    int m;
+    int r;
+    int i;
+    int j;
+    int k;
+
+    *posicoes = NULL;
+    *count = 0;
+
+    n = trigramDistintos(consulta, trigramas);
+    if(n == 0)
+        return false;
+
+    for(i = 0; i < n; i++) {
+        listas[i] = trigramFind(idx, trigramas[i]);
+        if(listas[i] == NULL)
+            return true; // Um trigrama que nenhum nome tem: nenhum resultado
+    }
+
+    // Poucas listas (no máximo `TRIGRAM_MAX_POR_NOME`): ordenação por inserção, menor primeiro
+    for(i = 1; i < n; i++) {
+        aux = listas[i];
+        for(j = i; j > 0 && listas[j - 1]->count > aux->count; j--)
+            listas[j] = listas[j - 1];
+        listas[j] = aux;
+    }
+
+    resultado = (int*)malloc(sizeof(int) * listas[0]->count);
+    if(resultado == NULL)
+        return false;
+
+    memcpy(resultado, listas[0]->posicoes, sizeof(int) * listas[0]->count);
+    m = listas[0]->count;
+
+    for(i = 1; i < n && m > 0; i++) {
+        j = 0;
+        k = 0;
+        for(r = 0; r < m; r++) {
+            j = trigramLowerBound(listas[i]->posicoes, j, listas[i]->count, resultado[r]);
+            if(j == listas[i]->count)
+                break;
+            if(listas[i]->posicoes[j] == resultado[r])
+                resultado[k++] = resultado[r];
+        }
+        m = k;
+    }
+
+    *posicoes = resultado;
+    *count = m;
+    return true;
+}
+
+/**
+ * trigramIndexCandidates
+ * 
+ * Junta as listas dos trigramas da consulta, ordena as posições e mantém as que aparecem em pelo
+ * menos `minimo` listas. O custo é proporcional à soma do tamanho das listas.
+ * 
+ * Retorna:
+ *  - `true` se a busca foi feita, `false` se `minimo` é inválido ou faltou memória.
+ */
+bool trigramIndexCandidates(const TrigramIndex* idx, const char* consulta, int minimo, int** posicoes, int* count) {
+    int trigramas[TRIGRAM_MAX_POR_NOME];
+    const TrigramPostings* listas[TRIGRAM_MAX_POR_NOME];
+    int* todas;
+    int total = 0;
+    int n;
+    int m;
+    int i;
+    int j;
+
+    *posicoes = NULL;
+    *count = 0;
+
+    if(minimo < 1)
+        return false;
+
+    n = trigramDistintos(consulta, trigramas);
+    for(i = 0; i < n; i++) {
+        listas[i] = trigramFind(idx, trigramas[i]);
+        if(listas[i] != NULL)
+            total += listas[i]->count;
+    }
+
+    if(total == 0)
+        return true;
+
+    todas = (int*)malloc(sizeof(int) * total);
+    if(todas == NULL)
+        return false;
+
+    total = 0;
+    for(i = 0; i < n; i++)
+        if(listas[i] != NULL) {
+            memcpy(&todas[total], listas[i]->posicoes, sizeof(int) * listas[i]->count);
+            total += listas[i]->count;
+        }
+
+    qsort(todas, total, sizeof(int), compareInt);
+
+    // Cada posição aparece uma vez por trigrama em comum: basta contar as repetições
+    m = 0;
+    for(i = 0; i < total; i = j) {
+        for(j = i + 1; j < total && todas[j] == todas[i]; j++);
+        if(j - i >= minimo)
+            todas[m++] = todas[i];
+    }
+
+    *posicoes = todas;
+    *count = m;
+    return true;
+}
+
+/**
+ * trigramIndexDistinct
+ * 
+ * Conta os trigramas distintos de um nome.
+ */
+int trigramIndexDistinct(const char* nome) {
+    int trigramas[TRIGRAM_MAX_POR_NOME];
+
+    return trigramDistintos(nome, trigramas);
+}
+
+/**
+ * trigramIndexFree
+ * 
+ * Libera as listas de posições e a tabela, deixando o índice vazio.
+ */
+void trigramIndexFree(TrigramIndex* idx) {
+    int i;
+
+    for(i = 0; i < idx->capacity; i++)
+        free(idx->tabela[i].posicoes);
+
+    free(idx->tabela);
+    memset(idx, 0, sizeof(*idx));
+}
+
+#endif
@@ -0,0 +1,307 @@
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+#include <errno.h>
+#include <fcntl.h>
+#include <unistd.h>
+#include <sys/epoll.h>
+#include <sys/resource.h>
+#include <sys/socket.h>
+#include <sys/un.h>
+
+#include "../../shared/bool.h"
+
+/*
+    Gerador de carga para o modo servidor (`./main -s <socket>`).
+
+    Abre `clientes` conexões e, em cada uma, envia `requisicoes` comandos, um por vez (o próximo só
+    depois da resposta do anterior), todos atendidos por um único laço de eventos. Ao final, mostra
+    a vazão e a latência de cada comando (do envio ao fim da resposta): p50, p90, p99 e máxima.
+
+    Mistura de leitura: 40% `get`, 20% `search time`, 20% `search ambos` e 20% `table 10 <inicio>`.
+    Com `escrita` > 0, essa porcentagem dos comandos vira `insert 0 1 <gols> <gols>`.
+
+    Uso: ./loadclient <socket> [clientes] [requisicoes por cliente] [maior id de partida] [escrita %]
+    Ex.: ./loadclient /tmp/partidas.sock 1000 200 5000
+*/
+
+// Quantidades padrão
+#define LOAD_CLIENTES 100
+#define LOAD_REQUISICOES 1000
+#define LOAD_MAX_ID 1000
+
+// Bytes lidos por `recv` (as linhas de `search` podem ser bem maiores: só o começo delas é guardado)
+#define LOAD_BUFFER (64 * 1024)
+
+// Começo guardado de cada linha da resposta (o bastante para `OK <n>` e `ERR`)
+#define LOAD_CABECALHO 32
+
+#define LOAD_MAX_EVENTOS 256
+
+// Conexão de um cliente
+typedef struct {
+    int fd;
+    int feitas;                // Comandos já respondidos
+    bool tabela;               // O comando em andamento é `table` (resposta com várias linhas)
+    int linhasRestantes;       // Linhas da resposta ainda esperadas (-1 = esperando a primeira)
+    struct timespec envio;     // Momento do envio do comando em andamento
+    char cabecalho[LOAD_CABECALHO];  // Começo da linha em recepção
+    size_t nCabecalho;               // Quantidade de bytes em `cabecalho`
+} LoadCliente;
+
+static double* latencias;  // Latência de cada comando, em µs
+static long nLatencias;
+static long respostasErro;
+static int maxId;
+static int escrita;
+
+static double agoraUs(const struct timespec* t) {
+    return t->tv_sec * 1e6 + t->tv_nsec / 1e3;
+}
+
+static int compareDouble(const void* a, const void* b) {
+    double x = *(const double*)a;
+    double y = *(const double*)b;
+
+    return (x > y) - (x < y);
+}
+
+static double percentil(double p) {
+    long i = (long)(p * (nLatencias - 1) + 0.5);
+
+    return latencias[i];
+}
+
+/**
+ * enviarComando
+ * 
+ * Sorteia e envia o próximo comando do cliente.
+ * 
+ * Retorna:
+ *  - `true` se o comando foi enviado inteiro.
+ */
+static bool enviarComando(LoadCliente* c) {
+    char comando[64];
+    int sorteio = rand() % 100;
+    int len;
+
+    c->tabela = false;
+
+    if(sorteio < escrita) {
+        len = snprintf(comando, sizeof(comando), "insert 0 1 %d %d\n", rand() % 6, rand() % 6);
+    } else {
+        sorteio = rand() % 10;
+        if(sorteio < 4)
+            len = snprintf(comando, sizeof(comando), "get %d\n", rand() % maxId);
+        else if(sorteio < 6)
+            len = snprintf(comando, sizeof(comando), "search time %c%c\n", 'a' + rand() % 26, 'a' + rand() % 26);
+        else if(sorteio < 8)
+            len = snprintf(comando, sizeof(comando), "search ambos %c%c\n", 'a' + rand() % 26, 'a' + rand() % 26);
+        else {
+            len = snprintf(comando, sizeof(comando), "table 10 %d\n", 1 + rand() % 50);
+            c->tabela = true;
+        }
+    }
+
+    c->linhasRestantes = -1;
+    clock_gettime(CLOCK_MONOTONIC, &c->envio);
+
+    // Comandos curtos cabem sempre no buffer do socket
+    return send(c->fd, comando, len, MSG_NOSIGNAL) == len;
+}
+
+/**
+ * receberResposta
+ * 
+ * Lê o que chegou na conexão e conta as linhas da resposta em andamento.
+ * 
+ * Retorna:
+ *  - `1` se a resposta terminou, `0` se ainda faltam linhas, `-1` se a conexão falhou.
+ */
+static int receberResposta(LoadCliente* c) {
+    static char buffer[LOAD_BUFFER];
+    struct timespec fim;
+    ssize_t lidos;
+    char* p;
+    char* quebra;
+    char* limite;
+    size_t k;
+    int terminou = 0;
+
+    lidos = recv(c->fd, buffer, sizeof(buffer), 0);
+    if(lidos <= 0)
+        return lidos < 0 && (errno == EAGAIN || errno == EINTR) ? 0 : -1;
+
+    p = buffer;
+    limite = buffer + lidos;
+
+    while(p < limite) {
+        quebra = memchr(p, '\n', (size_t)(limite - p));
+
+        // Guarda só o começo da linha
+        k = (size_t)((quebra != NULL ? quebra : limite) - p);
+        if(k > LOAD_CABECALHO - 1 - c->nCabecalho)
+            k = LOAD_CABECALHO - 1 - c->nCabecalho;
+        memcpy(c->cabecalho + c->nCabecalho, p, k);
+        c->nCabecalho += k;
+
+        if(quebra == NULL)
+            break;
+
+        c->cabecalho[c->nCabecalho] = '\0';
+        c->nCabecalho = 0;
+        p = quebra + 1;
+
+        if(c->linhasRestantes < 0) {
+            if(strncmp(c->cabecalho, "ERR", 3) == 0)
+                respostasErro++;
+            c->linhasRestantes = c->tabela && strncmp(c->cabecalho, "OK ", 3) == 0 ? atoi(c->cabecalho + 3) : 0;
+        } else {
+            c->linhasRestantes--;
+        }
+
+        // Um comando por vez: nada chega depois do fim da resposta
+        if(c->linhasRestantes == 0) {
+            terminou = 1;
+            break;
+        }
+    }
+
+    if(!terminou)
+        return 0;
+
+    clock_gettime(CLOCK_MONOTONIC, &fim);
+    latencias[nLatencias++] = agoraUs(&fim) - agoraUs(&c->envio);
+    c->feitas++;
+
+    return 1;
+}
+
+static int conectar(const char* caminho) {
+    struct sockaddr_un endereco;
+    int fd = socket(AF_UNIX, SOCK_STREAM, 0);
+
+    if(fd < 0)
+        return -1;
+
+    memset(&endereco, 0, sizeof(endereco));
+    endereco.sun_family = AF_UNIX;
+    strncpy(endereco.sun_path, caminho, sizeof(endereco.sun_path) - 1);
+
+    // Conexão bloqueante (espera a fila do servidor), depois o socket passa a não bloquear
+    if(connect(fd, (struct sockaddr*)&endereco, sizeof(endereco)) != 0 || fcntl(fd, F_SETFL, O_NONBLOCK) != 0) {
+        close(fd);
+        return -1;
+    }
+
+    return fd;
+}
+
+int main(int argc, char* argv[]) {
+    struct epoll_event eventos[LOAD_MAX_EVENTOS];
+    struct epoll_event ev;
+    struct timespec inicio, fim;
+    struct rlimit limite;
+    LoadCliente* clientes;
+    LoadCliente* c;
+    int nClientes = argc > 2 ? atoi(argv[2]) : LOAD_CLIENTES;
+    int requisicoes = argc > 3 ? atoi(argv[3]) : LOAD_REQUISICOES;
+    int abertos;
+    int ep;
+    int n;
+    int i;
+    int r;
+    double ms;
+
+    maxId = argc > 4 ? atoi(argv[4]) : LOAD_MAX_ID;
+    escrita = argc > 5 ? atoi(argv[5]) : 0;
+
+    if(argc < 2 || nClientes < 1 || requisicoes < 1 || maxId < 1 || escrita < 0 || escrita > 100) {
+        printf("Uso: %s <socket> [clientes] [requisicoes por cliente] [maior id de partida] [escrita %%]\n", argv[0]);
+        return 1;
+    }
+
+    // Milhares de conexões: sobe o limite de descritores até o máximo permitido
+    if(getrlimit(RLIMIT_NOFILE, &limite) == 0 && limite.rlim_cur < limite.rlim_max) {
+        limite.rlim_cur = limite.rlim_max;
+        setrlimit(RLIMIT_NOFILE, &limite);
+    }
+
+    clientes = (LoadCliente*)calloc(nClientes, sizeof(LoadCliente));
+    latencias = (double*)malloc(sizeof(double) * nClientes * (size_t)requisicoes);
+    ep = epoll_create1(0);
+    if(clientes == NULL || latencias == NULL || ep < 0) {
+        printf("Memoria insuficiente\n");
+        return 1;
+    }
+
+    for(i = 0; i < nClientes; i++) {
+        clientes[i].fd = conectar(argv[1]);
+        if(clientes[i].fd < 0) {
+            printf("Falha ao conectar o cliente %d em %s: %s\n", i, argv[1], strerror(errno));
+            return 1;
+        }
+
+        ev.events = EPOLLIN;
+        ev.data.ptr = &clientes[i];
+        epoll_ctl(ep, EPOLL_CTL_ADD, clientes[i].fd, &ev);
+    }
+
+    srand(12345);
+    clock_gettime(CLOCK_MONOTONIC, &inicio);
+
+    for(i = 0; i < nClientes; i++)
+        if(!enviarComando(&clientes[i])) {
+            printf("Falha ao enviar\n");
+            return 1;
+        }
+
+    abertos = nClientes;
+    while(abertos > 0) {
+        n = epoll_wait(ep, eventos, LOAD_MAX_EVENTOS, -1);
+        if(n < 0) {
+            if(errno == EINTR)
+                continue;
+            perror("epoll_wait");
+            return 1;
+        }
+
+        for(i = 0; i < n; i++) {
+            c = (LoadCliente*)eventos[i].data.ptr;
+
+            r = receberResposta(c);
+            if(r < 0) {
+                printf("Conexao encerrada pelo servidor\n");
+                return 1;
+            }
+
+            if(r == 0)
+                continue;
+
+            if(c->feitas == requisicoes) {
+                close(c->fd);
+                abertos--;
+            } else if(!enviarComando(c)) {
+                printf("Falha ao enviar\n");
+                return 1;
+            }
+        }
+    }
+
+    clock_gettime(CLOCK_MONOTONIC, &fim);
+    ms = (agoraUs(&fim) - agoraUs(&inicio)) / 1000.0;
+
+    qsort(latencias, nLatencias, sizeof(double), compareDouble);
+
+    printf("%d clientes x %d comandos = %ld comandos em %.1f ms (%.0f comandos/s, %ld respostas ERR)\n",
+           nClientes, requisicoes, nLatencias, ms, nLatencias * 1000.0 / ms, respostasErro);
+    printf("latencia (us): p50 %.1f  p90 %.1f  p99 %.1f  max %.1f\n",
+           percentil(0.50), percentil(0.90), percentil(0.99), latencias[nLatencias - 1]);
+
+    free(latencias);
+    free(clientes);
+    close(ep);
+
+    return 0;
+}
@@ -0,0 +1,42 @@
+#include <stdio.h>
+#include <string.h>
+
+#include "../../inc/service/repo.h"
+
+/*
+    Conversor entre o layout CSV (`times.csv`/`partida.csv`) e o snapshot binário (ver snapshot.h).
+
+    Os arquivos de entrada podem estar em qualquer um dos formatos (reconhecidos pelo conteúdo).
+    As alterações pendentes no log da entrada (`<partidas>.wal`) são reaplicadas antes da
+    conversão, e a saída leva o `lsn` correspondente.
+
+    Uso: ./snapconv <bin|csv> <times entrada> <partidas entrada> <times saida> <partidas saida>
+    Ex.: ./snapconv bin data/times.csv data/partida.csv data/times.bin data/partida.bin
+*/
+
+int main(int argc, char* argv[]) {
+    bool binario;
+
+    if(argc != 6 || (strcmp(argv[1], "bin") != 0 && strcmp(argv[1], "csv") != 0)) {
+        printf("Uso: %s <bin|csv> <times entrada> <partidas entrada> <times saida> <partidas saida>\n", argv[0]);
+        return 1;
+    }
+    binario = strcmp(argv[1], "bin") == 0;
+
+    if(!startTimeDBFromFile(argv[2]) || !startPartidaDBFromFile(argv[3])) {
+        printf("Falha ao carregar %s e %s\n", argv[2], argv[3]);
+        return 1;
+    }
+
+    if(!timeDBExport(argv[4], binario) || !partidaDBExport(argv[5], binario)) {
+        printf("Falha ao gravar %s e %s\n", argv[4], argv[5]);
+        stopPartidaDB();
+        return 1;
+    }
+
+    printf("%d times e %d partidas gravados em %s\n",
+           llGetSize(timeDBGetAllTimes()), llGetSize(partidaDBGetAllPartidas()), binario ? "binario" : "CSV");
+    stopPartidaDB();
+
+    return 0;
+}
@@ -1,157 +1,224 @@
-#ifndef TIME_VIEW_C
-#define TIME_VIEW_C 0
-
-#include <stdio.h>
-#include <string.h>
-
-#include "./0_utils.c"
-#include "../../inc/collections/LinkedList.h"
-#include "../../inc/service/model.h"
-#include "../../inc/service/repo.h"
-
-typedef struct {
-    int id;
-    char nome[TIME_MAX_NAME_SIZE];
-    int vitorias;
-    int empates;
-    int derrotas;
-    int gm;
-    int gs;
-} CalcContext;
-
-
-// Banco global existente
-extern PartidaDB partidaDB;
-
-// Contexto de Busca Global
-CalcContext gContext;
-
-// --------------------------------------------------
-// Função auxiliar que calcula estatísticas de um time
-// --------------------------------------------------
-static void processPartida(void* p)
-{
-    Partida* pt = (Partida*)p;
-
-    int marcou = 0, sofreu = 0;
-
-    // Verifica se o time é mandante ou visitante
-    if (strcmp(timeGetName(partidaGetT1(p)), gContext.nome) == 0) {
-        marcou = partidaGetGolsT1(pt);
-        sofreu = partidaGetGolsT2(pt);
-    } else {
-        marcou = partidaGetGolsT2(pt);
-        sofreu = partidaGetGolsT1(pt);
-    }
-
-    gContext.gm += marcou;
-    gContext.gs += sofreu;
-
-    if (marcou > sofreu) gContext.vitorias++;
-    else if (marcou == sofreu) gContext.empates++;
-    else gContext.derrotas++;
-}
-
-
-static void calcularEstatisticas(Time* t)
-{
-    gContext.id = timeGetId(t);
-    gContext.vitorias = 0;
-    gContext.derrotas = 0;
-    gContext.empates = 0;
-    gContext.gm = 0;
-    gContext.gs = 0;
-    strcpy(gContext.nome, timeGetName(t));
-
-    LinkedList* partidas = partidaDBSearchMandanteOrVisitante(gContext.nome);
-
-    if (partidas == NULL || llIsEmpty(partidas)) {
-        if(partidas) llFullFree(partidas, NULL);
-        return;
-    }
-
-    llForeach(partidas, processPartida);
-
-    llFullFree(partidas, NULL);
-}
-
-
-
-// --------------------------------------------------
-// VIEW PRINCIPAL
-// --------------------------------------------------
-static void printCalc(CalcContext* ctx) {
-    if(ctx == NULL) {
-        printf("Erro: contexto não definido\n");
-        return;
-    }
-
-    int saldo = ctx->gm - ctx->gs;
-    int pontos = ctx->vitorias * 3 + ctx->empates;
-
-    printf("%2d | %-11s | %1d | %1d | %1d | %2d | %2d | %3d | %2d\n",
-            ctx->id,
-            ctx->nome,
-            ctx->vitorias, ctx->empates, ctx->derrotas,
-            ctx->gm, ctx->gs,
-            saldo,
-            pontos
-        );
-}
-
-static void printTime(void* t) {
-    Time* time = (Time*)t;
-    calcularEstatisticas(time);
-    printCalc(&gContext);
-}
-
-static void printTimeViewHeader() {
-    printf("ID | Time        | V | E | D | GM | GS |  S | PG\n");
-    printf("--------------------------------------------------\n");
-}
-
-void viewPrintTime(Time* time) {
-    printTimeViewHeader();
-    if(time == NULL)
-        printf("Time Indefinido");
-    else
-        printTime(time);
-}
-
-void viewPrintTimes(LinkedList* listaDeTimes)
-{
-    if(llIsEmpty(listaDeTimes)) {
-        printf("Nenhum time encontrado.\n");
-        return;
-    }
-
-    printTimeViewHeader();
-    
-
-    llForeach(listaDeTimes, printTime);
-}
-
-void viewBuscarTimesPorPrefixo()
-{
-    printf("=== Buscar Times por Prefixo ===\n");
-
-    char prefix[TIME_MAX_NAME_SIZE];
-    readString("Digite o prefixo do nome do time: ", prefix, TIME_MAX_NAME_SIZE);
-
-    LinkedList* encontrados = searchByPrefix(prefix);
-
-    if (encontrados == NULL || llIsEmpty(encontrados)) {
-        printf("Nenhum time encontrado com prefixo \"%s\".\n", prefix);
-        if (encontrados) llFullFree(encontrados, NULL);
-        return;
-    }
-
-    printf("\nTimes encontrados:\n");
-    viewPrintTimes(encontrados);
-
-    // Importante: liberar apenas a lista wrapper, não os times reais
-    llFullFree(encontrados, NULL);
-}
-
-
+#ifndef TIME_VIEW_C
+#define TIME_VIEW_C 0
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include "./0_utils.c"
+#include "../../inc/collections/LinkedList.h"
+#include "../../inc/service/model.h"
+#include "../../inc/service/repo.h"
+
+typedef struct {
+    int id;
+    char nome[TIME_MAX_NAME_SIZE];
+    int vitorias;
+    int empates;
+    int derrotas;
+    int gm;
+    int gs;
+    unsigned long long chave;  // Chave de classificação compactada (usada na ordenação da tabela)
+} CalcContext;
+
+
+// Estatísticas de todos os times (indexadas por ID), da versão fixada no banco de partidas
+static PartidaDBVersao* gVersao = NULL;
+static const TimeEstatisticas* gEstatisticas = NULL;
+static int gEstatisticasCount = 0;
+
+// --------------------------------------------------
+// Carrega/libera a tabela de estatísticas de todos os times
+// (fixa uma versão: ela não muda até ser solta e não
+// segura os escritores, ver repo.h)
+// --------------------------------------------------
+static bool carregarEstatisticas()
+{
+    gVersao = partidaDBVersaoFixar();
+    gEstatisticas = partidaDBVersaoEstatisticas(gVersao, &gEstatisticasCount);
+    return gEstatisticas != NULL;
+}
+
+static void liberarEstatisticas()
+{
+    partidaDBVersaoSoltar(gVersao);
+    gVersao = NULL;
+    gEstatisticas = NULL;
+    gEstatisticasCount = 0;
+}
+
+// --------------------------------------------------
+// Preenche o contexto informado com as estatísticas de um
+// time, lidas da tabela `estatisticas` (`count` posições)
+// --------------------------------------------------
+static void calcularEstatisticasDe(const TimeEstatisticas* estatisticas, int count, Time* t, CalcContext* ctx)
+{
+    int id = timeGetId(t);
+
+    ctx->id = id;
+    ctx->vitorias = 0;
+    ctx->derrotas = 0;
+    ctx->empates = 0;
+    ctx->gm = 0;
+    ctx->gs = 0;
+    ctx->chave = 0;
+    strcpy(ctx->nome, timeGetName(t));
+
+    if (estatisticas == NULL || id < 0 || id >= count)
+        return;
+
+    ctx->vitorias = estatisticas[id].vitorias;
+    ctx->empates = estatisticas[id].empates;
+    ctx->derrotas = estatisticas[id].derrotas;
+    ctx->gm = estatisticas[id].gm;
+    ctx->gs = estatisticas[id].gs;
+}
+
+// Com a tabela carregada por `carregarEstatisticas`
+static void calcularEstatisticas(Time* t, CalcContext* ctx)
+{
+    calcularEstatisticasDe(gEstatisticas, gEstatisticasCount, t, ctx);
+}
+
+
+
+// --------------------------------------------------
+// VIEW PRINCIPAL
+// --------------------------------------------------
+// Colunas das listagens de times e da tabela de classificação
+static const RenderColuna gColunasTime[] = {
+    {"id",          "ID",    2},
+    {"nome",        "Time", -11},
+    {"vitorias",    "V",     1},
+    {"empates",     "E",     1},
+    {"derrotas",    "D",     1},
+    {"gols_pro",    "GM",    2},
+    {"gols_contra", "GS",    2},
+    {"saldo",       "S",     3},
+    {"pontos",      "PG",    2}
+};
+
+static bool renderTimesBegin(Renderer* r) {
+    return renderBegin(r, stdout, gFormatoSaida, gColunasTime, sizeof(gColunasTime) / sizeof(gColunasTime[0]));
+}
+
+static void renderCalc(Renderer* r, const CalcContext* ctx) {
+    renderInt(r, ctx->id);
+    renderString(r, ctx->nome);
+    renderInt(r, ctx->vitorias);
+    renderInt(r, ctx->empates);
+    renderInt(r, ctx->derrotas);
+    renderInt(r, ctx->gm);
+    renderInt(r, ctx->gs);
+    renderInt(r, ctx->gm - ctx->gs);
+    renderInt(r, ctx->vitorias * 3 + ctx->empates);
+    renderEndRow(r);
+}
+
+static void renderTime(void* t, void* r) {
+    CalcContext ctx;
+
+    calcularEstatisticas((Time*)t, &ctx);
+    renderCalc((Renderer*)r, &ctx);
+}
+
+void viewPrintTime(Time* time) {
+    Renderer r;
+
+    if(time == NULL) {
+        printf("Time Indefinido\n");
+        return;
+    }
+
+    if(!renderTimesBegin(&r)) {
+        renderEnd(&r);
+        printf("Erro: memoria insuficiente.\n");
+        return;
+    }
+
+    carregarEstatisticas();
+    renderTime(time, &r);
+    liberarEstatisticas();
+
+    renderEnd(&r);
+}
+
+void viewPrintTimes(LinkedList* listaDeTimes)
+{
+    Renderer r;
+
+    if(llIsEmpty(listaDeTimes)) {
+        printf("Nenhum time encontrado.\n");
+        return;
+    }
+
+    if(!renderTimesBegin(&r)) {
+        renderEnd(&r);
+        printf("Erro: memoria insuficiente.\n");
+        return;
+    }
+
+    carregarEstatisticas();
+    llForeachCtx(listaDeTimes, renderTime, &r);
+    liberarEstatisticas();
+
+    if(!renderEnd(&r))
+        printf("Erro: listagem incompleta.\n");
+}
+
+// --------------------------------------------------
+// Nenhum time com o prefixo: mostra os times cujo nome
+// contém o texto e, se não houver, os nomes parecidos
+// --------------------------------------------------
+static void viewBuscarTimesSemPrefixo(const char texto[TIME_MAX_NAME_SIZE])
+{
+    LinkedList* encontrados = searchBySubstring(texto, BUSCA_NORMALIZADA);
+
+    if (encontrados != NULL && !llIsEmpty(encontrados)) {
+        printf("\nTimes que contem \"%s\":\n", texto);
+        viewPrintTimes(encontrados);
+        llFullFree(encontrados, NULL);
+        return;
+    }
+    if (encontrados) llFullFree(encontrados, NULL);
+
+    // Textos curtos aceitam menos erros, senão quase todo nome curto vira sugestão
+    int erros = (int)strlen(texto) / TIME_SUGESTOES_LETRAS_POR_ERRO;
+    if (erros > TIME_SUGESTOES_MAX_DISTANCIA)
+        erros = TIME_SUGESTOES_MAX_DISTANCIA;
+
+    encontrados = searchBySimilarName(texto, erros, TIME_SUGESTOES_MAX);
+
+    if (encontrados != NULL && !llIsEmpty(encontrados)) {
+        printf("\nVoce quis dizer:\n");
+        viewPrintTimes(encontrados);
+    }
+    if (encontrados) llFullFree(encontrados, NULL);
+}
+
+void viewBuscarTimesPorPrefixo()
+{
+    printf("=== Buscar Times por Prefixo ===\n");
+
+    char prefix[TIME_MAX_NAME_SIZE];
+    readString("Digite o prefixo do nome do time: ", prefix, TIME_MAX_NAME_SIZE);
+
+    LinkedList* encontrados = searchByPrefix(prefix, BUSCA_NORMALIZADA);
+
+    if (encontrados == NULL || llIsEmpty(encontrados)) {
+        printf("Nenhum time encontrado com prefixo \"%s\".\n", prefix);
+        if (encontrados) llFullFree(encontrados, NULL);
+
+        viewBuscarTimesSemPrefixo(prefix);
+        return;
+    }
+
+    printf("\nTimes encontrados:\n");
+    viewPrintTimes(encontrados);
+
+    // Importante: liberar apenas a lista wrapper, não os times reais
+    llFullFree(encontrados, NULL);
+}
+
+
 #endif
\ No newline at end of file
@@ -1,111 +1,140 @@
-#ifndef PARTIDA_VIEW_C
-#define PARTIDA_VIEW_C 0
-
-#include <stdio.h>
-#include <string.h>
-
-#include "./0_utils.c"
-#include "../../inc/collections/LinkedList.h"
-#include "../../inc/service/model.h"
-#include "../../inc/service/repo.h"
-
-
-// -------------------------------------------------------
-// VIEW PRINCIPAL — Exibir todas as partidas cadastradas
-// -------------------------------------------------------
-static void imprimirPartida(void* p) {
-    Partida* pt = (Partida*)p;
-
-    char resultado;
-
-    if (partidaGetGolsT1(pt) > partidaGetGolsT2(pt)) resultado = 'M';       // Mandante venceu
-    else if (partidaGetGolsT1(pt) < partidaGetGolsT2(pt)) resultado = 'V';  // Visitante venceu
-    else resultado = 'E';                               // Empate
-
-    printf("%2d | %-11s | %-11s | %2d | %2d | %c\n",
-            partidaGetId(pt),
-            timeGetName(partidaGetT1(pt)),
-            timeGetName(partidaGetT2(pt)),
-            partidaGetGolsT1(pt),
-            partidaGetGolsT2(pt),
-            resultado);
-}
-
-void printPartidaViewHeader() {
-    printf("ID | Mandante   | Visitante  | GM | GS | R\n");
-    printf("---------------------------------------------------\n");   
-}
-
-void viewPartidas(LinkedList* listaDePartidas)
-{
-    if (llIsEmpty(listaDePartidas)) {
-        printf("Nenhuma partida cadastrada.\n");
-        return;
-    }
-
-    printPartidaViewHeader();
-
-    llForeach(listaDePartidas, imprimirPartida);
-}
-
-void viewBuscarPartidas()
-{
-    printf("=== Buscar Partidas ===\n");
-    printf("Selecione o modo de busca:\n");
-    printf("1 - Mandante\n");
-    printf("2 - Visitante\n");
-    printf("3 - Mandante ou Visitante\n");
-    printf("Q - Cancelar\n");
-
-    char opcao;
-    LinkedList* lista = NULL;
-    char prefix[TIME_MAX_NAME_SIZE];
-
-    // Leitura da opção
-    while (1) {
-        opcao = toupper(readChar("Opcao: "));
-        if (opcao == '1' || opcao == '2' || opcao == '3' || opcao == 'Q')
-            break;
-
-        printf("Opcao invalida!\n");
-    }
-
-    if (opcao == 'Q') {
-        printf("Operacao cancelada.\n");
-        return;
-    }
-
-    // Leitura do prefixo
-    readString("Digite o prefixo do nome do time: ", prefix, TIME_MAX_NAME_SIZE);
-
-    // Realiza a busca correta
-    switch (opcao) {
-        case '1':
-            lista = partidaDBSearchMandante(prefix);
-            break;
-
-        case '2':
-            lista = partidaDBSearchVisitante(prefix);
-            break;
-
-        case '3':
-            lista = partidaDBSearchMandanteOrVisitante(prefix);
-            break;
-    }
-
-    // Verifica se encontrou algo
-    if (lista == NULL || llIsEmpty(lista)) {
-        printf("Nenhuma partida encontrada com esse criterio.\n");
-        if (lista) llFullFree(lista, NULL);
-        return;
-    }
-
-    // Exibe lista
-    printPartidaViewHeader();
-    viewPartidas(lista);
-
-    // Importante: liberar apenas a lista wrapper
-    llFullFree(lista, NULL);
-}
-
+#ifndef PARTIDA_VIEW_C
+#define PARTIDA_VIEW_C 0
+
+#include <stdio.h>
+#include <string.h>
+
+#include "./0_utils.c"
+#include "../../inc/collections/LinkedList.h"
+#include "../../inc/service/model.h"
+#include "../../inc/service/repo.h"
+
+
+// -------------------------------------------------------
+// VIEW PRINCIPAL — Exibir todas as partidas cadastradas
+// -------------------------------------------------------
+
+// Colunas da listagem de partidas
+static const RenderColuna gColunasPartida[] = {
+    {"id",             "ID",        2},
+    {"mandante",       "Mandante", -11},
+    {"visitante",      "Visitante", -11},
+    {"gols_mandante",  "GM",        2},
+    {"gols_visitante", "GS",        2},
+    {"resultado",      "R",         1}
+};
+
+static bool renderPartidasBegin(Renderer* r, FormatoSaida formato) {
+    return renderBegin(r, stdout, formato, gColunasPartida, sizeof(gColunasPartida) / sizeof(gColunasPartida[0]));
+}
+
+static void renderPartida(void* p, void* r) {
+    Partida* pt = (Partida*)p;
+    Renderer* rd = (Renderer*)r;
+
+    char resultado;
+
+    if (partidaGetGolsT1(pt) > partidaGetGolsT2(pt)) resultado = 'M';       // Mandante venceu
+    else if (partidaGetGolsT1(pt) < partidaGetGolsT2(pt)) resultado = 'V';  // Visitante venceu
+    else resultado = 'E';                               // Empate
+
+    renderInt(rd, partidaGetId(pt));
+    renderString(rd, timeGetName(partidaGetT1(pt)));
+    renderString(rd, timeGetName(partidaGetT2(pt)));
+    renderInt(rd, partidaGetGolsT1(pt));
+    renderInt(rd, partidaGetGolsT2(pt));
+    renderChar(rd, resultado);
+    renderEndRow(rd);
+}
+
+// Uma partida em texto, com cabeçalho (confirmações)
+static void imprimirPartida(Partida* p) {
+    Renderer r;
+
+    if (renderPartidasBegin(&r, FORMATO_TEXTO))
+        renderPartida(p, &r);
+
+    renderEnd(&r);
+}
+
+void viewPartidas(LinkedList* listaDePartidas)
+{
+    Renderer r;
+
+    if (llIsEmpty(listaDePartidas)) {
+        printf("Nenhuma partida cadastrada.\n");
+        return;
+    }
+
+    if (!renderPartidasBegin(&r, gFormatoSaida)) {
+        renderEnd(&r);
+        printf("Erro: memoria insuficiente.\n");
+        return;
+    }
+
+    llForeachCtx(listaDePartidas, renderPartida, &r);
+
+    if (!renderEnd(&r))
+        printf("Erro: listagem incompleta.\n");
+}
+
+void viewBuscarPartidas()
+{
+    printf("=== Buscar Partidas ===\n");
+    printf("Selecione o modo de busca:\n");
+    printf("1 - Mandante\n");
+    printf("2 - Visitante\n");
+    printf("3 - Mandante ou Visitante\n");
+    printf("Q - Cancelar\n");
+
+    char opcao;
+    LinkedList* lista = NULL;
+    char prefix[TIME_MAX_NAME_SIZE];
+
+    // Leitura da opção
+    while (1) {
+        opcao = toupper(readChar("Opcao: "));
+        if (opcao == '1' || opcao == '2' || opcao == '3' || opcao == 'Q')
+            break;
+
+        printf("Opcao invalida!\n");
+    }
+
+    if (opcao == 'Q') {
+        printf("Operacao cancelada.\n");
+        return;
+    }
+
+    // Leitura do prefixo
+    readString("Digite o prefixo do nome do time: ", prefix, TIME_MAX_NAME_SIZE);
+
+    // Realiza a busca correta
+    switch (opcao) {
+        case '1':
+            lista = partidaDBSearchMandante(prefix, BUSCA_NORMALIZADA);
+            break;
+
+        case '2':
+            lista = partidaDBSearchVisitante(prefix, BUSCA_NORMALIZADA);
+            break;
+
+        case '3':
+            lista = partidaDBSearchMandanteOrVisitante(prefix, BUSCA_NORMALIZADA);
+            break;
+    }
+
+    // Verifica se encontrou algo
+    if (lista == NULL || llIsEmpty(lista)) {
+        printf("Nenhuma partida encontrada com esse criterio.\n");
+        if (lista) llFullFree(lista, NULL);
+        return;
+    }
+
+    // Exibe lista
+    viewPartidas(lista);
+
+    // Importante: liberar apenas a lista wrapper
+    llFullFree(lista, NULL);
+}
+
 #endif
\ No newline at end of file
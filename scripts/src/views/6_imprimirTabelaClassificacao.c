@@ -1,146 +1,287 @@
-#ifndef IMPRIMIR_TABELA_CLASSIFICACAO_C
-#define IMPRIMIR_TABELA_CLASSIFICACAO_C 0
-
-#include <stdio.h>
-#include <ctype.h>
-#include "./0_utils.c"
-#include "../../inc/collections/LinkedList.h"
-#include "../../inc/service/model.h"
-#include "../../inc/service/repo.h"
-#include "./1_time.c"
-#include "./2_partida.c"
-
-
-static LinkedList* gCalcContext = NULL;
-
-static void ctxcp(CalcContext* ctx) {
-    ctx->id = gContext.id;
-    ctx->derrotas = gContext.derrotas;
-    ctx->vitorias = gContext.vitorias;
-    ctx->empates = gContext.empates;
-    strcpy(ctx->nome, gContext.nome);
-    ctx->gm = gContext.gm;
-    ctx->gs = gContext.gs;
-}
-
-static void forEachTimeLoadContext(void* t) {
-    CalcContext* ctx;
-    bool ok;
-
-    if(gCalcContext == NULL || t == NULL)
-        return;
-
-    ctx = (CalcContext*)malloc(sizeof(CalcContext));
-    if(ctx == NULL)
-        return;
-
-    calcularEstatisticas((Time*) t);
-    ctxcp(ctx);
-
-    ok = llAdd(gCalcContext, ctx);
-    if(!ok)
-        free(ctx);
-}
-
-static bool loadContext() {
-    if(gCalcContext != NULL)
-        return false;
-
-    gCalcContext = newLinkedList();
-    if(gCalcContext == NULL)
-        return false;
-
-    llForeach(timeDBGetAllTimes(), forEachTimeLoadContext);
-
-    return true;
-}
-
-
-// ===============================================
-// Função de comparação para BubbleSort
-// ===============================================
-static Order orderResult(void* a, void* b)
-{
-    CalcContext* r1 = (CalcContext*)a;
-    CalcContext* r2 = (CalcContext*)b;
-
-    int pg1 = (r1->vitorias*3)+r1->empates;
-    int pg2 = (r2->vitorias*3)+r2->empates;
-
-    // Ordem decrescente
-    if (pg1 > pg2) return greater_than;
-    if (pg1 < pg2) return less_than;
-
-    // Se empatar, ordenar pelo menor ID
-    return equal;
-}
-
-// ===============================================
-// VIEW PAGINADA
-// ===============================================
-
-static void printCalcWrapper(void* calc) {
-    printCalc((CalcContext*)calc);
-}
-
-void viewTabelaClassificacao()
-{
-    printf("=== Partidas (Listagem Paginada) ===\n");
-
-    if(!loadContext()) {
-        printf("Erro: algum erro ocorreu.");
-        return;
-    }
-    
-
-    // Ordenar
-    llBoubleSort(gCalcContext, orderResult);
-
-    const int porPagina = 5;
-    int totalItens = llGetSize(gCalcContext);
-    int totalPaginas = (totalItens + porPagina - 1) / porPagina;
-    int paginaAtual = 1;
-
-    while (1) {
-        printf("\nPágina %d de %d\n", paginaAtual, totalPaginas);
-        printf("Itens restantes: %d\n", (totalPaginas-paginaAtual)*porPagina);
-        printTimeViewHeader();
-
-        int start = (paginaAtual - 1) * porPagina;
-        int end   = start + porPagina - 1;
-        end = end > llGetSize(gCalcContext) ? llGetSize(gCalcContext) : end;
-
-        // Criar view da página
-        LinkedList* pagina = llDeepCopy(gCalcContext, start, end);
-
-        // Mostrar partidas
-        llForeach(pagina, printCalcWrapper);
-
-        llFullFree(pagina, NULL);
-
-        // Perguntar próxima página
-        char buffer[16];
-        readString("\nDigite número da página ou 'Q' para sair: ",
-                   buffer, sizeof(buffer));
-
-        // Cancelar
-        if (toupper(buffer[0]) == 'Q')
-            break;
-
-        // Validar número
-        char* endptr;
-        long p = strtol(buffer, &endptr, 10);
-
-        if (endptr == buffer || p < 1 || p > totalPaginas) {
-            printf("Página inválida.\n");
-            continue;
-        }
-
-        paginaAtual = (int)p;
-    }
-
-    llFullFree(gCalcContext, free);
-    gCalcContext = NULL;
-}
-
+#ifndef IMPRIMIR_TABELA_CLASSIFICACAO_C
+#define IMPRIMIR_TABELA_CLASSIFICACAO_C 0
+
+#include <stdio.h>
+#include <ctype.h>
+#include <limits.h>
+#include "./0_utils.c"
+#include "../../inc/collections/LinkedList.h"
+#include "../../inc/service/model.h"
+#include "../../inc/service/repo.h"
+#include "./1_time.c"
+#include "./2_partida.c"
+
+
+// Monta a tabela (um contexto por time) da versão `versao` das estatísticas, já fixada por quem chama
+// (`NULL` = fixa a versão atual só durante a montagem). O número da versão usada vai para `numero`.
+// Retorna uma nova lista (liberar com `llFullFree(tabela, free)`), ou `NULL` em caso de erro.
+static LinkedList* carregarTabela(PartidaDBVersao* versao, unsigned long long* numero) {
+    PartidaDBVersao* v = versao != NULL ? versao : partidaDBVersaoFixar();
+    const TimeEstatisticas* estatisticas;
+    LinkedList* tabela = NULL;
+    CalcContext* ctx;
+    Time* t;
+    int count;
+    int id;
+
+    // Estatísticas de todos os times, mantidas pelo banco de partidas
+    estatisticas = partidaDBVersaoEstatisticas(v, &count);
+    if (estatisticas != NULL)
+        tabela = newLinkedList();
+
+    // Os times vêm da mesma versão: a cópia é consistente e não precisa de trava
+    for (id = 0; tabela != NULL && id < count; id++) {
+        t = partidaDBVersaoTime(v, id);
+        if (t == NULL)
+            continue;
+
+        ctx = (CalcContext*)malloc(sizeof(CalcContext));
+        if (ctx == NULL || !llAdd(tabela, ctx)) {
+            free(ctx);
+            llFullFree(tabela, free);
+            tabela = NULL;
+            break;
+        }
+
+        calcularEstatisticasDe(estatisticas, count, t, ctx);
+    }
+
+    if (tabela != NULL && numero != NULL)
+        *numero = partidaDBVersaoNumero(v);
+
+    if (versao == NULL)
+        partidaDBVersaoSoltar(v);
+
+    return tabela;
+}
+
+
+// ===============================================
+// Critérios de classificação (cadeia de desempate)
+// ===============================================
+typedef enum {
+    CRITERIO_PONTOS,     // Mais pontos
+    CRITERIO_VITORIAS,   // Mais vitórias
+    CRITERIO_SALDO,      // Maior saldo de gols
+    CRITERIO_GOLS_PRO,   // Mais gols marcados
+    CRITERIO_MENOR_ID    // Menor ID
+} CriterioClassificacao;
+
+// Cadeia de desempate: aplicada em ordem, o critério seguinte só decide se o anterior empatar.
+// Para mudar a classificação basta alterar este vetor.
+static const CriterioClassificacao gCriterios[] = {
+    CRITERIO_PONTOS, CRITERIO_VITORIAS, CRITERIO_SALDO, CRITERIO_GOLS_PRO, CRITERIO_MENOR_ID
+};
+#define N_CRITERIOS ((int)(sizeof(gCriterios) / sizeof(gCriterios[0])))
+
+// Chave compactada de uma tabela: faixa de valores de cada critério e posição dele na chave.
+// Montada por `compilarChaves` para cada ordenação e passada à comparação pelo contexto.
+typedef struct {
+    long long min[N_CRITERIOS];
+    long long max[N_CRITERIOS];
+    int shift[N_CRITERIOS];
+    int bits[N_CRITERIOS];  // Largura na chave (0 = o mesmo valor para todos os times)
+    bool compactada;        // `true` se todos os critérios couberam em 64 bits
+} ChaveClassificacao;
+
+// Valor de um critério para um time; valores maiores são sempre melhores
+static long long valorCriterio(CalcContext* c, CriterioClassificacao criterio)
+{
+    switch (criterio) {
+        case CRITERIO_PONTOS:   return (long long)c->vitorias * 3 + c->empates;
+        case CRITERIO_VITORIAS: return c->vitorias;
+        case CRITERIO_SALDO:    return (long long)c->gm - c->gs;
+        case CRITERIO_GOLS_PRO: return c->gm;
+        case CRITERIO_MENOR_ID: return -(long long)c->id;
+    }
+    return 0;
+}
+
+static void medirFaixaCriterios(void* calc, void* chave)
+{
+    ChaveClassificacao* k = (ChaveClassificacao*)chave;
+    int i;
+    long long v;
+
+    for (i = 0; i < N_CRITERIOS; i++) {
+        v = valorCriterio((CalcContext*)calc, gCriterios[i]);
+        if (v < k->min[i]) k->min[i] = v;
+        if (v > k->max[i]) k->max[i] = v;
+    }
+}
+
+static void calcularChave(void* calc, void* chave)
+{
+    CalcContext* c = (CalcContext*)calc;
+    ChaveClassificacao* k = (ChaveClassificacao*)chave;
+    int i;
+
+    c->chave = 0;
+    for (i = 0; i < N_CRITERIOS; i++) {
+        // Sem largura, o critério não ocupa a chave (e o deslocamento poderia chegar a 64 bits)
+        if (k->bits[i] == 0)
+            continue;
+        c->chave |= (unsigned long long)(valorCriterio(c, gCriterios[i]) - k->min[i]) << k->shift[i];
+    }
+}
+
+// ===============================================
+// Compila a cadeia de desempate em uma chave única:
+// cada critério ocupa apenas os bits necessários para a
+// faixa de valores da tabela, e o primeiro critério fica
+// nos bits mais significativos. Assim a ordenação compara
+// um único inteiro por par de times.
+// ===============================================
+static void compilarChaves(LinkedList* tabela, ChaveClassificacao* chave)
+{
+    int i;
+    int bits;
+    int totalBits = 0;
+    unsigned long long faixa;
+
+    for (i = 0; i < N_CRITERIOS; i++) {
+        chave->min[i] = LLONG_MAX;
+        chave->max[i] = LLONG_MIN;
+    }
+    llForeachCtx(tabela, medirFaixaCriterios, chave);
+
+    for (i = N_CRITERIOS - 1; i >= 0; i--) {
+        faixa = chave->max[i] >= chave->min[i] ? (unsigned long long)(chave->max[i] - chave->min[i]) : 0;
+        for (bits = 0; faixa > 0; bits++)
+            faixa >>= 1;
+
+        chave->shift[i] = totalBits;
+        chave->bits[i] = bits;
+        totalBits += bits;
+    }
+
+    chave->compactada = totalBits <= 64;
+    if (chave->compactada)
+        llForeachCtx(tabela, calcularChave, chave);
+}
+
+// ===============================================
+// Função de comparação para a ordenação (melhor primeiro),
+// com a `ChaveClassificacao` da tabela como contexto
+// ===============================================
+static Order orderResult(void* a, void* b, void* chave)
+{
+    CalcContext* r1 = (CalcContext*)a;
+    CalcContext* r2 = (CalcContext*)b;
+    long long v1, v2;
+    int i;
+
+    if (((ChaveClassificacao*)chave)->compactada) {
+        if (r1->chave > r2->chave) return less_than;
+        if (r1->chave < r2->chave) return greater_than;
+        return equal;
+    }
+
+    // Chave não coube em 64 bits: aplica a cadeia critério a critério
+    for (i = 0; i < N_CRITERIOS; i++) {
+        v1 = valorCriterio(r1, gCriterios[i]);
+        v2 = valorCriterio(r2, gCriterios[i]);
+        if (v1 > v2) return less_than;
+        if (v1 < v2) return greater_than;
+    }
+
+    return equal;
+}
+
+// Ordena a tabela (merge sort estável, O(n log n)) pela cadeia de desempate. A chave fica na
+// pilha de quem ordena: várias tabelas podem ser ordenadas ao mesmo tempo.
+static void ordenarTabela(LinkedList* tabela)
+{
+    ChaveClassificacao chave;
+
+    compilarChaves(tabela, &chave);
+    llSortCtx(tabela, orderResult, &chave);
+}
+
+// ===============================================
+// VIEW PAGINADA
+// ===============================================
+
+// Até `porPagina` times a partir da posição do cursor
+static bool renderPaginaTabela(LLCursor cursor, FormatoSaida formato, int porPagina) {
+    Renderer r;
+    int i;
+
+    if (!renderBegin(&r, stdout, formato, gColunasTime, sizeof(gColunasTime) / sizeof(gColunasTime[0]))) {
+        renderEnd(&r);
+        return false;
+    }
+
+    for (i = 0; i < porPagina && llCursorValid(&cursor); i++) {
+        renderCalc(&r, (CalcContext*)llCursorGet(&cursor));
+        llCursorNext(&cursor);
+    }
+
+    return renderEnd(&r);
+}
+
+void viewTabelaClassificacao()
+{
+    printf("=== Partidas (Listagem Paginada) ===\n");
+
+    LinkedList* tabela = carregarTabela(NULL, NULL);
+    if(tabela == NULL) {
+        printf("Erro: algum erro ocorreu.");
+        return;
+    }
+    
+
+    // Ordenar pela cadeia de desempate
+    ordenarTabela(tabela);
+
+    // CSV/JSON são para outras ferramentas: a tabela inteira, sem paginação
+    if (gFormatoSaida != FORMATO_TEXTO) {
+        if (!renderPaginaTabela(llCursor(tabela), gFormatoSaida, INT_MAX))
+            printf("Erro: listagem incompleta.\n");
+
+        llFullFree(tabela, free);
+        return;
+    }
+
+    const int porPagina = 5;
+    int totalItens = llGetSize(tabela);
+    int totalPaginas = (totalItens + porPagina - 1) / porPagina;
+    int paginaAtual = 1;
+
+    // Cursor sobre a tabela: cada página parte da posição da anterior, sem copiar nós
+    LLCursor cursor = llCursor(tabela);
+
+    while (1) {
+        printf("\nPágina %d de %d\n", paginaAtual, totalPaginas);
+        printf("Itens restantes: %d\n", (totalPaginas-paginaAtual)*porPagina);
+
+        int start = (paginaAtual - 1) * porPagina;
+
+        // Mostrar os times da página (só o cabeçalho, se a página não existe)
+        renderPaginaTabela(cursor, FORMATO_TEXTO, llCursorSeek(&cursor, start) ? porPagina : 0);
+
+        // Perguntar próxima página
+        char buffer[16];
+        readString("\nDigite número da página ou 'Q' para sair: ",
+                   buffer, sizeof(buffer));
+
+        // Cancelar
+        if (toupper(buffer[0]) == 'Q')
+            break;
+
+        // Validar número
+        char* endptr;
+        long p = strtol(buffer, &endptr, 10);
+
+        if (endptr == buffer || p < 1 || p > totalPaginas) {
+            printf("Página inválida.\n");
+            continue;
+        }
+
+        paginaAtual = (int)p;
+    }
+
+    llFullFree(tabela, free);
+}
+
 #endif
\ No newline at end of file
@@ -0,0 +1,22 @@
+#ifndef CHECKPOINT_VIEW
+#define CHECKPOINT_VIEW 0
+
+#include <stdio.h>
+
+#include "../../inc/service/repo.h"
+
+// =====================================================
+// VIEW: Checkpoint (salvar os CSVs e esvaziar o log)
+// =====================================================
+void viewCheckpoint()
+{
+    printf("=== Salvar (Checkpoint) ===\n");
+
+    if (partidaDBCheckpoint()) {
+        printf("Times e partidas salvos. Log de alteracoes esvaziado.\n");
+    } else {
+        printf("Erro: Nao foi possivel salvar. As alteracoes continuam no log.\n");
+    }
+}
+
+#endif
@@ -0,0 +1,509 @@
+#ifndef COMANDOS_VIEW_C
+#define COMANDOS_VIEW_C 0
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <limits.h>
+#include "../../inc/collections/LinkedList.h"
+#include "../../inc/service/model.h"
+#include "../../inc/service/repo.h"
+#include "../../inc/service/wal.h"
+#include "./1_time.c"
+#include "./6_imprimirTabelaClassificacao.c"
+
+// Tamanho máximo de uma linha de comando (linhas maiores são rejeitadas)
+#define COMANDO_MAX_LINHA 256
+
+// Buffer de saída: as respostas são gravadas em blocos, não linha a linha
+#define COMANDO_BUFFER_SAIDA (64 * 1024)
+
+// Commit em grupo do log durante os comandos: `fsync` a cada N registros ou a cada N segundos
+#define COMANDO_SYNC_REGISTROS 4096
+#define COMANDO_SYNC_SEGUNDOS 1
+
+// Versões das estatísticas retidas para o `table` paginado: as últimas usadas pelo comando
+#define COMANDO_VERSOES_RETIDAS 8
+
+// Versões retidas (cada uma fixada uma vez) e a posição da próxima a ser substituída, a mais antiga
+static PartidaDBVersao* gComandoVersoes[COMANDO_VERSOES_RETIDAS];
+static int gComandoVersaoProxima = 0;
+
+// --------------------------------------------------
+// Leitura dos argumentos de uma linha de comando
+// --------------------------------------------------
+
+// Próxima palavra da linha (separada por espaços), ou NULL se acabou
+static char* comandoPalavra(char** cursor)
+{
+    char* inicio = *cursor;
+
+    while (*inicio == ' ' || *inicio == '\t')
+        inicio++;
+
+    if (*inicio == '\0') {
+        *cursor = inicio;
+        return NULL;
+    }
+
+    char* fim = inicio;
+    while (*fim != '\0' && *fim != ' ' && *fim != '\t')
+        fim++;
+
+    if (*fim != '\0')
+        *fim++ = '\0';
+
+    *cursor = fim;
+    return inicio;
+}
+
+// Resto da linha, sem os espaços das pontas (nomes de time podem ter espaços)
+static char* comandoResto(char** cursor)
+{
+    char* inicio = *cursor;
+    char* fim;
+
+    while (*inicio == ' ' || *inicio == '\t')
+        inicio++;
+
+    fim = inicio + strlen(inicio);
+    while (fim > inicio && (fim[-1] == ' ' || fim[-1] == '\t'))
+        fim--;
+    *fim = '\0';
+
+    *cursor = fim;
+    return inicio;
+}
+
+// Converte uma palavra em inteiro; `false` se não for um número inteiro
+static bool comandoInteiro(const char* palavra, int* valor)
+{
+    char* fim;
+    long v;
+
+    if (palavra == NULL)
+        return false;
+
+    v = strtol(palavra, &fim, 10);
+    if (fim == palavra || *fim != '\0' || v < INT_MIN || v > INT_MAX)
+        return false;
+
+    *valor = (int)v;
+    return true;
+}
+
+// Número de versão (inteiro sem sinal de 64 bits)
+static bool comandoNumeroVersao(const char* palavra, unsigned long long* valor)
+{
+    char* fim;
+
+    if (palavra == NULL || palavra[0] < '0' || palavra[0] > '9')
+        return false;
+
+    *valor = strtoull(palavra, &fim, 10);
+    return *fim == '\0';
+}
+
+// Gols de `update`: um número, ou `-` para manter o valor atual
+static bool comandoGols(const char* palavra, int atual, int* gols)
+{
+    if (palavra != NULL && strcmp(palavra, "-") == 0) {
+        *gols = atual;
+        return true;
+    }
+
+    return comandoInteiro(palavra, gols) && *gols >= 0;
+}
+
+// --------------------------------------------------
+// Comandos (cada um grava exatamente uma linha de
+// resposta, exceto `table`, ver comandoTable).
+// As leituras seguram a trava de leitura dos bancos
+// enquanto usam o resultado; as alterações pegam a
+// trava sozinhas (ver repo.h)
+// --------------------------------------------------
+
+// insert <time1> <time2> <gols1> <gols2>  ->  OK <id>
+static bool comandoInsert(char* args, FILE* saida)
+{
+    int t1, t2, g1, g2, id;
+    AddPartidaReponse resp;
+    PartidaTransacao tx = {NULL};  // Cada comando é a sua própria transação
+
+    if (!comandoInteiro(comandoPalavra(&args), &t1) || !comandoInteiro(comandoPalavra(&args), &t2) ||
+        !comandoInteiro(comandoPalavra(&args), &g1) || !comandoInteiro(comandoPalavra(&args), &g2) ||
+        comandoPalavra(&args) != NULL) {
+        fputs("ERR uso: insert <time1> <time2> <gols1> <gols2>\n", saida);
+        return false;
+    }
+
+    if (g1 < 0 || g2 < 0) {
+        fputs("ERR gols negativos\n", saida);
+        return false;
+    }
+
+    resp = partidaDBTransacaoAdicionar(&tx, t1, t2, g1, g2);
+    if (resp != SUCCESS) {
+        partidaDBTransacaoRollBack(&tx);
+        switch (resp) {
+            case TIME_1_EQUALS_TIME_2:   fputs("ERR times iguais\n", saida); break;
+            case TIME_1_DOES_NOT_EXISTS: fprintf(saida, "ERR time %d nao existe\n", t1); break;
+            case TIME_2_DOES_NOT_EXISTS: fprintf(saida, "ERR time %d nao existe\n", t2); break;
+            case MEMORY_NOT_ENOUGH_EXCEPTION: fputs("ERR memoria insuficiente\n", saida); break;
+            default: fputs("ERR transacao\n", saida); break;
+        }
+        return false;
+    }
+
+    if (!partidaDBTransacaoCommit(&tx, &id)) {
+        partidaDBTransacaoRollBack(&tx);
+        fputs("ERR commit\n", saida);
+        return false;
+    }
+
+    fprintf(saida, "OK %d\n", id);
+    return true;
+}
+
+// update <id> <gols1|-> <gols2|->  ->  OK <id>
+static bool comandoUpdate(char* args, FILE* saida)
+{
+    int id, g1, g2;
+    char* p1;
+    char* p2;
+    Partida* p;
+
+    if (!comandoInteiro(comandoPalavra(&args), &id)) {
+        fputs("ERR uso: update <id> <gols1|-> <gols2|->\n", saida);
+        return false;
+    }
+
+    p1 = comandoPalavra(&args);
+    p2 = comandoPalavra(&args);
+
+    // Os gols mantidos (`-`) são lidos antes da atualização, que pega a trava de escrita sozinha
+    repoReadLock();
+    p = partidaDBGetById(id);
+    if (p != NULL) {
+        g1 = partidaGetGolsT1(p);
+        g2 = partidaGetGolsT2(p);
+    }
+    repoReadUnlock();
+
+    if (p == NULL) {
+        fprintf(saida, "ERR partida %d nao existe\n", id);
+        return false;
+    }
+
+    if (!comandoGols(p1, g1, &g1) || !comandoGols(p2, g2, &g2) || comandoPalavra(&args) != NULL) {
+        fputs("ERR uso: update <id> <gols1|-> <gols2|->\n", saida);
+        return false;
+    }
+
+    if (!partidaDBAtualizarGols(id, g1, g2)) {
+        fputs("ERR atualizacao recusada\n", saida);
+        return false;
+    }
+
+    fprintf(saida, "OK %d\n", id);
+    return true;
+}
+
+// delete <id>  ->  OK <id>
+static bool comandoDelete(char* args, FILE* saida)
+{
+    int id;
+
+    if (!comandoInteiro(comandoPalavra(&args), &id) || comandoPalavra(&args) != NULL) {
+        fputs("ERR uso: delete <id>\n", saida);
+        return false;
+    }
+
+    if (!partidaDBRemove(id)) {
+        fprintf(saida, "ERR partida %d nao existe\n", id);
+        return false;
+    }
+
+    fprintf(saida, "OK %d\n", id);
+    return true;
+}
+
+// get <id>  ->  OK <id>;<time1>;<time2>;<gols1>;<gols2>
+static bool comandoGet(char* args, FILE* saida)
+{
+    int id;
+    Partida* p;
+
+    if (!comandoInteiro(comandoPalavra(&args), &id) || comandoPalavra(&args) != NULL) {
+        fputs("ERR uso: get <id>\n", saida);
+        return false;
+    }
+
+    repoReadLock();
+
+    p = partidaDBGetById(id);
+    if (p == NULL)
+        fprintf(saida, "ERR partida %d nao existe\n", id);
+    else
+        fprintf(saida, "OK %d;%d;%d;%d;%d\n", id, timeGetId(partidaGetT1(p)), timeGetId(partidaGetT2(p)),
+                partidaGetGolsT1(p), partidaGetGolsT2(p));
+
+    repoReadUnlock();
+    return p != NULL;
+}
+
+static void comandoImprimirPartidaId(void* partida, void* saida)
+{
+    fprintf((FILE*)saida, " %d", partidaGetId((Partida*)partida));
+}
+
+static void comandoImprimirTimeId(void* time, void* saida)
+{
+    fprintf((FILE*)saida, " %d", timeGetId((Time*)time));
+}
+
+// search <mandante|visitante|ambos|time> <prefixo>  ->  OK <n> <id> <id> ...
+// (sem diferenciar maiúsculas/minúsculas nem acentos, como as views)
+static bool comandoSearch(char* args, FILE* saida)
+{
+    char* modo = comandoPalavra(&args);
+    char* prefixo = comandoResto(&args);
+    char nome[TIME_MAX_NAME_SIZE];
+    LinkedList* lista;
+    bool times = false;
+
+    if (modo == NULL || strlen(prefixo) >= TIME_MAX_NAME_SIZE) {
+        fputs("ERR uso: search <mandante|visitante|ambos|time> <prefixo>\n", saida);
+        return false;
+    }
+
+    strcpy(nome, prefixo);
+
+    repoReadLock();
+
+    if (strcmp(modo, "mandante") == 0)
+        lista = partidaDBSearchMandante(nome, BUSCA_NORMALIZADA);
+    else if (strcmp(modo, "visitante") == 0)
+        lista = partidaDBSearchVisitante(nome, BUSCA_NORMALIZADA);
+    else if (strcmp(modo, "ambos") == 0)
+        lista = partidaDBSearchMandanteOrVisitante(nome, BUSCA_NORMALIZADA);
+    else if (strcmp(modo, "time") == 0) {
+        lista = searchByPrefix(nome, BUSCA_NORMALIZADA);
+        times = true;
+    } else {
+        repoReadUnlock();
+        fputs("ERR uso: search <mandante|visitante|ambos|time> <prefixo>\n", saida);
+        return false;
+    }
+
+    if (lista == NULL) {
+        repoReadUnlock();
+        fputs("ERR busca\n", saida);
+        return false;
+    }
+
+    fprintf(saida, "OK %d", llGetSize(lista));
+    llForeachCtx(lista, times ? comandoImprimirTimeId : comandoImprimirPartidaId, saida);
+    fputc('\n', saida);
+
+    repoReadUnlock();
+
+    llFullFree(lista, NULL);
+    return true;
+}
+
+// --------------------------------------------------
+// Versões retidas para o `table` paginado
+// --------------------------------------------------
+
+// Fixa a versão atual e a retém (se ainda não estava retida), substituindo a mais antiga
+static PartidaDBVersao* comandoVersaoAtual()
+{
+    PartidaDBVersao* v = partidaDBVersaoFixar();
+    int i;
+
+    if (v == NULL)
+        return NULL;
+
+    // Uma versão retida nunca é alterada no lugar: o mesmo ponteiro é a mesma versão
+    for (i = 0; i < COMANDO_VERSOES_RETIDAS; i++) {
+        if (gComandoVersoes[i] == v) {
+            partidaDBVersaoSoltar(v);
+            return v;
+        }
+    }
+
+    partidaDBVersaoSoltar(gComandoVersoes[gComandoVersaoProxima]);
+    gComandoVersoes[gComandoVersaoProxima] = v;
+    gComandoVersaoProxima = (gComandoVersaoProxima + 1) % COMANDO_VERSOES_RETIDAS;
+
+    return v;
+}
+
+// Versão retida com o número pedido, ou NULL se ela já foi substituída (ou nunca foi usada)
+static PartidaDBVersao* comandoVersaoRetida(unsigned long long numero)
+{
+    int i;
+
+    for (i = 0; i < COMANDO_VERSOES_RETIDAS; i++)
+        if (gComandoVersoes[i] != NULL && partidaDBVersaoNumero(gComandoVersoes[i]) == numero)
+            return gComandoVersoes[i];
+
+    return NULL;
+}
+
+// Solta as versões retidas (antes de encerrar os bancos)
+static void comandoSoltarVersoes()
+{
+    int i;
+
+    for (i = 0; i < COMANDO_VERSOES_RETIDAS; i++) {
+        partidaDBVersaoSoltar(gComandoVersoes[i]);
+        gComandoVersoes[i] = NULL;
+    }
+
+    gComandoVersaoProxima = 0;
+}
+
+// table [n] [inicio] [versao]  ->  OK <k> <versao>, seguida de uma linha para cada um dos k times a
+// partir da posição `inicio` (padrão 1): posicao;id;nome;pontos;vitorias;empates;derrotas;gm;gs;saldo.
+// Sem `versao`, usa a classificação atual; com ela, a mesma classificação de uma resposta anterior
+// (páginas consistentes), enquanto ela estiver entre as `COMANDO_VERSOES_RETIDAS` últimas usadas
+static bool comandoTable(char* args, FILE* saida)
+{
+    char* palavraLimite = comandoPalavra(&args);
+    char* palavraInicio = comandoPalavra(&args);
+    char* palavraVersao = comandoPalavra(&args);
+    unsigned long long numero = 0;
+    int limite = INT_MAX;
+    int inicio = 1;
+    int total;
+    int n;
+    int i;
+    PartidaDBVersao* versao;
+    LinkedList* tabela;
+    LLCursor cursor;
+    CalcContext* c;
+
+    if ((palavraLimite != NULL && (!comandoInteiro(palavraLimite, &limite) || limite < 0)) ||
+        (palavraInicio != NULL && (!comandoInteiro(palavraInicio, &inicio) || inicio < 1)) ||
+        (palavraVersao != NULL && !comandoNumeroVersao(palavraVersao, &numero)) ||
+        comandoPalavra(&args) != NULL) {
+        fputs("ERR uso: table [n] [inicio] [versao]\n", saida);
+        return false;
+    }
+
+    versao = palavraVersao != NULL ? comandoVersaoRetida(numero) : comandoVersaoAtual();
+    if (versao == NULL && palavraVersao != NULL) {
+        fputs("ERR versao expirada\n", saida);
+        return false;
+    }
+
+    // A tabela é montada de uma versão fixada das estatísticas, sem segurar a trava
+    tabela = versao != NULL ? carregarTabela(versao, &numero) : NULL;
+    if (tabela == NULL) {
+        fputs("ERR tabela\n", saida);
+        return false;
+    }
+
+    ordenarTabela(tabela);
+
+    total = llGetSize(tabela);
+    n = inicio > total ? 0 : (limite < total - inicio + 1 ? limite : total - inicio + 1);
+
+    fprintf(saida, "OK %d %llu\n", n, numero);
+
+    cursor = llCursor(tabela);
+    if (n > 0 && llCursorSeek(&cursor, inicio - 1)) {
+        for (i = 0; i < n; i++, llCursorNext(&cursor)) {
+            c = (CalcContext*)llCursorGet(&cursor);
+            fprintf(saida, "%d;%d;%s;%d;%d;%d;%d;%d;%d;%d\n", inicio + i, c->id, c->nome,
+                    c->vitorias * 3 + c->empates, c->vitorias, c->empates, c->derrotas, c->gm, c->gs, c->gm - c->gs);
+        }
+    }
+
+    llFullFree(tabela, free);
+    return true;
+}
+
+// checkpoint  ->  OK
+static bool comandoCheckpoint(char* args, FILE* saida)
+{
+    if (comandoPalavra(&args) != NULL) {
+        fputs("ERR uso: checkpoint\n", saida);
+        return false;
+    }
+
+    if (!partidaDBCheckpoint()) {
+        fputs("ERR checkpoint\n", saida);
+        return false;
+    }
+
+    fputs("OK\n", saida);
+    return true;
+}
+
+// Executa uma linha (já sem o '\n'); linhas vazias e comentários (#) não têm resposta
+static bool comandoExecutar(char* linha, FILE* saida)
+{
+    char* cursor = linha;
+    char* nome = comandoPalavra(&cursor);
+
+    if (nome == NULL || nome[0] == '#')
+        return true;
+
+    if (strcmp(nome, "insert") == 0)     return comandoInsert(cursor, saida);
+    if (strcmp(nome, "update") == 0)     return comandoUpdate(cursor, saida);
+    if (strcmp(nome, "delete") == 0)     return comandoDelete(cursor, saida);
+    if (strcmp(nome, "get") == 0)        return comandoGet(cursor, saida);
+    if (strcmp(nome, "search") == 0)     return comandoSearch(cursor, saida);
+    if (strcmp(nome, "table") == 0)      return comandoTable(cursor, saida);
+    if (strcmp(nome, "checkpoint") == 0) return comandoCheckpoint(cursor, saida);
+
+    fprintf(saida, "ERR comando desconhecido: %s\n", nome);
+    return false;
+}
+
+// ----------------------------------------------
+// MODO DE COMANDOS (sem menus nem confirmações)
+// ----------------------------------------------
+int viewExecutarComandos(FILE* entrada, FILE* saida)
+{
+    static char bufferSaida[COMANDO_BUFFER_SAIDA];
+    char linha[COMANDO_MAX_LINHA];
+    size_t len;
+    int erros = 0;
+    int c;
+
+    setvbuf(saida, bufferSaida, _IOFBF, sizeof(bufferSaida));
+
+    // Um `fsync` por comando limitaria o lote a algumas centenas de alterações por segundo
+    partidaWALSetSync(COMANDO_SYNC_REGISTROS, COMANDO_SYNC_SEGUNDOS);
+
+    while (fgets(linha, sizeof(linha), entrada) != NULL) {
+        len = strlen(linha);
+
+        if (len > 0 && linha[len - 1] == '\n') {
+            linha[--len] = '\0';
+        } else if (!feof(entrada)) {
+            // Linha longa demais: descarta o resto e responde com erro
+            while ((c = fgetc(entrada)) != EOF && c != '\n');
+            fputs("ERR linha muito longa\n", saida);
+            erros++;
+            continue;
+        }
+
+        if (len > 0 && linha[len - 1] == '\r')
+            linha[--len] = '\0';
+
+        if (!comandoExecutar(linha, saida))
+            erros++;
+    }
+
+    comandoSoltarVersoes();
+
+    fflush(saida);
+    return erros;
+}
+
+#endif
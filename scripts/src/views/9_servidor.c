@@ -0,0 +1,498 @@
+#ifndef SERVIDOR_VIEW_C
+#define SERVIDOR_VIEW_C 0
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include "../../inc/service/repo.h"
+#include "../../inc/service/wal.h"
+#include "./8_comandos.c"
+
+#ifdef __linux__
+
+#include <errno.h>
+#include <fcntl.h>
+#include <signal.h>
+#include <unistd.h>
+#include <sys/epoll.h>
+#include <sys/resource.h>
+#include <sys/socket.h>
+#include <sys/stat.h>
+#include <sys/un.h>
+
+// Eventos tratados por chamada ao `epoll_wait`
+#define SERVIDOR_MAX_EVENTOS 256
+
+// Buffer de entrada de cada conexão (vários comandos enviados de uma vez cabem juntos)
+#define SERVIDOR_BUFFER_ENTRADA (COMANDO_MAX_LINHA * 16)
+
+// Respostas pendentes a partir das quais a conexão para de ser lida até o cliente consumi-las
+#define SERVIDOR_MAX_SAIDA_PENDENTE (256 * 1024)
+
+// Sem eventos por esse tempo, os registros do log em espera são gravados com `fsync`
+#define SERVIDOR_SYNC_MS 1000
+
+// Conexão de um cliente
+typedef struct {
+    char entrada[SERVIDOR_BUFFER_ENTRADA];  // Bytes recebidos e ainda não executados
+    size_t nEntrada;                        // Quantidade de bytes em `entrada`
+    bool descartando;                       // Descartando o resto de uma linha longa demais
+    bool fim;                               // O cliente fechou o envio: encerrar após as respostas
+    char* saida;                            // Respostas ainda não enviadas
+    size_t nSaida;                          // Quantidade de bytes em `saida`
+    size_t enviado;                         // Bytes de `saida` já enviados
+    size_t capSaida;                        // Tamanho alocado de `saida`
+    unsigned int eventos;                   // Eventos registrados no epoll
+} ServidorConexao;
+
+// Estado do servidor (um único laço de eventos)
+static struct {
+    int epoll;                       // Descritor do epoll
+    int escuta;                      // Socket que aceita as conexões
+    int reserva;                     // Descritor reservado, liberado para recusar conexões sem descritores livres
+    ServidorConexao** conexoes;      // Conexões indexadas pelo descritor
+    int maxDescritores;              // Tamanho de `conexoes`
+    FILE* resposta;                  // Fluxo em memória onde os comandos escrevem as respostas
+    char* respostaBuffer;            // Buffer do fluxo de respostas
+    size_t respostaTamanho;          // Tamanho do fluxo de respostas
+    int ativas;                      // Conexões abertas
+    long comandos;                   // Comandos executados
+} gServidor;
+
+static volatile sig_atomic_t gServidorParar = 0;
+
+static void servidorSinal(int sinal)
+{
+    (void)sinal;
+    gServidorParar = 1;
+}
+
+// --------------------------------------------------
+// Conexões
+// --------------------------------------------------
+
+static void servidorFechar(int fd)
+{
+    ServidorConexao* c = gServidor.conexoes[fd];
+
+    epoll_ctl(gServidor.epoll, EPOLL_CTL_DEL, fd, NULL);
+    close(fd);
+
+    if (c != NULL) {
+        free(c->saida);
+        free(c);
+        gServidor.conexoes[fd] = NULL;
+        gServidor.ativas--;
+    }
+}
+
+// Aceita todas as conexões pendentes
+static void servidorAceitar()
+{
+    struct epoll_event ev;
+    ServidorConexao* c;
+    int fd;
+
+    while (1) {
+        fd = accept(gServidor.escuta, NULL, NULL);
+
+        if (fd < 0) {
+            if (errno == EINTR)
+                continue;
+
+            // Sem descritores livres: aceita com o reservado e fecha, senão a conexão fica na fila
+            // e o epoll acorda o laço de novo sem parar
+            if ((errno == EMFILE || errno == ENFILE) && gServidor.reserva >= 0) {
+                close(gServidor.reserva);
+                fd = accept(gServidor.escuta, NULL, NULL);
+                if (fd >= 0)
+                    close(fd);
+                gServidor.reserva = open("/dev/null", O_RDONLY | O_CLOEXEC);
+                continue;
+            }
+
+            if (errno != EAGAIN && errno != EWOULDBLOCK)
+                perror("accept");
+            return;
+        }
+
+        c = fd < gServidor.maxDescritores ? (ServidorConexao*)malloc(sizeof(ServidorConexao)) : NULL;
+        if (c == NULL || fcntl(fd, F_SETFL, O_NONBLOCK) != 0 || fcntl(fd, F_SETFD, FD_CLOEXEC) != 0) {
+            free(c);
+            close(fd);
+            continue;
+        }
+
+        c->nEntrada = 0;
+        c->descartando = false;
+        c->fim = false;
+        c->saida = NULL;
+        c->nSaida = 0;
+        c->enviado = 0;
+        c->capSaida = 0;
+        c->eventos = EPOLLIN;
+
+        ev.events = c->eventos;
+        ev.data.fd = fd;
+        if (epoll_ctl(gServidor.epoll, EPOLL_CTL_ADD, fd, &ev) != 0) {
+            perror("epoll_ctl");
+            free(c);
+            close(fd);
+            continue;
+        }
+
+        gServidor.conexoes[fd] = c;
+        gServidor.ativas++;
+    }
+}
+
+// Acrescenta as respostas escritas no fluxo em memória à saída da conexão. O fluxo sempre volta
+// ao início, mesmo em caso de erro, para que as respostas desta conexão não vão para a próxima.
+static bool servidorColetarRespostas(ServidorConexao* c)
+{
+    long n;
+    size_t cap;
+    char* resized;
+    bool ok = true;
+
+    fflush(gServidor.resposta);
+    n = ftell(gServidor.resposta);
+    if (n < 0)
+        ok = false;
+
+    // Já enviado: reaproveita o início do buffer
+    if (n > 0 && c->enviado == c->nSaida)
+        c->enviado = c->nSaida = 0;
+
+    if (n > 0 && c->nSaida + (size_t)n > c->capSaida) {
+        cap = c->capSaida > 0 ? c->capSaida : COMANDO_MAX_LINHA;
+        while (cap < c->nSaida + (size_t)n)
+            cap *= 2;
+
+        resized = (char*)realloc(c->saida, cap);
+        if (resized != NULL) {
+            c->saida = resized;
+            c->capSaida = cap;
+        } else {
+            ok = false;
+        }
+    }
+
+    if (n > 0 && ok) {
+        memcpy(c->saida + c->nSaida, gServidor.respostaBuffer, (size_t)n);
+        c->nSaida += (size_t)n;
+    }
+
+    rewind(gServidor.resposta);
+    return ok;
+}
+
+// Executa as linhas completas recebidas; o resto (uma linha incompleta) vai para o início do buffer
+static void servidorExecutar(ServidorConexao* c)
+{
+    char* linha = c->entrada;
+    char* fim = c->entrada + c->nEntrada;
+    char* quebra;
+    size_t len;
+
+    while ((quebra = (char*)memchr(linha, '\n', (size_t)(fim - linha))) != NULL) {
+        len = (size_t)(quebra - linha);
+        *quebra = '\0';
+
+        if (len > 0 && linha[len - 1] == '\r')
+            linha[--len] = '\0';
+
+        if (c->descartando)
+            c->descartando = false;
+        else if (len >= COMANDO_MAX_LINHA)
+            fputs("ERR linha muito longa\n", gServidor.resposta);
+        else {
+            comandoExecutar(linha, gServidor.resposta);
+            gServidor.comandos++;
+        }
+
+        linha = quebra + 1;
+    }
+
+    c->nEntrada = (size_t)(fim - linha);
+
+    // Uma linha incompleta que já passou do limite: responde agora e descarta o resto dela
+    if (c->nEntrada >= COMANDO_MAX_LINHA) {
+        if (!c->descartando)
+            fputs("ERR linha muito longa\n", gServidor.resposta);
+        c->descartando = true;
+        c->nEntrada = 0;
+    }
+
+    memmove(c->entrada, linha, c->nEntrada);
+}
+
+// Envia o que for possível sem bloquear
+static bool servidorEnviar(int fd, ServidorConexao* c)
+{
+    ssize_t n;
+
+    while (c->enviado < c->nSaida) {
+        n = send(fd, c->saida + c->enviado, c->nSaida - c->enviado, MSG_NOSIGNAL);
+
+        if (n < 0) {
+            if (errno == EINTR)
+                continue;
+            return errno == EAGAIN || errno == EWOULDBLOCK;
+        }
+
+        c->enviado += (size_t)n;
+    }
+
+    c->enviado = c->nSaida = 0;
+    return true;
+}
+
+// Trata os eventos de uma conexão
+static void servidorAtender(int fd, unsigned int eventos)
+{
+    ServidorConexao* c = gServidor.conexoes[fd];
+    struct epoll_event ev;
+    size_t pendente;
+    ssize_t n;
+
+    if (c == NULL)
+        return;
+
+    if (eventos & EPOLLERR) {
+        servidorFechar(fd);
+        return;
+    }
+
+    // Uma leitura por evento: com o epoll por nível, uma conexão com muitos comandos
+    // não impede que as outras sejam atendidas
+    if ((eventos & (EPOLLIN | EPOLLHUP)) && !c->fim) {
+        n = recv(fd, c->entrada + c->nEntrada, sizeof(c->entrada) - c->nEntrada, 0);
+
+        if (n == 0) {
+            // Como no modo de comandos, a última linha vale mesmo sem o '\n'
+            // (depois de `servidorExecutar` o resto é sempre menor que uma linha)
+            c->fim = true;
+            if (c->nEntrada > 0) {
+                c->entrada[c->nEntrada++] = '\n';
+                servidorExecutar(c);
+
+                if (!servidorColetarRespostas(c)) {
+                    servidorFechar(fd);
+                    return;
+                }
+            }
+        } else if (n < 0) {
+            if (errno != EAGAIN && errno != EWOULDBLOCK && errno != EINTR) {
+                servidorFechar(fd);
+                return;
+            }
+        } else {
+            c->nEntrada += (size_t)n;
+            servidorExecutar(c);
+
+            if (!servidorColetarRespostas(c)) {
+                servidorFechar(fd);
+                return;
+            }
+        }
+    }
+
+    if (!servidorEnviar(fd, c)) {
+        servidorFechar(fd);
+        return;
+    }
+
+    pendente = c->nSaida - c->enviado;
+    if (c->fim && pendente == 0) {
+        servidorFechar(fd);
+        return;
+    }
+
+    // Com respostas pendentes, espera poder enviar; com muitas, para de ler até o cliente consumi-las
+    ev.events = (pendente > 0 ? EPOLLOUT : 0) | (!c->fim && pendente < SERVIDOR_MAX_SAIDA_PENDENTE ? EPOLLIN : 0);
+    if (ev.events != c->eventos) {
+        ev.data.fd = fd;
+        if (epoll_ctl(gServidor.epoll, EPOLL_CTL_MOD, fd, &ev) != 0) {
+            servidorFechar(fd);
+            return;
+        }
+        c->eventos = ev.events;
+    }
+}
+
+// --------------------------------------------------
+// Início e fim
+// --------------------------------------------------
+
+static int servidorEscutar(const char* caminho)
+{
+    struct sockaddr_un endereco;
+    struct stat info;
+    int fd;
+
+    if (strlen(caminho) >= sizeof(endereco.sun_path)) {
+        fprintf(stderr, "Caminho do socket muito longo: %s\n", caminho);
+        return -1;
+    }
+
+    fd = socket(AF_UNIX, SOCK_STREAM | SOCK_NONBLOCK | SOCK_CLOEXEC, 0);
+    if (fd < 0) {
+        perror("socket");
+        return -1;
+    }
+
+    memset(&endereco, 0, sizeof(endereco));
+    endereco.sun_family = AF_UNIX;
+    strcpy(endereco.sun_path, caminho);
+
+    // Só um socket deixado por uma execução anterior é apagado; qualquer outro arquivo é mantido
+    if (lstat(caminho, &info) == 0) {
+        if (!S_ISSOCK(info.st_mode)) {
+            fprintf(stderr, "%s existe e nao e um socket\n", caminho);
+            close(fd);
+            return -1;
+        }
+        unlink(caminho);
+    }
+
+    if (bind(fd, (struct sockaddr*)&endereco, sizeof(endereco)) != 0 || listen(fd, SOMAXCONN) != 0) {
+        perror(caminho);
+        close(fd);
+        return -1;
+    }
+
+    return fd;
+}
+
+// Aumenta o limite de descritores abertos até o máximo permitido
+static int servidorLimiteDescritores()
+{
+    struct rlimit limite;
+
+    if (getrlimit(RLIMIT_NOFILE, &limite) != 0)
+        return 1024;
+
+    if (limite.rlim_cur < limite.rlim_max) {
+        limite.rlim_cur = limite.rlim_max;
+        setrlimit(RLIMIT_NOFILE, &limite);
+        getrlimit(RLIMIT_NOFILE, &limite);
+    }
+
+    return limite.rlim_cur == RLIM_INFINITY || limite.rlim_cur > 1024 * 1024 ? 1024 * 1024 : (int)limite.rlim_cur;
+}
+
+// ---------------------------------------------------
+// MODO SERVIDOR (comandos recebidos por socket Unix)
+// ---------------------------------------------------
+bool viewServidor(const char* caminho)
+{
+    struct epoll_event eventos[SERVIDOR_MAX_EVENTOS];
+    struct epoll_event ev;
+    struct sigaction sa;
+    long prazo;
+    int n;
+    int i;
+    bool ok = true;
+
+    memset(&gServidor, 0, sizeof(gServidor));
+    gServidor.epoll = gServidor.escuta = gServidor.reserva = -1;
+
+    gServidor.maxDescritores = servidorLimiteDescritores();
+    gServidor.conexoes = (ServidorConexao**)calloc(gServidor.maxDescritores, sizeof(ServidorConexao*));
+    gServidor.resposta = open_memstream(&gServidor.respostaBuffer, &gServidor.respostaTamanho);
+    gServidor.reserva = open("/dev/null", O_RDONLY | O_CLOEXEC);
+    gServidor.escuta = servidorEscutar(caminho);
+    gServidor.epoll = epoll_create1(EPOLL_CLOEXEC);
+
+    ev.events = EPOLLIN;
+    ev.data.fd = gServidor.escuta;
+
+    if (gServidor.conexoes == NULL || gServidor.resposta == NULL || gServidor.escuta < 0 || gServidor.epoll < 0 ||
+        epoll_ctl(gServidor.epoll, EPOLL_CTL_ADD, gServidor.escuta, &ev) != 0) {
+        fprintf(stderr, "Nao foi possivel iniciar o servidor em %s\n", caminho);
+        ok = false;
+    }
+
+    // Sem SA_RESTART: o sinal interrompe o `epoll_wait` e o laço termina
+    memset(&sa, 0, sizeof(sa));
+    sa.sa_handler = servidorSinal;
+    sigemptyset(&sa.sa_mask);
+    sigaction(SIGINT, &sa, NULL);
+    sigaction(SIGTERM, &sa, NULL);
+    signal(SIGPIPE, SIG_IGN);
+
+    // Como no modo de comandos: commit em grupo. O que sobrar é gravado quando o servidor fica ocioso
+    // ou quando vence o intervalo de `fsync`, mesmo que o tráfego continue (só de leituras)
+    partidaWALSetSync(COMANDO_SYNC_REGISTROS, COMANDO_SYNC_SEGUNDOS);
+
+    if (ok)
+        fprintf(stderr, "Servidor ouvindo em %s (ate %d descritores)\n", caminho, gServidor.maxDescritores);
+
+    while (ok && !gServidorParar) {
+        // A espera nunca passa do prazo do commit em grupo
+        repoReadLock();
+        prazo = partidaWALSyncPrazoMs();
+        repoReadUnlock();
+
+        n = epoll_wait(gServidor.epoll, eventos, SERVIDOR_MAX_EVENTOS,
+                       prazo >= 0 && prazo < SERVIDOR_SYNC_MS ? (int)prazo : SERVIDOR_SYNC_MS);
+
+        if (n < 0) {
+            if (errno == EINTR)
+                continue;
+            perror("epoll_wait");
+            ok = false;
+            break;
+        }
+
+        for (i = 0; i < n; i++) {
+            if (eventos[i].data.fd == gServidor.escuta)
+                servidorAceitar();
+            else
+                servidorAtender(eventos[i].data.fd, eventos[i].events);
+        }
+
+        // O log é das alterações: a gravação pendente é feita com a trava de escrita
+        repoWriteLock();
+        if (n == 0 || partidaWALSyncPrazoMs() == 0)
+            partidaWALFlush(true);
+        repoWriteUnlock();
+    }
+
+    for (i = 0; i < gServidor.maxDescritores && gServidor.conexoes != NULL; i++)
+        if (gServidor.conexoes[i] != NULL)
+            servidorFechar(i);
+
+    comandoSoltarVersoes();
+
+    if (gServidor.escuta >= 0) {
+        close(gServidor.escuta);
+        unlink(caminho);
+    }
+    if (gServidor.epoll >= 0)
+        close(gServidor.epoll);
+    if (gServidor.reserva >= 0)
+        close(gServidor.reserva);
+    if (gServidor.resposta != NULL)
+        fclose(gServidor.resposta);
+
+    free(gServidor.respostaBuffer);
+    free(gServidor.conexoes);
+
+    fprintf(stderr, "Servidor encerrado: %ld comandos executados\n", gServidor.comandos);
+    return ok;
+}
+
+#else
+
+bool viewServidor(const char* caminho)
+{
+    fprintf(stderr, "Modo servidor indisponivel nesta plataforma (%s)\n", caminho);
+    return false;
+}
+
+#endif
+
+#endif
@@ -0,0 +1,342 @@
+#ifndef RENDER_VIEW_C
+#define RENDER_VIEW_C 0
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include "../../inc/views/render.h"
+
+// Maior quantidade de dígitos (com o sinal) de um `long long`
+#define RENDER_MAX_DIGITOS 21
+
+// --------------------------------------------------
+// Buffer de saída
+// --------------------------------------------------
+
+// Garante espaço para mais `n` bytes no buffer, retornando onde escrevê-los (`NULL` se faltou memória)
+static char* renderEspaco(Renderer* r, size_t n)
+{
+    size_t capacity;
+    char* resized;
+
+    if (r->erro)
+        return NULL;
+
+    if (r->size + n <= r->capacity)
+        return r->buffer + r->size;
+
+    capacity = r->capacity > 0 ? r->capacity : RENDER_INITIAL_CAPACITY;
+    while (capacity < r->size + n)
+        capacity *= 2;
+
+    resized = (char*)realloc(r->buffer, capacity);
+    if (resized == NULL) {
+        r->erro = true;
+        return NULL;
+    }
+
+    r->buffer = resized;
+    r->capacity = capacity;
+    return r->buffer + r->size;
+}
+
+// Escreve `n` bytes fixos (estrutura do formato)
+static void renderBytes(Renderer* r, const char* bytes, size_t n)
+{
+    char* p = renderEspaco(r, n);
+
+    if (p == NULL)
+        return;
+
+    memcpy(p, bytes, n);
+    r->size += n;
+}
+
+// Grava o buffer no arquivo e o esvazia
+static void renderFlush(Renderer* r)
+{
+    if (!r->erro && r->size > 0 && fwrite(r->buffer, 1, r->size, r->saida) != r->size)
+        r->erro = true;
+
+    r->size = 0;
+}
+
+// --------------------------------------------------
+// Formatação dos valores (cada função escreve em `p`,
+// com o espaço já reservado, e retorna o novo fim)
+// --------------------------------------------------
+
+static char* renderCopiar(char* p, const char* texto, size_t n)
+{
+    memcpy(p, texto, n);
+    return p + n;
+}
+
+// Escreve os dígitos de `valor` no fim de `digitos` (sem terminador), retornando o início
+static char* renderDigitos(long long valor, char digitos[RENDER_MAX_DIGITOS])
+{
+    char* p = digitos + RENDER_MAX_DIGITOS;
+    unsigned long long v = valor < 0 ? 0ULL - (unsigned long long)valor : (unsigned long long)valor;
+
+    do {
+        *--p = (char)('0' + v % 10);
+        v /= 10;
+    } while (v > 0);
+
+    if (valor < 0)
+        *--p = '-';
+
+    return p;
+}
+
+// Texto alinhado na largura da coluna (o texto nunca é cortado, como no `printf`)
+static char* renderAlinhado(char* p, const char* texto, size_t n, int largura)
+{
+    size_t espacos = (size_t)abs(largura) > n ? (size_t)abs(largura) - n : 0;
+
+    if (largura > 0) {
+        memset(p, ' ', espacos);
+        p += espacos;
+    }
+
+    p = renderCopiar(p, texto, n);
+
+    if (largura < 0) {
+        memset(p, ' ', espacos);
+        p += espacos;
+    }
+
+    return p;
+}
+
+// Campo de texto do CSV: entre aspas (com as aspas dobradas) só se tiver separador, aspas ou quebra de linha
+static char* renderCsvString(char* p, const char* texto, size_t n)
+{
+    size_t i;
+
+    for (i = 0; i < n && texto[i] != ';' && texto[i] != '"' && texto[i] != '\r' && texto[i] != '\n'; i++);
+
+    if (i == n)
+        return renderCopiar(p, texto, n);
+
+    *p++ = '"';
+    for (i = 0; i < n; i++) {
+        if (texto[i] == '"')
+            *p++ = '"';
+        *p++ = texto[i];
+    }
+    *p++ = '"';
+
+    return p;
+}
+
+// Texto do JSON entre aspas, com escapes de aspas, barras e caracteres de controle
+static char* renderJsonString(char* p, const char* texto, size_t n)
+{
+    static const char hex[] = "0123456789abcdef";
+    unsigned char c;
+    size_t i;
+
+    *p++ = '"';
+
+    for (i = 0; i < n; i++) {
+        c = (unsigned char)texto[i];
+
+        if (c == '"' || c == '\\') {
+            *p++ = '\\';
+            *p++ = (char)c;
+        } else if (c < 0x20) {
+            p = renderCopiar(p, "\\u00", 4);
+            *p++ = hex[c >> 4];
+            *p++ = hex[c & 15];
+        } else {
+            *p++ = (char)c;
+        }
+    }
+
+    *p++ = '"';
+    return p;
+}
+
+// Separador antes da coluna `coluna` e, no JSON, a sua chave (os nomes das colunas vão sem escapes)
+static char* renderSeparador(const Renderer* r, char* p, int coluna)
+{
+    const char* nome;
+
+    switch (r->formato) {
+        case FORMATO_TEXTO:
+            if (coluna > 0)
+                p = renderCopiar(p, " | ", 3);
+            break;
+
+        case FORMATO_CSV:
+            if (coluna > 0)
+                *p++ = ';';
+            break;
+
+        case FORMATO_JSON:
+            if (coluna == 0)
+                p = r->linhas > 0 ? renderCopiar(p, ",\n{", 3) : renderCopiar(p, "{", 1);
+            else
+                *p++ = ',';
+
+            *p++ = '"';
+            for (nome = r->colunas[coluna].nome; *nome != '\0'; nome++)
+                *p++ = *nome;
+            p = renderCopiar(p, "\":", 2);
+            break;
+    }
+
+    return p;
+}
+
+// Escreve um valor de `n` bytes na próxima coluna; números não levam aspas no CSV nem no JSON
+static void renderValor(Renderer* r, const char* texto, size_t n, bool numero)
+{
+    const RenderColuna* c;
+    char* p;
+
+    if (r->coluna >= r->nColunas) {
+        r->erro = true;  // Mais valores do que colunas
+        return;
+    }
+
+    c = &r->colunas[r->coluna];
+
+    // Uma reserva por valor, no pior caso: todos os bytes escapados no JSON (6 cada) ou o alinhamento no texto
+    p = renderEspaco(r, r->folga + 6 * n + 2 + (size_t)abs(c->largura));
+    if (p == NULL)
+        return;
+
+    p = renderSeparador(r, p, r->coluna);
+
+    switch (r->formato) {
+        case FORMATO_TEXTO: p = renderAlinhado(p, texto, n, c->largura); break;
+        case FORMATO_CSV:   p = numero ? renderCopiar(p, texto, n) : renderCsvString(p, texto, n); break;
+        case FORMATO_JSON:  p = numero ? renderCopiar(p, texto, n) : renderJsonString(p, texto, n); break;
+    }
+
+    r->size = (size_t)(p - r->buffer);
+    r->coluna++;
+}
+
+// --------------------------------------------------
+// API
+// --------------------------------------------------
+
+bool renderParseFormato(const char* nome, FormatoSaida* formato)
+{
+    if (strcmp(nome, "texto") == 0)     *formato = FORMATO_TEXTO;
+    else if (strcmp(nome, "csv") == 0)  *formato = FORMATO_CSV;
+    else if (strcmp(nome, "json") == 0) *formato = FORMATO_JSON;
+    else return false;
+
+    return true;
+}
+
+bool renderBegin(Renderer* r, FILE* saida, FormatoSaida formato, const RenderColuna* colunas, int nColunas)
+{
+    size_t largura;
+    char* p;
+    int i;
+
+    memset(r, 0, sizeof(*r));
+    r->saida = saida;
+    r->formato = formato;
+    r->colunas = colunas;
+    r->nColunas = nColunas;
+
+    // Separador mais longo: `,\n{"<nome>":` no JSON
+    r->folga = 3;
+    for (i = 0; i < nColunas; i++)
+        if (strlen(colunas[i].nome) + 6 > r->folga)
+            r->folga = strlen(colunas[i].nome) + 6;
+
+    if (renderEspaco(r, RENDER_INITIAL_CAPACITY) == NULL)
+        return false;
+
+    switch (formato) {
+        case FORMATO_TEXTO:
+        case FORMATO_CSV:
+            // Cabeçalho: os títulos (texto) ou os nomes (CSV), escritos como uma linha
+            for (i = 0; i < nColunas; i++) {
+                if (formato == FORMATO_TEXTO)
+                    renderValor(r, colunas[i].titulo, strlen(colunas[i].titulo), false);
+                else
+                    renderValor(r, colunas[i].nome, strlen(colunas[i].nome), false);
+            }
+            r->coluna = 0;
+
+            largura = r->size;
+            renderBytes(r, "\n", 1);
+
+            // Traços na largura do cabeçalho
+            if (formato == FORMATO_TEXTO) {
+                p = renderEspaco(r, largura + 1);
+                if (p != NULL) {
+                    memset(p, '-', largura);
+                    p[largura] = '\n';
+                    r->size += largura + 1;
+                }
+            }
+            break;
+
+        case FORMATO_JSON:
+            renderBytes(r, "[\n", 2);
+            break;
+    }
+
+    return !r->erro;
+}
+
+void renderInt(Renderer* r, long long valor)
+{
+    char digitos[RENDER_MAX_DIGITOS];
+    char* inicio = renderDigitos(valor, digitos);
+
+    renderValor(r, inicio, (size_t)(digitos + RENDER_MAX_DIGITOS - inicio), true);
+}
+
+void renderString(Renderer* r, const char* valor)
+{
+    renderValor(r, valor, strlen(valor), false);
+}
+
+void renderChar(Renderer* r, char valor)
+{
+    renderValor(r, &valor, 1, false);
+}
+
+void renderEndRow(Renderer* r)
+{
+    if (r->coluna != r->nColunas)
+        r->erro = true;  // Linha incompleta
+
+    renderBytes(r, r->formato == FORMATO_JSON ? "}" : "\n", 1);
+
+    r->coluna = 0;
+    r->linhas++;
+
+    if (r->size >= RENDER_FLUSH_BYTES)
+        renderFlush(r);
+}
+
+bool renderEnd(Renderer* r)
+{
+    bool ok;
+
+    if (r->formato == FORMATO_JSON)
+        renderBytes(r, r->linhas > 0 ? "\n]\n" : "]\n", r->linhas > 0 ? 3 : 2);
+
+    renderFlush(r);
+    ok = !r->erro;
+
+    free(r->buffer);
+    r->buffer = NULL;
+    r->capacity = 0;
+
+    return ok;
+}
+
+#endif
@@ -1,13 +1,16 @@
-#ifndef VIEW_WRAPPER_C
-#define VIEW_WRAPPER_C 0
-
-#include "./0_utils.c"
-#include "./1_time.c"
-#include "./2_partida.c"
-#include "./3_atualizarPartida.c"
-#include "./4_excluirPartida.c"
-#include "./5_inserirPartida.c"
-#include "./6_imprimirTabelaClassificacao.c"
-#include "./menu.c"
-
+#ifndef VIEW_WRAPPER_C
+#define VIEW_WRAPPER_C 0
+
+#include "./0_utils.c"
+#include "./1_time.c"
+#include "./2_partida.c"
+#include "./3_atualizarPartida.c"
+#include "./4_excluirPartida.c"
+#include "./5_inserirPartida.c"
+#include "./6_imprimirTabelaClassificacao.c"
+#include "./7_checkpoint.c"
+#include "./8_comandos.c"
+#include "./9_servidor.c"
+#include "./menu.c"
+
 #endif
\ No newline at end of file